@@ -42,20 +42,14 @@ ShapePath {
     property var edgeTemplate: undefined
     property var edgeItem: edgeTemplate.edgeItem
 
-    startX: edgeItem.p1.x
-    startY: edgeItem.p1.y
     capStyle: ShapePath.FlatCap
     strokeWidth: edgeItem?.style?.lineWidth ?? 2
     strokeColor: edgeTemplate.color
     strokeStyle: edgeTemplate.dashed
     dashPattern: edgeItem?.style?.dashPattern ?? [4, 2]
     fillColor: Qt.rgba(0,0,0,0)
-    PathLine {
-        x: edgeItem.c1.x
-        y: edgeItem.c1.y
-    }
-    PathLine {
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
+    // P1 -> C1 -> P2, or P1 -> bends -> P2 for routed edges
+    PathPolyline {
+        path: edgeItem.orthoPath
     }
 }
@@ -45,170 +45,212 @@ Item {
     // Allow direct bypass of style
     property var    lineType: edgeItem?.style?.lineType ?? Qan.EdgeStyle.Straight
     property var    dashed  : edgeItem?.style?.dashed ? ShapePath.DashLine : ShapePath.SolidLine
+    // Draw arrows with qan::ArrowItem instead of Shape (opt-in, scene graph arrows are not antialiased).
+    property bool   sceneGraphArrows: false
 
     visible: edgeItem.visible && !edgeItem.hidden
 
-    Shape {
-        id: dstShape
-        visible: dstShapeType !== Qan.EdgeStyle.None
-        transformOrigin: Item.TopLeft
-        rotation: edgeItem.dstAngle
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
-        preferredRendererType: Shape.CurveRenderer
+    // Note: Batched edges are drawn by qan::EdgeBatchRenderer, shapes are only instantiated
+    // for selected batched edges (batch renderer does not draw selected edges). Dashed and
+    // grouped edges are never batched.
+    Loader {
+        anchors.fill: parent
+        active: !edgeItem.batched || edgeItem.selected
+        sourceComponent: Item {
+            // Note: Arrows are drawn with antialiased CurveRenderer shapes by default, scene graph
+            // qan::ArrowItem arrows (faster, not antialiased) are used only when sceneGraphArrows is set.
+            Loader {
+                active: !edgeTemplate.sceneGraphArrows
+                sourceComponent: Item {
+                    Shape {
+                        id: dstShape
+                        visible: dstShapeType !== Qan.EdgeStyle.None
+                        transformOrigin: Item.TopLeft
+                        rotation: edgeItem.dstAngle
+                        x: edgeItem.p2.x
+                        y: edgeItem.p2.y
+                        preferredRendererType: Shape.CurveRenderer
 
-        property var dstArrow : undefined
-        property var dstCircle: undefined
-        property var dstRect  : undefined
-        property var dstShapeType: edgeItem.dstShape
-        onDstShapeTypeChanged: {
-            switch (dstShapeType) {
-            case Qan.EdgeStyle.None:
-                break;
-            case Qan.EdgeStyle.Arrow:       // falltrought
-            case Qan.EdgeStyle.ArrowOpen:
-                if (dstCircle) dstCircle.destroy()
-                if (dstRect) dstRect.destroy()
-                dstShape.data = dstArrow = qanEdgeDstArrowPathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate});
-                break;
-            case Qan.EdgeStyle.Circle:      // falltrought
-            case Qan.EdgeStyle.CircleOpen:
-                if (dstArrow) dstArrow.destroy()
-                if (dstRect) dstRect.destroy()
-                dstShape.data = dstCircle = qanEdgeDstCirclePathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
-                break;
-            case Qan.EdgeStyle.Rect:        // falltrought
-            case Qan.EdgeStyle.RectOpen:
-                if (dstArrow) dstArrow.destroy()
-                if (dstCircle) dstCircle.destroy()
-                dstShape.data = dstRect = qanEdgeDstRectPathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
-                break;
-            }
-        }
-    }  // Shape: dstShape
+                        property var dstArrow : undefined
+                        property var dstCircle: undefined
+                        property var dstRect  : undefined
+                        property var dstShapeType: edgeItem.dstShape
+                        onDstShapeTypeChanged: updateDstShape()
+                        Component.onCompleted: updateDstShape()
+                        function updateDstShape() {
+                            if (dstArrow) dstArrow.destroy()  // Path might have been generated on completion
+                            if (dstCircle) dstCircle.destroy()
+                            if (dstRect) dstRect.destroy()
+                            switch (dstShapeType) {
+                            case Qan.EdgeStyle.None:
+                                break;
+                            case Qan.EdgeStyle.Arrow:       // falltrought
+                            case Qan.EdgeStyle.ArrowOpen:
+                                dstShape.data = dstArrow = qanEdgeDstArrowPathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate});
+                                break;
+                            case Qan.EdgeStyle.Circle:      // falltrought
+                            case Qan.EdgeStyle.CircleOpen:
+                                dstShape.data = dstCircle = qanEdgeDstCirclePathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
+                                break;
+                            case Qan.EdgeStyle.Rect:        // falltrought
+                            case Qan.EdgeStyle.RectOpen:
+                                dstShape.data = dstRect = qanEdgeDstRectPathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
+                                break;
+                            }
+                        }
+                    }  // Shape: dstShape
 
-    Shape {
-        id: srcShape
-        visible: srcShapeType !== Qan.EdgeStyle.None
+                    Shape {
+                        id: srcShape
+                        visible: srcShapeType !== Qan.EdgeStyle.None
+                        transformOrigin: Item.TopLeft
+                        rotation: edgeItem.srcAngle
+                        x: edgeItem.p1.x
+                        y: edgeItem.p1.y
+                        preferredRendererType: Shape.CurveRenderer
 
-        preferredRendererType: Shape.CurveRenderer
-        transformOrigin: Item.TopLeft
-        rotation: edgeItem.srcAngle
-        x: edgeItem.p1.x
-        y: edgeItem.p1.y
+                        property var srcArrow : undefined
+                        property var srcCircle: undefined
+                        property var srcRect  : undefined
+                        property var srcShapeType: edgeItem.srcShape
+                        onSrcShapeTypeChanged: updateSrcShape()
+                        Component.onCompleted: updateSrcShape()
+                        function updateSrcShape() {
+                            if (srcArrow) srcArrow.destroy()  // Path might have been generated on completion
+                            if (srcCircle) srcCircle.destroy()
+                            if (srcRect) srcRect.destroy()
+                            switch (srcShapeType) {
+                            case Qan.EdgeStyle.None:
+                                break;
+                            case Qan.EdgeStyle.Arrow:       // falltrought
+                            case Qan.EdgeStyle.ArrowOpen:
+                                srcShape.data = srcArrow = qanEdgeSrcArrowPathComponent.createObject(srcShape, {edgeTemplate: edgeTemplate});
+                                break;
+                            case Qan.EdgeStyle.Circle:      // falltrought
+                            case Qan.EdgeStyle.CircleOpen:
+                                srcShape.data = srcCircle = qanEdgeSrcCirclePathComponent.createObject(srcShape, {edgeTemplate: edgeTemplate})
+                                break;
+                            case Qan.EdgeStyle.Rect:        // falltrought
+                            case Qan.EdgeStyle.RectOpen:
+                                srcShape.data = srcRect = qanEdgeSrcRectPathComponent.createObject(srcShape, {edgeTemplate: edgeTemplate})
+                                break;
+                            }
+                        }
+                    }  // Shape: srcShape
+                }  // Item: shape arrows
+            }  // Loader: shape arrows
 
-        property var srcArrow : undefined
-        property var srcCircle: undefined
-        property var srcRect  : undefined
-        property var srcShapeType: edgeItem.srcShape
-        onSrcShapeTypeChanged: {
-            switch (srcShapeType) {
-            case Qan.EdgeStyle.None:
-                break;
-            case Qan.EdgeStyle.Arrow:       // falltrought
-            case Qan.EdgeStyle.ArrowOpen:
-                if (srcCircle) srcCircle.destroy()
-                if (srcRect) srcRect.destroy()
-                srcShape.data = srcArrow = qanEdgeSrcArrowPathComponent.createObject(srcShape, {edgeTemplate: edgeTemplate});
-                break;
-            case Qan.EdgeStyle.Circle:      // falltrought
-            case Qan.EdgeStyle.CircleOpen:
-                if (srcArrow) srcArrow.destroy()
-                if (srcRect) srcRect.destroy()
-                srcShape.data = srcCircle = qanEdgeSrcCirclePathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
-                break;
-            case Qan.EdgeStyle.Rect:        // falltrought
-            case Qan.EdgeStyle.RectOpen:
-                if (srcArrow) srcArrow.destroy()
-                if (srcCircle) srcCircle.destroy()
-                srcShape.data = srcRect = qanEdgeSrcRectPathComponent.createObject(dstShape, {edgeTemplate: edgeTemplate})
-                break;
-            }
-        }
-    }  // Shape: srcShape
+            Loader {
+                active: edgeTemplate.sceneGraphArrows
+                sourceComponent: Item {
+                    Qan.ArrowItem {
+                        edgeItem: edgeTemplate.edgeItem
+                        end: Qan.ArrowItem.Destination
+                        color: edgeTemplate.color
+                        lineWidth: edgeItem?.style?.lineWidth ?? 2.
+                    }
+                    Qan.ArrowItem {
+                        edgeItem: edgeTemplate.edgeItem
+                        end: Qan.ArrowItem.Source
+                        color: edgeTemplate.color
+                        lineWidth: edgeItem?.style?.lineWidth ?? 2.
+                    }
+                }  // Item: scene graph arrows
+            }  // Loader: scene graph arrows
 
-    Shape {
-        id: edgeSelectionShape
-        anchors.fill: parent
-        preferredRendererType: Shape.CurveRenderer
-        visible: edgeItem.visible &&
-                 !edgeItem.hidden &&
-                 edgeItem.selected     // Not very efficient, use a Loader there...
-        property var curvedLine : undefined
-        property var straightLine : undefined
-        property var orthoLine : undefined
-        property var lineType: edgeTemplate.lineType
-        property var lineWidth: edgeItem?.style?.lineWidth + 2. ?? 4.
-        property var lineColor: edgeItem &&
-                                edgeItem.graph ? edgeItem.graph.selectionColor :
-                                                 Qt.rgba(0.1176, 0.5647, 1., 1.)  // dodgerblue=rgb(30, 144, 255)
-        onLineTypeChanged: updateSelectionShape()
-        onVisibleChanged: updateSelectionShape()
-        function updateSelectionShape() {
-            if (!visible)
-                return
-            switch (lineType) {
-            case Qan.EdgeStyle.Undefined:   // falltrought
-            case Qan.EdgeStyle.Straight:
-                if (orthoLine) orthoLine.destroy()
-                if (curvedLine) curvedLine.destroy()
-                edgeSelectionShape.data = straightLine = qanEdgeStraightPathComponent.createObject(edgeSelectionShape, {
-                                                                                              edgeTemplate: edgeTemplate,
-                                                                                              strokeWidth: lineWidth,
-                                                                                              strokeColor: lineColor
-                                                                                          });
-                break;
-            case Qan.EdgeStyle.Ortho:
-                if (straightLine) straightLine.destroy()
-                if (curvedLine) curvedLine.destroy()
-                edgeSelectionShape.data = orthoLine = qanEdgeOrthoPathComponent.createObject(edgeSelectionShape, {
-                                                                                                 edgeTemplate: edgeTemplate,
-                                                                                                 strokeWidth: lineWidth,
-                                                                                                 strokeColor: lineColor
-                                                                                             })
-                break;
-            case Qan.EdgeStyle.Curved:
-                if (straightLine) straightLine.destroy()
-                if (orthoLine) orthoLine.destroy()
-                edgeSelectionShape.data = curvedLine = qanEdgeCurvedPathComponent.createObject(edgeSelectionShape, {
-                                                                                                   edgeTemplate: edgeTemplate,
-                                                                                                   strokeWidth: lineWidth,
-                                                                                                   strokeColor: lineColor
-                                                                                               })
-                break;
-            }
-        }
-    }  // Shape: edgeSelectionShape
+            Shape {
+                id: edgeSelectionShape
+                anchors.fill: parent
+                preferredRendererType: Shape.CurveRenderer
+                visible: edgeItem.visible &&
+                         !edgeItem.hidden &&
+                         edgeItem.selected     // Not very efficient, use a Loader there...
+                property var curvedLine : undefined
+                property var straightLine : undefined
+                property var orthoLine : undefined
+                property var lineType: edgeTemplate.lineType
+                property var lineWidth: edgeItem?.style?.lineWidth + 2. ?? 4.
+                property var lineColor: edgeItem &&
+                                        edgeItem.graph ? edgeItem.graph.selectionColor :
+                                                         Qt.rgba(0.1176, 0.5647, 1., 1.)  // dodgerblue=rgb(30, 144, 255)
+                onLineTypeChanged: updateSelectionShape()
+                onVisibleChanged: updateSelectionShape()
+                // Note: Shapes might be loaded after lineType and visible have been set (for example
+                // when a batched edge is selected), generate initial path on completion.
+                Component.onCompleted: updateSelectionShape()
+                function updateSelectionShape() {
+                    if (!edgeItem ||
+                        !edgeItem.selected)
+                        return
+                    switch (lineType) {
+                    case Qan.EdgeStyle.Undefined:   // falltrought
+                    case Qan.EdgeStyle.Straight:
+                        if (straightLine) straightLine.destroy()   // Path might have been generated on completion
+                        if (orthoLine) orthoLine.destroy()
+                        if (curvedLine) curvedLine.destroy()
+                        edgeSelectionShape.data = straightLine = qanEdgeStraightPathComponent.createObject(edgeSelectionShape, {
+                                                                                                      edgeTemplate: edgeTemplate,
+                                                                                                      strokeWidth: lineWidth,
+                                                                                                      strokeColor: lineColor
+                                                                                                  });
+                        break;
+                    case Qan.EdgeStyle.Ortho:
+                        if (orthoLine) orthoLine.destroy()
+                        if (straightLine) straightLine.destroy()
+                        if (curvedLine) curvedLine.destroy()
+                        edgeSelectionShape.data = orthoLine = qanEdgeOrthoPathComponent.createObject(edgeSelectionShape, {
+                                                                                                         edgeTemplate: edgeTemplate,
+                                                                                                         strokeWidth: lineWidth,
+                                                                                                         strokeColor: lineColor
+                                                                                                     })
+                        break;
+                    case Qan.EdgeStyle.Curved:
+                        if (curvedLine) curvedLine.destroy()
+                        if (straightLine) straightLine.destroy()
+                        if (orthoLine) orthoLine.destroy()
+                        edgeSelectionShape.data = curvedLine = qanEdgeCurvedPathComponent.createObject(edgeSelectionShape, {
+                                                                                                           edgeTemplate: edgeTemplate,
+                                                                                                           strokeWidth: lineWidth,
+                                                                                                           strokeColor: lineColor
+                                                                                                       })
+                        break;
+                    }
+                }
+            }  // Shape: edgeSelectionShape
 
-    Shape {
-        id: edgeShape
-        anchors.fill: parent
-        visible: edgeItem.visible && !edgeItem.hidden
-        // Note 20240815: Do not pay the curve renderer cost for horiz/vert ortho lines
-        preferredRendererType: lineType === Qan.EdgeStyle.Ortho ? Qan.EdgeStyle.Ortho : Shape.CurveRenderer
-        property var curvedLine : undefined
-        property var straightLine : undefined
-        property var orthoLine : undefined
-        property var lineType: edgeTemplate.lineType
-        onLineTypeChanged: {
-            switch (lineType) {
-            case Qan.EdgeStyle.Undefined:   // falltrought
-            case Qan.EdgeStyle.Straight:
-                if (orthoLine) orthoLine.destroy()
-                if (curvedLine) curvedLine.destroy()
-                edgeShape.data = straightLine = qanEdgeStraightPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate});
-                break;
-            case Qan.EdgeStyle.Ortho:
-                if (straightLine) straightLine.destroy()
-                if (curvedLine) curvedLine.destroy()
-                edgeShape.data = orthoLine = qanEdgeOrthoPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate})
-                break;
-            case Qan.EdgeStyle.Curved:
-                if (straightLine) straightLine.destroy()
-                if (orthoLine) orthoLine.destroy()
-                edgeShape.data = curvedLine = qanEdgeCurvedPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate})
-                break;
-            }
-        }
-    }  // Shape: edgeShape
+            Shape {
+                id: edgeShape
+                anchors.fill: parent
+                visible: edgeItem.visible && !edgeItem.hidden
+                // Note 20240815: Do not pay the curve renderer cost for horiz/vert ortho lines
+                preferredRendererType: lineType === Qan.EdgeStyle.Ortho ? Qan.EdgeStyle.Ortho : Shape.CurveRenderer
+                property var curvedLine : undefined
+                property var straightLine : undefined
+                property var orthoLine : undefined
+                property var lineType: edgeTemplate.lineType
+                onLineTypeChanged: updateShape()
+                Component.onCompleted: updateShape()
+                function updateShape() {
+                    switch (lineType) {
+                    case Qan.EdgeStyle.Undefined:   // falltrought
+                    case Qan.EdgeStyle.Straight:
+                        if (orthoLine) orthoLine.destroy()
+                        if (curvedLine) curvedLine.destroy()
+                        edgeShape.data = straightLine = qanEdgeStraightPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate});
+                        break;
+                    case Qan.EdgeStyle.Ortho:
+                        if (straightLine) straightLine.destroy()
+                        if (curvedLine) curvedLine.destroy()
+                        edgeShape.data = orthoLine = qanEdgeOrthoPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate})
+                        break;
+                    case Qan.EdgeStyle.Curved:
+                        if (straightLine) straightLine.destroy()
+                        if (orthoLine) orthoLine.destroy()
+                        edgeShape.data = curvedLine = qanEdgeCurvedPathComponent.createObject(edgeShape, {edgeTemplate: edgeTemplate})
+                        break;
+                    }
+                }
+            }  // Shape: edgeShape
+        }  // Item: shapes
+    }  // Loader: shapes
 }  // Item: edgeTemplate
@@ -77,6 +77,8 @@ RowLayout {
     ]
 
     property var hostNodeItem: undefined
+    // Docks and their ports are hidden below full level of detail
+    visible: (hostNodeItem?.levelOfDetail ?? Qan.NodeItem.Full) === Qan.NodeItem.Full
     property int dockType: -1
     property int topMargin: 7
     property int bottomMargin: 7
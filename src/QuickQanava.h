@@ -43,6 +43,12 @@
 // QuickQanava headers
 #include "./qanEdge.h"
 #include "./qanEdgeItem.h"
+#include "./qanArrowItem.h"
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanNodeBatchRenderer.h"
+#include "./qanOrthoRouter.h"
+#include "./qanSpatialIndex.h"
+#include "./qanItemIncubator.h"
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
 #include "./qanPortItem.h"
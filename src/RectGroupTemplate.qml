@@ -62,6 +62,9 @@ Item {
     //! Enable drawing an horizontal separator at heaer bottom, mioght be usefull for TableGroup (default to false).
     property bool   headerSeparatorVisible: false
 
+    // Label and collapser are hidden below full level of detail (header keeps its size, content does not move).
+    readonly property bool  fullDetail: (groupItem?.levelOfDetail ?? Qan.NodeItem.Full) === Qan.NodeItem.Full
+
     enabled: {
         if (groupItem &&
             groupItem.group) {
@@ -75,7 +78,7 @@ Item {
         id: groupBackground
         anchors.fill: parent
         style: template.groupItem?.style
-        visible: !groupItem.collapsed
+        visible: !groupItem.collapsed && !groupItem.batched     // Batched groups are drawn by Qan.NodeBatchRenderer
         headerHeight: Math.max(35, groupLabel.implicitHeight)
         antialiasing: template.antialiasing
     }
@@ -99,7 +102,7 @@ Item {
                 font.pixelSize: 13
                 font.bold: true
                 onClicked: groupItem.collapsed = !groupItem.collapsed
-                visible: groupItem?.expandButtonVisible
+                visible: groupItem?.expandButtonVisible && template.fullDetail
             }
             Item {
                 id: labelEditorControl
@@ -124,7 +127,7 @@ Item {
                     text: groupItem &&
                           groupItem.group ? groupItem.group.label :
                                             "              "
-                    visible: !labelEditor.visible
+                    visible: !labelEditor.visible && template.fullDetail
                     verticalAlignment: Text.AlignVCenter
                     font.bold: groupItem.style.fontBold
                     font.pointSize: labelEditorControl.labelPointSize
@@ -62,11 +62,16 @@ Item {
     }
 
     readonly property real   backRadius: nodeItem?.style?.backRadius ?? 4.
+    // Labels, content and effects are hidden below full level of detail, background is unloaded when
+    // node is drawn by a Qan.NodeBatchRenderer.
+    readonly property bool   fullDetail: (nodeItem?.levelOfDetail ?? Qan.NodeItem.Full) === Qan.NodeItem.Full
     Loader {
         id: delegateLoader
         anchors.fill: parent
+        active: !(nodeItem?.batched ?? false)
         source: {
-            if (!nodeItem?.style)     // Defaul to solid no effect with unconfigured nodes
+            if (!nodeItem?.style ||   // Defaul to solid no effect with unconfigured nodes
+                !template.fullDetail)
                 return "qrc:/QuickQanava/RectSolidBackground.qml";
             switch (nodeItem.style.fillType) {  // Otherwise, select the delegate according to current style configuration
             case Qan.NodeStyle.FillSolid:
@@ -95,7 +100,7 @@ Item {
         anchors.fill: parent
         anchors.margins: backRadius / 2.
         spacing: 0
-        visible: !labelEditor.visible
+        visible: !labelEditor.visible && template.fullDetail
         Label {
             id: nodeLabel
             Layout.fillWidth: true
@@ -43,6 +43,8 @@ ColumnLayout {
     z: 1.5   // Selection item z=1.0, dock must be on top of selection
 
     property var hostNodeItem: undefined
+    // Docks and their ports are hidden below full level of detail
+    visible: (hostNodeItem?.levelOfDetail ?? Qan.NodeItem.Full) === Qan.NodeItem.Full
     property int dockType: -1
     property int leftMargin: 7
     property int rightMargin: 7
@@ -0,0 +1,284 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	algorithms.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <algorithm>        // std::min, std::reverse
+#include <functional>       // std::greater
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <utility>          // std::pair
+#include <vector>
+
+// GTpo headers
+#include "./snapshot.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Partition of a gtpo::snapshot nodes in components.
+ *
+ * \c component[id] is the component index of node \c id, components are indexed in [0, count[.
+ */
+template <class node_id>
+struct components {
+    std::vector<node_id>    component;
+    std::size_t             count = 0;
+
+    //! Return components nodes ids, grouped by component (result[c] contains component \c c nodes in increasing id order).
+    auto    get_members() const -> std::vector<std::vector<node_id>> {
+        std::vector<std::vector<node_id>> members(count);
+        for (std::size_t id = 0; id < component.size(); ++id)
+            members[component[id]].push_back(static_cast<node_id>(id));
+        return members;
+    }
+};
+
+/*! \brief Single source shortest paths computed with dijkstra_shortest_paths().
+ *
+ * \c distances[id] is infinity() for nodes that are not reachable from source, \c predecessors[id]
+ * is snapshot invalid_id for source and unreachable nodes.
+ */
+template <class node_id>
+struct shortest_paths {
+    std::vector<double>     distances;
+    std::vector<node_id>    predecessors;
+
+    static constexpr auto   infinity() noexcept -> double { return std::numeric_limits<double>::infinity(); }
+
+    //! Return node ids on shortest path from source to \c destination (empty if \c destination is not reachable).
+    auto    get_path(node_id destination) const -> std::vector<node_id> {
+        std::vector<node_id> path;
+        if (destination >= distances.size() ||
+            distances[destination] == infinity())
+            return path;
+        for (auto id = destination;
+             id != std::numeric_limits<node_id>::max();
+             id = predecessors[id])
+            path.push_back(id);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+/*! \brief Compute strongly connected components of \c snapshot with an iterative Tarjan algorithm, O(V + E).
+ *
+ * \note Components are indexed in reverse topological order of the condensation graph: if component \c a
+ * has an edge to component \c b, then b < a.
+ */
+template <class node_t, class edge_t>
+auto    strongly_connected_components(const gtpo::snapshot<node_t, edge_t>& snapshot) -> components<typename gtpo::snapshot<node_t, edge_t>::node_id>
+{
+    using snapshot_t = gtpo::snapshot<node_t, edge_t>;
+    using node_id = typename snapshot_t::node_id;
+    constexpr auto invalid_id = snapshot_t::invalid_id;
+    const auto node_count = snapshot.get_node_count();
+
+    components<node_id> result;
+    result.component.assign(node_count, invalid_id);
+    std::vector<node_id>    index(node_count, invalid_id);
+    std::vector<node_id>    lowlink(node_count, 0);
+    gtpo::node_marks        on_stack{node_count};
+    std::vector<node_id>    scc_stack;
+    std::vector<std::pair<node_id, std::size_t>> call_stack;    // (node, next out node index)
+    node_id next_index = 0;
+
+    for (node_id root = 0; root < static_cast<node_id>(node_count); ++root) {
+        if (index[root] != invalid_id)
+            continue;
+        index[root] = lowlink[root] = next_index++;
+        scc_stack.push_back(root);
+        on_stack.set(root);
+        call_stack.emplace_back(root, 0);
+        while (!call_stack.empty()) {
+            const auto v = call_stack.back().first;
+            const auto out_nodes = snapshot.get_out_nodes(v);
+            if (call_stack.back().second < out_nodes.size()) {
+                const auto w = out_nodes[call_stack.back().second++];
+                if (index[w] == invalid_id) {       // "Recurse" on w
+                    index[w] = lowlink[w] = next_index++;
+                    scc_stack.push_back(w);
+                    on_stack.set(w);
+                    call_stack.emplace_back(w, 0);
+                } else if (on_stack.test(w))
+                    lowlink[v] = std::min(lowlink[v], index[w]);
+                continue;
+            }
+            if (lowlink[v] == index[v]) {           // v is a component root, pop component
+                const auto c = static_cast<node_id>(result.count++);
+                node_id w = invalid_id;
+                do {
+                    w = scc_stack.back();
+                    scc_stack.pop_back();
+                    on_stack.reset(w);
+                    result.component[w] = c;
+                } while (w != v);
+            }
+            call_stack.pop_back();
+            if (!call_stack.empty()) {
+                const auto parent = call_stack.back().first;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+            }
+        }
+    }
+    return result;
+}
+
+/*! \brief Compute weakly connected components of \c snapshot (edge direction is ignored) using union-find, O(E α(V)).
+ *
+ * \note Components are indexed in order of their lowest node id.
+ */
+template <class node_t, class edge_t>
+auto    weakly_connected_components(const gtpo::snapshot<node_t, edge_t>& snapshot) -> components<typename gtpo::snapshot<node_t, edge_t>::node_id>
+{
+    using node_id = typename gtpo::snapshot<node_t, edge_t>::node_id;
+    const auto node_count = snapshot.get_node_count();
+    std::vector<node_id> parents(node_count);
+    std::vector<node_id> sizes(node_count, 1);
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id)
+        parents[id] = id;
+    const auto find = [&parents](node_id id) {
+        while (parents[id] != id) {
+            parents[id] = parents[parents[id]];     // Path halving
+            id = parents[id];
+        }
+        return id;
+    };
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id) {
+        for (const auto out_id : snapshot.get_out_nodes(id)) {
+            auto a = find(id);
+            auto b = find(out_id);
+            if (a == b)
+                continue;
+            if (sizes[a] < sizes[b])                // Union by size
+                std::swap(a, b);
+            parents[b] = a;
+            sizes[a] += sizes[b];
+        }
+    }
+
+    components<node_id> result;
+    result.component.assign(node_count, gtpo::snapshot<node_t, edge_t>::invalid_id);
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id) {
+        const auto root = find(id);
+        if (result.component[root] == gtpo::snapshot<node_t, edge_t>::invalid_id)
+            result.component[root] = static_cast<node_id>(result.count++);
+        result.component[id] = result.component[root];
+    }
+    return result;
+}
+
+/*! \brief Return \c snapshot nodes reachable from \c source grouped by BFS distance (result[0] contains only \c source).
+ *
+ * Complexity is O(V + E).
+ */
+template <class node_t, class edge_t>
+auto    bfs_layers(const gtpo::snapshot<node_t, edge_t>& snapshot,
+                   typename gtpo::snapshot<node_t, edge_t>::node_id source) -> std::vector<std::vector<typename gtpo::snapshot<node_t, edge_t>::node_id>>
+{
+    using node_id = typename gtpo::snapshot<node_t, edge_t>::node_id;
+    std::vector<std::vector<node_id>> layers;
+    if (source >= snapshot.get_node_count())
+        return layers;
+    auto marks = snapshot.make_marks();
+    marks.set(source);
+    layers.push_back({source});
+    while (true) {
+        std::vector<node_id> next_layer;
+        for (const auto id : layers.back())
+            for (const auto out_id : snapshot.get_out_nodes(id))
+                if (marks.test_and_set(out_id))
+                    next_layer.push_back(out_id);
+        if (next_layer.empty())
+            break;
+        layers.push_back(std::move(next_layer));
+    }
+    return layers;
+}
+
+/*! \brief Compute shortest paths from \c source to all \c snapshot nodes using Dijkstra algorithm, O((V + E) log V).
+ *
+ * \c weight is a callable returning edge weight for a given edge: <tt>double weight(const edge_t&)</tt>, weights must
+ * be positive or zero. Edges with a negative weight are reported and ignored.
+ */
+template <class node_t, class edge_t, class weight_t>
+auto    dijkstra_shortest_paths(const gtpo::snapshot<node_t, edge_t>& snapshot,
+                                typename gtpo::snapshot<node_t, edge_t>::node_id source,
+                                weight_t&& weight) -> shortest_paths<typename gtpo::snapshot<node_t, edge_t>::node_id>
+{
+    using node_id = typename gtpo::snapshot<node_t, edge_t>::node_id;
+    using result_t = shortest_paths<node_id>;
+    result_t result;
+    const auto node_count = snapshot.get_node_count();
+    result.distances.assign(node_count, result_t::infinity());
+    result.predecessors.assign(node_count, gtpo::snapshot<node_t, edge_t>::invalid_id);
+    if (source >= node_count)
+        return result;
+
+    using entry_t = std::pair<double, node_id>;     // (distance, node)
+    std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> queue;
+    auto settled = snapshot.make_marks();
+    result.distances[source] = 0.;
+    queue.emplace(0., source);
+    bool negative_weight = false;
+    while (!queue.empty()) {
+        const auto id = queue.top().second;
+        queue.pop();
+        if (!settled.test_and_set(id))  // Lazy deletion of outdated queue entries
+            continue;
+        const auto out_nodes = snapshot.get_out_nodes(id);
+        const auto out_edges = snapshot.get_out_edges(id);
+        for (std::size_t o = 0; o < out_nodes.size(); ++o) {
+            const auto out_id = out_nodes[o];
+            const double w = weight(*out_edges[o]);
+            if (w < 0.) {
+                negative_weight = true;
+                continue;
+            }
+            const auto distance = result.distances[id] + w;
+            if (distance < result.distances[out_id]) {
+                result.distances[out_id] = distance;
+                result.predecessors[out_id] = id;
+                queue.emplace(distance, out_id);
+            }
+        }
+    }
+    if (negative_weight)
+        std::cerr << "gtpo::dijkstra_shortest_paths(): Warning: Edges with negative weight have been ignored." << std::endl;
+    return result;
+}
+
+} // ::gtpo
@@ -100,6 +100,17 @@ private:
     node_t* _dst = nullptr;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Graph Slot Management *///--------------------------------------
+    //@{
+public:
+    /*! \brief Index of this edge in its graph edges container (-1 when edge is not inserted in a graph).
+     *
+     * \note Maintained by gtpo::graph<> to remove edges in O(1), should not be modified by user code.
+     */
+    int     _edges_slot = -1;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::gtpo
@@ -36,13 +36,24 @@
 
 // STD headers
 #include <unordered_set>
+#include <algorithm>        // std::remove_if
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <memory>
+#include <utility>          // std::pair
+#include <vector>
+
+// Qt headers
+#include <QMultiHash>
 
 // GTpo headers
 #include "./container_adapter.h"
 #include "./observable.h"
 #include "./observer.h"
+#include "./snapshot.h"
+#include "./reachability.h"
+#include "./topological_order.h"
+#include "./traversal.h"
 
 /*! \brief GTPO for Generic Graph ToPolOgy.
  */
@@ -77,6 +88,8 @@ public:
 
     using edges_t           = qcm::Container<QVector, edge_t*>;
     using edges_search_t    = QSet<edge_t*>;
+    //! Map an edge (source, destination) pair to all parallel edges between source and destination.
+    using edges_index_t     = QMultiHash<std::pair<const node_t*, const node_t*>, edge_t*>;
 
     //! User friendly shortcut type to graph gtpo::observable<> base class.
     using observable_base_t =  gtpo::observable_graph<graph_base_t, node_t, edge_t, group_t>;
@@ -128,9 +141,19 @@ public:
      */
     auto    insert_node(node_t* node) -> bool;
 
+    /*! \brief Insert a set of already existing \c nodes in graph (graph take ownership of inserted nodes).
+     *
+     * Semantic is the same than calling insert_node() for every node, but containers storage is reserved
+     * once and graph nodes model is notified with a single rows insertion.
+     * \note nullptr nodes or nodes already inserted in graph are ignored.
+     * \return the number of successfully inserted nodes.
+     */
+    auto    insert_nodes(const std::vector<node_t*>& nodes) -> std::size_t;
+
     /*! \brief Remove node \c node from graph.
      *
-     * Complexity depends on config_t::node_container_t.
+     * Complexity is O(1) (plus removal of \c node in and out edges).
+     * \note Graph last node is moved to \c node index in get_nodes(): nodes order is not preserved.
      * \note If \c node is actually grouped in a group, it will first be ungrouped before
      * beeing removed (any group behaviour will also be notified that the node is ungrouped).
      */
@@ -202,33 +225,51 @@ public:
      */
     auto        insert_edge(edge_t* edge) -> bool;
 
+    /*! \brief Create and insert a directed edge for every (source, destination) pair in \c edges.
+     *
+     * \note Pairs with a nullptr source or destination are ignored, created edges that could not be inserted
+     * are deleted.
+     * \return the inserted edges (in \c edges order), all owned by graph.
+     * \sa insert_edges(const std::vector<edge_t*>&)
+     */
+    auto        insert_edges(const std::vector<std::pair<node_t*, node_t*>>& edges) -> std::vector<edge_t*>;
+
+    /*! \brief Insert a set of directed edges created outside of GTpo into the graph.
+     *
+     * Semantic is the same than calling insert_edge() for every edge, but containers storage is
+     * reserved once and graph edges model is notified with a single rows insertion.
+     * \note Edges with a nullptr source or destination, or already inserted in graph are ignored.
+     * \note On error, edges that could not be linked to their source and destination are removed from
+     * graph containers, their graph is reset to nullptr and they are not owned by graph.
+     * \return the number of successfully inserted edges.
+     */
+    auto        insert_edges(const std::vector<edge_t*>& edges) -> std::size_t;
+
     /*! \brief Remove first directed edge found between \c source and \c destination node.
      *
-     * If the current graph<> config_t::edge_container_t and config_t::node_container_t allow parrallel edges support, the first
-     * edge found between \c source and \c destination will be removed.
+     * When there are parallel edges between \c source and \c destination, the first inserted
+     * edge is removed.
      *
-     * Complexity is O(edge count) at worst.
+     * Average complexity is O(1) (O(parallel edge count) with parallel edges).
      */
     auto        remove_edge(node_t* source, node_t* destination) -> bool;
 
     /*! \brief Remove all directed edge between \c source and \c destination node.
      *
-     * If the current graph<> config_t::edge_container_t and config_t::node_container_t allow parrallel edges support, the first
-     * edge found between \c source and \c destination will be removed.
-     *
-     * Worst case complexity is O(edge count).
+     * Average complexity is O(parallel edge count).
      */
     auto        remove_all_edges(node_t* source, node_t* destination) -> bool;
 
     /*! \brief Remove directed edge \c edge.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(1) (plus source out degree and destination in degree).
+     * \note Graph last edge is moved to \c edge index in get_edges(): edges order is not preserved.
      */
     auto        remove_edge(edge_t* edge) -> bool;
 
     /*! \brief Look for the first directed edge between \c source and \c destination and return it.
      *
-     * Worst case complexity is O(edge count).
+     * Average complexity is O(1) (O(parallel edge count) with parallel edges).
      * \return A shared reference on edge, en empty shared reference otherwise (result == false).
      * \throw noexcept.
      */
@@ -236,7 +277,7 @@ public:
     /*! \brief Test if a directed edge exists between nodes \c source and \c destination.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Average complexity is O(1).
      * \throw noexcept.
      */
     auto        has_edge(const node_t* source, const node_t* destination) const -> bool;
@@ -251,12 +292,9 @@ public:
     //! Return the number of edges currently existing in graph.
     auto        get_edge_count() const noexcept -> unsigned int { return static_cast<int>( _edges.size() ); }
     /*! \brief Return the number of (parallel) directed edges between nodes \c source and \c destination.
-     *
-     * Graph edge_container_t should support multiple insertions (std::vector, std::list) to enable
-     * parrallel edge support, otherwise, get_edge_count() will always return 1 or 0.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Average complexity is O(1).
      */
     auto        get_edge_count(node_t* source, node_t* destination) const -> unsigned int;
 
@@ -268,6 +306,12 @@ public:
 private:
     edges_t         _edges;
     edges_search_t  _edges_search;
+    /*! \brief (source, destination) -> edge index, used for fast edge lookup between two nodes.
+     *
+     * \note Index is maintained by insert_edge() and remove_edge(), edge source and destination
+     * must not be modified once an edge has been inserted in graph.
+     */
+    edges_index_t   _edges_index;
     //@}
     //-------------------------------------------------------------------------
 
@@ -315,6 +359,156 @@ private:
     groups_t        _groups;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Graph Snapshot *///---------------------------------------------
+    //@{
+public:
+    using snapshot_t = gtpo::snapshot<node_t, edge_t>;
+
+    /*! \brief Build an immutable compressed sparse row (CSR) view of actual graph topology.
+     *
+     * Complexity is O(V + E), returned snapshot is not updated when graph topology is modified.
+     * \sa gtpo::snapshot
+     */
+    auto            snapshot() const -> snapshot_t { return snapshot_t{_nodes, _root_nodes}; }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Reachability Index *///-----------------------------------
+    //@{
+public:
+    using reachability_index_t = gtpo::reachability_index<node_t, edge_t>;
+
+    /*! \brief Enable or disable the incremental reachability index used by is_reachable() (default to false).
+     *
+     * When enabled, index is built in O(V + E) and then kept up to date by node and edge insertion / removal
+     * methods (see gtpo::reachability_index).
+     */
+    auto            set_reachability_indexed(bool indexed) -> void;
+    //! Return true if reachability queries are accelerated with a reachability index.
+    inline auto     is_reachability_indexed() const noexcept -> bool { return _reachability != nullptr; }
+
+    /*! \brief Return true if a directed path exists from \c source to \c destination (a node always reach itself).
+     *
+     * Near-constant time on large DAGs when reachability index is enabled, otherwise use an iterative DFS with
+     * graph traversal engine (see get_traversal(), must not be called from a get_traversal() traversal).
+     */
+    auto            is_reachable(const node_t* source, const node_t* destination) const -> bool;
+
+private:
+    std::unique_ptr<reachability_index_t>   _reachability;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Topological Order *///------------------------------------
+    //@{
+public:
+    using topological_order_t = gtpo::topological_order<node_t, edge_t>;
+
+    /*! \brief Enable or disable online maintenance of a topological order of graph nodes (default to false).
+     *
+     * When enabled, order is built in O(V + E) and then updated incrementally on edge insertion (only the
+     * affected region is reordered), see gtpo::topological_order.
+     */
+    auto            set_topologically_ordered(bool ordered) -> void;
+    //! Return true if a topological order is maintained for this graph.
+    inline auto     is_topologically_ordered() const noexcept -> bool { return _topological_order != nullptr; }
+
+    /*! \brief Return true if graph has no circuits.
+     *
+     * O(1) when topological ordering is enabled, otherwise circuits are detected on demand in O(V + E).
+     */
+    auto            is_acyclic() const -> bool;
+
+    /*! \brief Return graph nodes in topological order (for every edge (u, v), u is before v).
+     *
+     * \note Return an empty container if topological ordering is disabled or if graph has circuits.
+     */
+    auto            topological_nodes() const -> const std::vector<node_t*>&;
+
+    /*! \brief Return true if inserting an edge from \c source to \c destination would create a circuit.
+     *
+     * Cheap when topological ordering is enabled (O(1) when \c source is before \c destination in order),
+     * otherwise equivalent to is_reachable(destination, source).
+     */
+    auto            would_create_cycle(const node_t* source, const node_t* destination) const -> bool;
+
+private:
+    std::unique_ptr<topological_order_t>    _topological_order;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Traversal *///--------------------------------------------
+    //@{
+public:
+    using traversal_t = gtpo::traversal<node_t>;
+
+    /*! \brief Return this graph iterative DFS/BFS traversal engine (with reusable epoch visit marks and stacks).
+     *
+     * \warning Traversal engine is shared for all traversals of this graph and is not reentrant.
+     */
+    inline auto     get_traversal() const noexcept -> traversal_t& { return _traversal; }
+private:
+    mutable traversal_t     _traversal;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Topology Indexes *///-------------------------------------
+    //@{
+private:
+    //! Forward node insertion to enabled topology indexes (reachability, topological order).
+    auto            on_index_node_inserted(node_t* node) -> void;
+    auto            on_index_node_removed(node_t* node) noexcept -> void;
+    auto            on_index_edge_inserted(node_t* source, node_t* destination) -> void;
+    auto            on_index_edge_removed() noexcept -> void;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Slot Management *///--------------------------------------
+    //@{
+private:
+    /*! \brief Append \c item to \c container and store its index in \c item \c slot member.
+     *
+     * \note \c slot is a pointer on an int member of \c item (for example &node_t::_nodes_slot).
+     */
+    template <class container_t, class item_t, class slot_t>
+    static auto     insert_slot(container_t& container, item_t* item, slot_t slot) -> void;
+
+    //! Append all \c items to \c container with a single container insertion, and store their index in \c slot member.
+    template <class container_t, class item_t, class slot_t>
+    static auto     insert_slots(container_t& container, const std::vector<item_t*>& items, slot_t slot) -> void;
+
+    /*! \brief Remove \c item from \c container in O(1) using \c item \c slot index.
+     *
+     * Container last item is moved to \c item index (and its slot updated): \c container order is not preserved.
+     * \return false if \c item is not registered in \c container.
+     */
+    template <class container_t, class item_t, class slot_t>
+    static auto     remove_slot(container_t& container, item_t* item, slot_t slot) -> bool;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Notification Batch Management *///-------------------------
+    //@{
+public:
+    /*! \brief Open a notification batch on \c node until graph outermost batch is closed.
+     *
+     * Called by gtpo::node<> when a node with observers has its topology modified while graph
+     * is in a batch (see observable_graph::begin_batch()), node batch aware observers then get a single
+     * on_batch() notification when graph batch is closed.
+     * \note Should not be called directly.
+     */
+    auto            batch_node(node_t& node) -> void;
+
+protected:
+    //! Close nodes batches opened with batch_node(), node observers are notified before graph observers.
+    virtual void    on_end_batch() noexcept override;
+
+private:
+    //! Nodes with an open notification batch, nodes removed from graph are removed from batched nodes.
+    gtpo::changeset_items<node_t>   _batched_nodes;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::gtpo
@@ -62,6 +62,12 @@ template <class graph_base_t,
 void    graph<graph_base_t, node_t,
               group_t, edge_t>::clear() noexcept
 {
+    // Clear topology indexes first, topological order reset nodes order
+    if (_reachability)
+        _reachability->clear();
+    if (_topological_order)
+        _topological_order->clear();
+
     // Note 20220424: First clear nodes/edges container, then delete
     // their content since destroyed() signal from contained items might
     // be catched trigerring uses of _nodes/_edges with already deleted content
@@ -77,6 +83,7 @@ void    graph<graph_base_t, node_t,
     edges_t edges;
     std::copy(_edges.begin(), _edges.end(), std::back_inserter(edges));
     _edges_search.clear();
+    _edges_index.clear();
     _edges.clear();
     for (const auto edge: edges) {
         edge->_graph = nullptr;
@@ -85,6 +92,7 @@ void    graph<graph_base_t, node_t,
 
     // Clearing groups and behaviours (Not: group->_graph is resetted with nodes)
     _groups.clear();
+    _batched_nodes.clear();
 
     observable_base_t::clear();
 }
@@ -123,9 +131,10 @@ auto    graph<graph_base_t, node_t,
     }
     try {
         node->set_graph(this);
-        container_adapter<nodes_t>::insert(node, _nodes);
+        insert_slot(_nodes, node, &node_t::_nodes_slot);
         container_adapter<nodes_search_t>::insert(node, _nodes_search);
-        container_adapter<nodes_t>::insert(node, _root_nodes);
+        insert_slot(_root_nodes, node, &node_t::_root_nodes_slot);
+        on_index_node_inserted(node);
 
         observable_base_t::notify_node_inserted(*node);
     } catch (...) {
@@ -135,6 +144,46 @@ auto    graph<graph_base_t, node_t,
     return true;
 }
 
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::insert_nodes(const std::vector<node_t*>& nodes) -> std::size_t
+{
+    if (nodes.empty())
+        return 0;
+    std::vector<node_t*> inserted_nodes;
+    inserted_nodes.reserve(nodes.size());
+    gtpo::scoped_batch<observable_base_t> batch{*this};
+    try {
+        container_adapter<nodes_search_t>::reserve(_nodes_search, _nodes_search.size() + nodes.size());
+        for (const auto node : nodes) {
+            if (node == nullptr)
+                continue;
+            // Do not insert an already inserted node (nor a node appearing twice in nodes)
+            if (container_adapter<nodes_search_t>::contains(_nodes_search, node)) {
+                std::cerr << "gtpo::graph<>::insert_nodes(): Error: node has already been inserted in graph." << std::endl;
+                continue;
+            }
+            node->set_graph(this);
+            container_adapter<nodes_search_t>::insert(node, _nodes_search);
+            inserted_nodes.push_back(node);
+        }
+        insert_slots(_nodes, inserted_nodes, &node_t::_nodes_slot);
+        insert_slots(_root_nodes, inserted_nodes, &node_t::_root_nodes_slot);
+        for (const auto node : inserted_nodes)
+            on_index_node_inserted(node);
+
+        for (const auto node : inserted_nodes)
+            observable_base_t::notify_node_inserted(*node);
+    } catch (...) {
+        std::cerr << "gtpo::graph<>::insert_nodes(): Error: can't insert nodes in graph." << std::endl;
+        return 0;
+    }
+    return inserted_nodes.size();
+}
+
 template <class graph_base_t,
           class node_t,
           class group_t,
@@ -170,10 +219,12 @@ auto    graph<graph_base_t, node_t,
         remove_edge(outEdge);
 
     // Remove node from main graph containers (it will generate node destruction)
+    _batched_nodes.remove(node);
+    on_index_node_removed(node);
     container_adapter<nodes_search_t>::remove(node, _nodes_search);
-    container_adapter<nodes_t>::remove(node, _root_nodes);
+    remove_slot(_root_nodes, node, &node_t::_root_nodes_slot);
     node->set_graph(nullptr);
-    container_adapter<nodes_t>::remove(node, _nodes);
+    remove_slot(_nodes, node, &node_t::_nodes_slot);
     delete node;
     return true;
 }
@@ -192,7 +243,9 @@ auto    graph<graph_base_t, node_t,
                      "0 in degree as a root node." << std::endl;
         return;
     }
-    container_adapter<nodes_t>::insert(node, _root_nodes);
+    if (node->_root_nodes_slot >= 0)    // Node is already a root node
+        return;
+    insert_slot(_root_nodes, node, &node_t::_root_nodes_slot);
 }
 
 template <class graph_base_t,
@@ -206,7 +259,8 @@ auto    graph<graph_base_t, node_t,
         return false;
     if (node->get_in_degree() != 0)   // Fast exit when node in degree != 0, it can't be a root node
         return false;
-    return _root_nodes.contains(const_cast<node_t*>(node));
+    return node->_root_nodes_slot >= 0 &&
+           _root_nodes.at(node->_root_nodes_slot) == node;
 }
 
 template <class graph_base_t,
@@ -242,16 +296,18 @@ auto    graph<graph_base_t, node_t,
         edge = std::make_unique<edge_t>();
         edge->set_graph(this);
 
-        container_adapter<edges_t>::insert(edge.get(), _edges);
+        insert_slot(_edges, edge.get(), &edge_t::_edges_slot);
         container_adapter<edges_search_t>::insert(edge.get(), _edges_search);
         edge->set_src(source);
         edge->set_dst(destination);
+        _edges_index.insert(std::make_pair(source, destination), edge.get());
 
         source->add_out_edge(edge.get());
         destination->add_in_edge(edge.get());
 
         if (source != destination ) // If edge define is a trivial circuit, do not remove destination from root nodes
-            container_adapter<nodes_t>::remove(destination, _root_nodes);    // Otherwise destination is no longer a root node
+            remove_slot(_root_nodes, destination, &node_t::_root_nodes_slot);    // Otherwise destination is no longer a root node
+        on_index_edge_inserted(source, destination);
 
         observable_base_t::notify_edge_inserted(*edge);
     } catch ( ... ) {
@@ -278,16 +334,17 @@ auto    graph<graph_base_t, node_t,
         return false;
     }
     edge->set_graph(this);
-    container_adapter<edges_t>::insert(edge, _edges);
+    insert_slot(_edges, edge, &edge_t::_edges_slot);
     container_adapter<edges_search_t>::insert(edge, _edges_search);
     try {
-        source->add_out_edge(edge);
         auto destination = edge->get_dst();
-        if (destination != nullptr) {
-            destination->add_in_edge(edge);
-            if (source != destination) // If edge define is a trivial circuit, do not remove destination from root nodes
-                container_adapter<nodes_t>::remove(destination, _root_nodes);    // Otherwise destination is no longer a root node
-        }
+        source->add_out_edge(edge);
+        destination->add_in_edge(edge);
+        // Index (source, destination) only once edge has been successfully inserted in topology
+        _edges_index.insert(std::make_pair(source, destination), edge);
+        if (source != destination) // If edge define is a trivial circuit, do not remove destination from root nodes
+            remove_slot(_root_nodes, destination, &node_t::_root_nodes_slot);    // Otherwise destination is no longer a root node
+        on_index_edge_inserted(source, destination);
         observable_base_t::notify_edge_inserted(*edge);
     } catch ( ... ) {
         std::cerr << "gtpo::graph<>::create_edge(): Insertion of edge failed, source or "
@@ -297,6 +354,122 @@ auto    graph<graph_base_t, node_t,
     return true;
 }
 
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::insert_edges(const std::vector<std::pair<node_t*, node_t*>>& edges) -> std::vector<edge_t*>
+{
+    std::vector<edge_t*> created_edges;
+    created_edges.reserve(edges.size());
+    try {
+        for (const auto& source_destination : edges) {
+            if (source_destination.first == nullptr ||
+                source_destination.second == nullptr) {
+                std::cerr << "gtpo::graph<>::insert_edges(): Warning: Ignoring edge with a nullptr source "
+                             "or destination." << std::endl;
+                continue;
+            }
+            auto edge = std::make_unique<edge_t>();
+            edge->set_src(source_destination.first);
+            edge->set_dst(source_destination.second);
+            created_edges.push_back(edge.release());
+        }
+    } catch (...) {
+        std::cerr << "gtpo::graph<>::insert_edges(): Error: can't create edges." << std::endl;
+        for (auto edge : created_edges)
+            delete edge;
+        return {};
+    }
+    if (insert_edges(created_edges) < created_edges.size()) {
+        // Free edges that have not been inserted (they are not owned by graph), return only inserted edges
+        const auto not_inserted = std::remove_if(created_edges.begin(), created_edges.end(),
+                                                 [this](edge_t* edge) {
+                                                     if (container_adapter<edges_search_t>::contains(_edges_search, edge))
+                                                         return false;
+                                                     delete edge;
+                                                     return true;
+                                                 });
+        created_edges.erase(not_inserted, created_edges.end());
+    }
+    return created_edges;
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::insert_edges(const std::vector<edge_t*>& edges) -> std::size_t
+{
+    if (edges.empty())
+        return 0;
+    std::vector<edge_t*> inserted_edges;
+    inserted_edges.reserve(edges.size());
+    gtpo::scoped_batch<observable_base_t> batch{*this};
+    std::size_t linked = 0;     // Number of inserted_edges whose source and destination topology has been modified
+    int         linking = 0;    // Topology modifications already applied to inserted_edges[linked]
+    try {
+        container_adapter<edges_search_t>::reserve(_edges_search, _edges_search.size() + edges.size());
+        _edges_index.reserve(_edges_index.size() + static_cast<int>(edges.size()));
+        for (const auto edge : edges) {
+            if (edge == nullptr)
+                continue;
+            if (edge->get_src() == nullptr ||
+                edge->get_dst() == nullptr) {
+                std::cerr << "gtpo::graph<>::insert_edges(): Error: Either source and/or "
+                             "destination nodes are nullptr." << std::endl;
+                continue;
+            }
+            if (container_adapter<edges_search_t>::contains(_edges_search, edge))
+                continue;
+            edge->set_graph(this);
+            container_adapter<edges_search_t>::insert(edge, _edges_search);
+            inserted_edges.push_back(edge);
+        }
+        insert_slots(_edges, inserted_edges, &edge_t::_edges_slot);
+
+        for (; linked < inserted_edges.size(); ++linked) {
+            const auto edge = inserted_edges[linked];
+            auto source = edge->get_src();
+            auto destination = edge->get_dst();
+            linking = 0;
+            source->add_out_edge(edge);
+            linking = 1;
+            destination->add_in_edge(edge);
+            linking = 2;
+            _edges_index.insert(std::make_pair(source, destination), edge);
+            linking = 3;
+            if (source != destination) // If edge define is a trivial circuit, do not remove destination from root nodes
+                remove_slot(_root_nodes, destination, &node_t::_root_nodes_slot);    // Otherwise destination is no longer a root node
+            on_index_edge_inserted(source, destination);
+            observable_base_t::notify_edge_inserted(*edge);
+        }
+    } catch (...) {
+        std::cerr << "gtpo::graph<>::insert_edges(): Insertion of edges failed, source or "
+                     "destination nodes topology can't be modified." << std::endl;
+        // Rollback edges that have not been linked: they must be in neither _edges nor _edges_search
+        if (linked < inserted_edges.size()) {
+            const auto edge = inserted_edges[linked];
+            if (linking >= 3)
+                _edges_index.remove(std::make_pair(edge->get_src(), edge->get_dst()), edge);
+            if (linking >= 2)
+                edge->get_dst()->remove_in_edge(edge);
+            if (linking >= 1)
+                edge->get_src()->remove_out_edge(edge);
+        }
+        for (auto e = linked; e < inserted_edges.size(); ++e) {
+            const auto edge = inserted_edges[e];
+            remove_slot(_edges, edge, &edge_t::_edges_slot);    // Nil if slots have not been inserted
+            container_adapter<edges_search_t>::remove(edge, _edges_search);
+            edge->set_graph(nullptr);
+        }
+        return linked;
+    }
+    return inserted_edges.size();
+}
+
 template <class graph_base_t,
           class node_t,
           class group_t,
@@ -308,16 +481,8 @@ auto    graph<graph_base_t, node_t,
         destination == nullptr)
         return false;
 
-    // Find the edge associed with source / destination
-    if (_edges.size() == 0)
-        return false; // Fast exit
-    auto edgeIter = std::find_if(_edges.begin(), _edges.end(),
-                                 [=](const edge_t* e ) {
-                                    return (e->get_src() == source &&
-                                            e->get_dst() == destination);
-                                    }
-                                 ); // std::find_if
-    return edgeIter != _edges.end() ? remove_edge(*edgeIter) : false;
+    auto edge = find_edge(source, destination);
+    return edge != nullptr ? remove_edge(edge) : false;
 }
 
 template <class graph_base_t,
@@ -331,12 +496,10 @@ auto    graph<graph_base_t, node_t,
         destination == nullptr)
         return false;
 
-    auto limit = _edges.size();
-    while (get_edge_count(source, destination) > 0 &&
-           limit >= 0) {
-        remove_edge(source, destination);
-        limit--;
-    }
+    // Copy parallel edges first, remove_edge() modify the index
+    const auto edges = _edges_index.values(std::make_pair(source, destination));
+    for (auto edge : edges)
+        remove_edge(edge);
     return true;
 }
 
@@ -362,7 +525,9 @@ auto    graph<graph_base_t, node_t,
     destination->remove_in_edge(edge);
 
     edge->set_graph(nullptr);
-    container_adapter<edges_t>::remove(edge, _edges);
+    _edges_index.remove(std::make_pair(source, destination), edge);
+    on_index_edge_removed();
+    remove_slot(_edges, edge, &edge_t::_edges_slot);
     container_adapter<edges_search_t>::remove(edge, _edges_search);
     delete edge;
     return true;
@@ -375,13 +540,13 @@ template <class graph_base_t,
 auto    graph<graph_base_t, node_t,
               group_t, edge_t>::find_edge(const node_t* source, const node_t* destination) const -> edge_t*
 {
-    // Find the edge associed with source / destination
-    auto edgeIter = std::find_if(_edges.begin(), _edges.end(),
-                                 [=](const edge_t* e ) noexcept {
-                                    return ((e->get_src() == source) &&
-                                            (e->get_dst() == destination));
-                                } );
-    return (edgeIter != _edges.end() ? *edgeIter : nullptr);
+    // Parallel edges are stored from most recently to least recently inserted in
+    // the index, return the last one to return the first inserted edge.
+    edge_t* edge = nullptr;
+    const auto range = _edges_index.equal_range(std::make_pair(source, destination));
+    for (auto edgeIter = range.first; edgeIter != range.second; ++edgeIter)
+        edge = *edgeIter;
+    return edge;
 }
 
 template <class graph_base_t,
@@ -391,7 +556,7 @@ template <class graph_base_t,
 auto    graph<graph_base_t, node_t,
               group_t, edge_t>::has_edge(const node_t* source, const node_t* destination) const -> bool
 {
-    return (find_edge(source, destination) != nullptr);
+    return _edges_index.contains(std::make_pair(source, destination));
 }
 
 template <class graph_base_t,
@@ -401,13 +566,7 @@ template <class graph_base_t,
 auto    graph<graph_base_t, node_t,
               group_t, edge_t>::get_edge_count(node_t* source, node_t* destination ) const -> unsigned int
 {
-    unsigned int edgeCount = 0;
-    std::for_each(_edges.begin(), _edges.end(), [&](const edge_t* e ) {
-                                                       if ((e->get_src() == source) &&
-                                                           (e->get_dst() == destination))
-                                                           ++edgeCount;
-                                                   } );
-    return edgeCount;
+    return static_cast<unsigned int>(_edges_index.count(std::make_pair(source, destination)));
 }
 
 template <class graph_base_t,
@@ -419,9 +578,7 @@ auto    graph<graph_base_t, node_t,
 {
     if (edge == nullptr)   // Fast exit.
         return false;
-    auto edgeIter = std::find_if(_edges_search.cbegin(), _edges_search.cend(),
-                                 [=](const edge_t* other_edge) { return (other_edge == edge); } );
-    return edgeIter != _edges_search.cend();
+    return _edges_search.contains(edge);
 }
 //-----------------------------------------------------------------------------
 
@@ -512,5 +669,279 @@ auto    graph<graph_base_t, node_t,
 }
 //-----------------------------------------------------------------------------
 
-} // ::gtpo
+/* Graph Slot Management *///--------------------------------------------------
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+template <class container_t, class item_t, class slot_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::insert_slot(container_t& container, item_t* item, slot_t slot) -> void
+{
+    if (item == nullptr)
+        return;
+    item->*slot = static_cast<int>(container.size());
+    container.append(item);
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+template <class container_t, class item_t, class slot_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::insert_slots(container_t& container, const std::vector<item_t*>& items, slot_t slot) -> void
+{
+    auto index = static_cast<int>(container.size());
+    for (const auto item : items)
+        if (item != nullptr)
+            item->*slot = index++;
+    container.append(items.cbegin(), items.cend());
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+template <class container_t, class item_t, class slot_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::remove_slot(container_t& container, item_t* item, slot_t slot) -> bool
+{
+    if (item == nullptr)
+        return false;
+    const int index = item->*slot;
+    if (index < 0 ||
+        index >= static_cast<int>(container.size()) ||
+        container.at(index) != item)
+        return false;
+    auto moved = container.swapAndPop(index);
+    if (moved != nullptr)
+        moved->*slot = index;
+    item->*slot = -1;
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Reachability Index *///-----------------------------------------------
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::set_reachability_indexed(bool indexed) -> void
+{
+    if (!indexed) {
+        _reachability.reset();
+        return;
+    }
+    if (_reachability)
+        return;
+    try {
+        _reachability = std::make_unique<reachability_index_t>();
+        _reachability->rebuild(_nodes, _root_nodes);
+    } catch (...) {
+        std::cerr << "gtpo::graph<>::set_reachability_indexed(): Error: can't build reachability index." << std::endl;
+        _reachability.reset();
+    }
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::is_reachable(const node_t* source, const node_t* destination) const -> bool
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return false;
+    if (_reachability) {
+        if (_reachability->is_stale())      // Incremental updates have loosen labels, rebuild
+            _reachability->rebuild(_nodes, _root_nodes);
+        return _reachability->is_reachable(source, destination);
+    }
+    if (source == destination)
+        return true;
+    // Epoch traversal: no marks set allocated, traversal stacks are reused between queries
+    _traversal.begin();
+    return !_traversal.dfs(source,
+                           [](const node_t& node, const auto& emit) {
+                               for (const auto out_node : node.get_out_nodes())
+                                   emit(out_node);
+                           },
+                           [destination](const node_t& node) { return &node != destination; });
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Topological Order *///------------------------------------------------
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::set_topologically_ordered(bool ordered) -> void
+{
+    if (!ordered) {
+        if (_topological_order)
+            _topological_order->clear();
+        _topological_order.reset();
+        return;
+    }
+    if (_topological_order)
+        return;
+    try {
+        _topological_order = std::make_unique<topological_order_t>();
+        _topological_order->rebuild(_nodes, _root_nodes);
+    } catch (...) {
+        std::cerr << "gtpo::graph<>::set_topologically_ordered(): Error: can't build topological order." << std::endl;
+        _topological_order.reset();
+    }
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::is_acyclic() const -> bool
+{
+    if (_topological_order) {
+        if (_topological_order->is_stale())
+            _topological_order->rebuild(_nodes, _root_nodes);
+        return _topological_order->is_acyclic();
+    }
+    // Topological order is not maintained: run Kahn algorithm on a graph snapshot, graph is acyclic
+    // if all nodes are eventually dequeued (nodes in circuits never reach a zero in degree)
+    using node_id = typename snapshot_t::node_id;
+    const auto graph_snapshot = snapshot();
+    const auto node_count = graph_snapshot.get_node_count();
+    std::vector<std::size_t> in_degrees(node_count, 0);
+    std::vector<node_id> queue;
+    queue.reserve(node_count);
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id) {
+        in_degrees[id] = graph_snapshot.get_in_degree(id);
+        if (in_degrees[id] == 0)
+            queue.push_back(id);
+    }
+    for (std::size_t q = 0; q < queue.size(); ++q)
+        for (const auto out_id : graph_snapshot.get_out_nodes(queue[q]))
+            if (--in_degrees[out_id] == 0)
+                queue.push_back(out_id);
+    return queue.size() == node_count;
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::topological_nodes() const -> const std::vector<node_t*>&
+{
+    static const std::vector<node_t*> empty_nodes;
+    if (!_topological_order ||
+        !is_acyclic())
+        return empty_nodes;
+    return _topological_order->get_nodes();
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::would_create_cycle(const node_t* source, const node_t* destination) const -> bool
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return false;
+    if (_topological_order) {
+        if (_topological_order->is_stale())
+            _topological_order->rebuild(_nodes, _root_nodes);
+        return _topological_order->would_create_cycle(source, destination);
+    }
+    return is_reachable(destination, source);
+}
+//-----------------------------------------------------------------------------
 
+/* Graph Topology Indexes *///-------------------------------------------------
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::on_index_node_inserted(node_t* node) -> void
+{
+    if (_reachability)
+        _reachability->on_node_inserted(node);
+    if (_topological_order)
+        _topological_order->on_node_inserted(node);
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::on_index_node_removed(node_t* node) noexcept -> void
+{
+    if (_reachability)
+        _reachability->on_node_removed(node);
+    if (_topological_order)
+        _topological_order->on_node_removed(node);
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::on_index_edge_inserted(node_t* source, node_t* destination) -> void
+{
+    if (_reachability)
+        _reachability->on_edge_inserted(source, destination);
+    if (_topological_order)
+        _topological_order->on_edge_inserted(source, destination);
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::on_index_edge_removed() noexcept -> void
+{
+    if (_reachability)
+        _reachability->on_edge_removed();
+    if (_topological_order)
+        _topological_order->on_edge_removed();
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Notification Batch Management *///----------------------------------
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+auto    graph<graph_base_t, node_t,
+              group_t, edge_t>::batch_node(node_t& node) -> void
+{
+    if (!observable_base_t::in_batch() ||
+        _batched_nodes.contains(&node))
+        return;
+    _batched_nodes.insert(&node);
+    node.begin_batch();
+}
+
+template <class graph_base_t,
+          class node_t,
+          class group_t,
+          class edge_t>
+void    graph<graph_base_t, node_t,
+              group_t, edge_t>::on_end_batch() noexcept
+{
+    for (const auto node : _batched_nodes.take())
+        node->end_batch();
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
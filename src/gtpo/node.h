@@ -37,6 +37,7 @@
 // STD headers
 #include <unordered_set>
 #include <cassert>
+#include <cstdint>          // std::uint64_t
 #include <iterator>         // std::back_inserter
 
 // GTpo headers
@@ -125,6 +126,18 @@ public:
      */
     auto    remove_in_edge(const edge_t* inEdge) -> bool;
 
+private:
+    //! Open a notification batch on this node when its graph has an open batch (see gtpo::graph::batch_node()).
+    inline auto join_graph_batch() noexcept -> void {
+        if (!this->hasObservers())
+            return;
+        graph_t* graph = this->get_graph();
+        if (graph != nullptr &&
+            graph->in_batch())
+            graph->batch_node(*reinterpret_cast<node_t*>(this));
+    }
+
+public:
     inline auto get_in_edges() const noexcept -> const edges_t& { return _in_edges; }
     inline auto get_out_edges() const noexcept -> const edges_t& { return _out_edges; }
 
@@ -178,6 +191,23 @@ private:
     nodes_t     _nodes;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Graph Slot Management *///--------------------------------------
+    //@{
+public:
+    /*! \brief Index of this node in its graph nodes container (-1 when node is not inserted in a graph).
+     *
+     * \note Maintained by gtpo::graph<> to remove nodes in O(1), should not be modified by user code.
+     */
+    int         _nodes_slot = -1;
+    //! Index of this node in its graph root nodes container (-1 when node is not a root node).
+    int         _root_nodes_slot = -1;
+    //! Position of this node in graph topological order (-1 when topological ordering is disabled, see gtpo::topological_order).
+    int         _topological_order = -1;
+    //! Epoch of the last gtpo::traversal that visited this node (see gtpo::traversal).
+    mutable std::uint64_t   _visit_epoch = 0;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::gtpo
@@ -55,6 +55,7 @@ auto node<node_base_t,
     container_adapter<edges_t>::insert(outEdge, _out_edges);
     if (outEdge->get_dst() != nullptr) {
         container_adapter<nodes_t>::insert(outEdge->get_dst(), _out_nodes);
+        join_graph_batch();
         observable_base_t::notify_out_node_inserted(*reinterpret_cast<node_t*>(this),
                                                     *outEdge->get_dst(), *outEdge);
         return true;
@@ -82,6 +83,7 @@ auto node<node_base_t,
     container_adapter<edges_t>::insert(in_edge, _in_edges);
     if (in_edge->get_src() != nullptr) {
         container_adapter<nodes_t>::insert(in_edge->get_src(), _in_nodes);
+        join_graph_batch();
         observable_base_t::notify_in_node_inserted(*reinterpret_cast<node_t*>(this),
                                                    *in_edge->get_src(), *in_edge);
     }
@@ -108,6 +110,7 @@ auto node<node_base_t,
 
     auto outEdgeDst = outEdge->get_dst();
     if (outEdgeDst != nullptr) {
+        join_graph_batch();
         observable_base_t::notify_out_node_removed(*reinterpret_cast<node_t*>(this),
                                                    *const_cast<node_t*>(outEdge->get_dst()), *outEdge);
     }
@@ -148,6 +151,7 @@ auto node<node_base_t,
         std::cerr << "gtpo::node<>::remove_in_edge(): Error: In edge source is expired." << std::endl;
         return false;
     }
+    join_graph_batch();
     observable_base_t::notify_in_node_removed(*reinterpret_cast<node_t*>(this),
                                               *const_cast<node_t*>(inEdge->get_src()), *inEdge);
     container_adapter<edges_t>::remove(const_cast<edge_t*>(inEdge), _in_edges);
@@ -41,9 +41,130 @@
 #include <vector>
 #include <memory>
 #include <utility>          // c++14 std::index_sequence
+#include <unordered_map>
 
 namespace gtpo { // ::gtpo
 
+/*! \brief Ordered set of topology primitives used to coalesce notifications while a batch is open.
+ *
+ * Insertion order is preserved, insertion and removal are O(1).
+ */
+template <class T>
+class changeset_items
+{
+public:
+    //! Insert \c item (ignored if \c item is already registered).
+    auto    insert(T* item) -> void {
+        if (item != nullptr &&
+            _index.emplace(item, _items.size()).second)
+            _items.push_back(item);
+    }
+    //! Remove \c item, return false if \c item was not registered.
+    auto    remove(T* item) -> bool {
+        const auto itemIter = _index.find(item);
+        if (itemIter == _index.end())
+            return false;
+        _items[itemIter->second] = nullptr;     // Tombstone, compacted in take()
+        _index.erase(itemIter);
+        return true;
+    }
+    auto    contains(T* item) const -> bool { return _index.find(item) != _index.end(); }
+    auto    empty() const noexcept -> bool { return _index.empty(); }
+    //! Return registered items in insertion order and clear this set.
+    auto    take() -> std::vector<T*> {
+        std::vector<T*> items;
+        items.reserve(_index.size());
+        for (const auto item : _items)
+            if (item != nullptr)
+                items.push_back(item);
+        clear();
+        return items;
+    }
+    auto    clear() noexcept -> void { _items.clear(); _index.clear(); }
+private:
+    std::vector<T*>                     _items;
+    std::unordered_map<T*, std::size_t> _index;
+};
+
+/*! \brief Record inserted and removed primitives during a batch: an insertion followed by a removal of
+ * the same primitive in the same batch cancel each other.
+ */
+template <class T>
+struct changeset_recorder {
+    changeset_items<T>  inserted;
+    changeset_items<T>  removed;
+
+    auto    record_inserted(T* item) -> void { inserted.insert(item); }
+    auto    record_removed(T* item) -> void {
+        if (!inserted.remove(item))     // Inserted then removed in the same batch: forget it
+            removed.insert(item);
+    }
+    auto    empty() const noexcept -> bool { return inserted.empty() && removed.empty(); }
+    auto    clear() noexcept -> void { inserted.clear(); removed.clear(); }
+};
+
+/*! \brief Coalesced topology changes delivered to batch aware node observers when a node batch is closed.
+ *
+ * \warning Pointers in \c removed_* containers are only identities, removed edges are usually already
+ * destroyed when the changeset is delivered and must not be dereferenced.
+ */
+template <class edge_t>
+struct node_changeset {
+    std::vector<const edge_t*>  inserted_in_edges;
+    std::vector<const edge_t*>  removed_in_edges;
+    std::vector<const edge_t*>  inserted_out_edges;
+    std::vector<const edge_t*>  removed_out_edges;
+
+    auto    empty() const noexcept -> bool {
+        return inserted_in_edges.empty() && removed_in_edges.empty() &&
+               inserted_out_edges.empty() && removed_out_edges.empty();
+    }
+};
+
+/*! \brief Coalesced topology changes delivered to batch aware graph observers when a graph batch is closed.
+ *
+ * \note Removals should be applied before insertions: the address of a primitive destroyed in a batch might
+ * be reused by a primitive inserted later in the same batch.
+ * \warning Pointers in \c removed_* containers are only identities, removed primitives are already
+ * destroyed when the changeset is delivered and must not be dereferenced.
+ */
+template <class node_t, class edge_t, class group_t>
+struct graph_changeset {
+    std::vector<node_t*>    inserted_nodes;
+    std::vector<node_t*>    removed_nodes;
+    std::vector<edge_t*>    inserted_edges;
+    std::vector<edge_t*>    removed_edges;
+    std::vector<group_t*>   inserted_groups;
+    std::vector<group_t*>   removed_groups;
+
+    auto    empty() const noexcept -> bool {
+        return inserted_nodes.empty() && removed_nodes.empty() &&
+               inserted_edges.empty() && removed_edges.empty() &&
+               inserted_groups.empty() && removed_groups.empty();
+    }
+};
+
+/*! \brief Open a notification batch on \c observable_t for the lifetime of this object (RAII wrapper for begin_batch() / end_batch()).
+ *
+ * \code
+ * {
+ *   gtpo::scoped_batch<qan::Graph> batch{graph};
+ *   // Insert / remove nodes and edges, batch aware observers are notified once when batch is destroyed.
+ * }
+ * \endcode
+ */
+template <class observable_t>
+class scoped_batch
+{
+public:
+    explicit scoped_batch(observable_t& observable) noexcept : _observable{observable} { _observable.begin_batch(); }
+    ~scoped_batch() noexcept { _observable.end_batch(); }
+    scoped_batch(const scoped_batch&) = delete;
+    scoped_batch& operator=(const scoped_batch&) = delete;
+private:
+    observable_t&   _observable;
+};
+
 /*! \brief Empty interface definition for graph primitives supporting observable concept.
  */
 class abstract_observable {
@@ -145,39 +266,112 @@ public:
 
     auto    notify_in_node_inserted(node_t& target, node_t& node, const edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_in_node_inserted(target, node, edge);
+        if (in_batch()) {
+            _batch_target = &target;
+            _in_edges.record_inserted(&edge);
+        }
     }
 
     auto    notify_in_node_removed(node_t& target, node_t& node, const edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_in_node_removed(target, node, edge);
+        if (in_batch()) {
+            _batch_target = &target;
+            _in_edges.record_removed(&edge);
+        }
     }
 
     auto    notify_in_node_removed(node_t& target) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_in_node_removed(target);
     }
 
     auto    notify_out_node_inserted(node_t& target, node_t& node, const edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_out_node_inserted(target, node, edge);
+        if (in_batch()) {
+            _batch_target = &target;
+            _out_edges.record_inserted(&edge);
+        }
     }
 
     auto    notify_out_node_removed(node_t& target, node_t& node, const edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_out_node_removed(target, node, edge);
+        if (in_batch()) {
+            _batch_target = &target;
+            _out_edges.record_removed(&edge);
+        }
     }
 
     auto    notify_out_node_removed(node_t& target) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_out_node_removed(target);
     }
+
+private:
+    //! Batch aware observers are not notified synchronously while a batch is open.
+    inline auto is_notified(const std::unique_ptr<node_observer_t>& observer) const noexcept -> bool {
+        return observer && (!in_batch() || !observer->is_batch_aware());
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Notification Batch Management *///-------------------------------
+    //@{
+public:
+    using node_changeset_t = gtpo::node_changeset<edge_t>;
+
+    /*! \brief Open a notification batch (batches could be nested, only the outermost end_batch() call flush notifications).
+     *
+     * While a batch is open, batch aware observers (see gtpo::observer::is_batch_aware()) are no longer notified
+     * synchronously, topology changes are coalesced and delivered with a single on_batch() call when the
+     * batch is closed. Other observers are still notified synchronously.
+     */
+    auto    begin_batch() noexcept -> void { ++_batch_depth; }
+
+    //! Close a batch opened with begin_batch(), notify batch aware observers when the outermost batch is closed.
+    auto    end_batch() noexcept -> void {
+        if (_batch_depth == 0)
+            return;
+        if (--_batch_depth == 0)
+            flush_batch();
+    }
+
+    //! Return true if a notification batch is currently open.
+    inline auto in_batch() const noexcept -> bool { return _batch_depth > 0; }
+
+private:
+    auto    flush_batch() noexcept -> void {
+        if (_batch_target == nullptr ||
+            (_in_edges.empty() && _out_edges.empty()))
+            return;
+        node_changeset_t changeset;
+        changeset.inserted_in_edges = _in_edges.inserted.take();
+        changeset.removed_in_edges = _in_edges.removed.take();
+        changeset.inserted_out_edges = _out_edges.inserted.take();
+        changeset.removed_out_edges = _out_edges.removed.take();
+        auto target = _batch_target;
+        _batch_target = nullptr;
+        if (changeset.empty())
+            return;
+        for (auto& observer: super_t::_observers)
+            if (observer &&
+                observer->is_batch_aware())
+                observer->on_batch(*target, changeset);
+    }
+
+    std::size_t                         _batch_depth = 0;
+    node_t*                             _batch_target = nullptr;
+    changeset_recorder<const edge_t>    _in_edges;
+    changeset_recorder<const edge_t>    _out_edges;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -214,41 +408,116 @@ public:
 
     auto    notify_node_inserted(node_t& node) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_node_inserted(node);
+        if (in_batch())
+            _nodes.record_inserted(&node);
     }
 
     auto    notify_node_removed(node_t& node) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_node_removed(node);
+        if (in_batch())
+            _nodes.record_removed(&node);
     }
 
     auto    notify_edge_inserted(edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_edge_inserted(edge);
+        if (in_batch())
+            _edges.record_inserted(&edge);
     }
 
     auto    notify_edge_removed(edge_t& edge) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_edge_removed(edge);
+        if (in_batch())
+            _edges.record_removed(&edge);
     }
 
     auto    notify_group_inserted(group_t& group) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_group_inserted(group);
+        if (in_batch())
+            _groups.record_inserted(&group);
     }
 
     auto    notify_group_removed(group_t& group) noexcept -> void {
         for (auto& observer: super_t::_observers)
-            if (observer)
+            if (is_notified(observer))
                 observer->on_group_removed(group);
+        if (in_batch())
+            _groups.record_removed(&group);
+    }
+
+private:
+    //! Batch aware observers are not notified synchronously while a batch is open.
+    inline auto is_notified(const std::unique_ptr<graph_observer_t>& observer) const noexcept -> bool {
+        return observer && (!in_batch() || !observer->is_batch_aware());
     }
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Notification Batch Management *///-------------------------------
+    //@{
+public:
+    using graph_changeset_t = gtpo::graph_changeset<node_t, edge_t, group_t>;
+
+    /*! \brief Open a notification batch (batches could be nested, only the outermost end_batch() call flush notifications).
+     *
+     * While a batch is open, batch aware observers (see gtpo::observer::is_batch_aware()) are no longer notified
+     * synchronously, topology changes are coalesced and delivered with a single on_batch() call when the
+     * batch is closed. Other observers are still notified synchronously.
+     * \sa gtpo::scoped_batch
+     */
+    auto    begin_batch() noexcept -> void { ++_batch_depth; }
+
+    //! Close a batch opened with begin_batch(), notify batch aware observers when the outermost batch is closed.
+    auto    end_batch() noexcept -> void {
+        if (_batch_depth == 0)
+            return;
+        if (--_batch_depth == 0) {
+            on_end_batch();
+            flush_batch();
+        }
+    }
+
+    //! Return true if a notification batch is currently open.
+    inline auto in_batch() const noexcept -> bool { return _batch_depth > 0; }
+
+protected:
+    //! Called when the outermost batch is closed, just before batch aware graph observers are notified.
+    virtual void    on_end_batch() noexcept { }
+
+private:
+    auto    flush_batch() noexcept -> void {
+        if (_nodes.empty() && _edges.empty() && _groups.empty())
+            return;
+        graph_changeset_t changeset;
+        changeset.inserted_nodes = _nodes.inserted.take();
+        changeset.removed_nodes = _nodes.removed.take();
+        changeset.inserted_edges = _edges.inserted.take();
+        changeset.removed_edges = _edges.removed.take();
+        changeset.inserted_groups = _groups.inserted.take();
+        changeset.removed_groups = _groups.removed.take();
+        if (changeset.empty())
+            return;
+        for (auto& observer: super_t::_observers)
+            if (observer &&
+                observer->is_batch_aware())
+                observer->on_batch(changeset);
+    }
+
+    std::size_t                     _batch_depth = 0;
+    changeset_recorder<node_t>      _nodes;
+    changeset_recorder<edge_t>      _edges;
+    changeset_recorder<group_t>     _groups;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::gtpo
@@ -98,6 +98,21 @@ public:
 
 protected:
     bool            _enabled = true;
+
+public:
+    /*! \brief Return true if this observer prefer coalesced on_batch() notifications while a batch is open.
+     *
+     * Batch aware observers are not notified synchronously of topology changes occurring inside a
+     * begin_batch() / end_batch() transaction, they receive a single on_batch() call with a coalesced
+     * changeset once the outermost batch is closed. Outside of a batch, or for observers that are not
+     * batch aware (default), per-event callbacks are called synchronously.
+     */
+    inline auto     is_batch_aware() const noexcept -> bool { return _batch_aware; }
+protected:
+    //! Configure this observer to receive on_batch() notifications, should be set before observer registration.
+    inline auto     set_batch_aware(bool batch_aware) noexcept -> void { _batch_aware = batch_aware; }
+private:
+    bool            _batch_aware = false;
 };
 
 
@@ -136,6 +151,9 @@ protected:
 
     //! \brief Called immediatly after an out-edge has been removed.
     virtual void    on_out_node_removed(node_t& target)  noexcept { static_cast<void>(target); }
+
+    //! \brief Called with coalesced \c target topology changes when a batch is closed, only for batch aware observers.
+    virtual void    on_batch(node_t& target, const gtpo::node_changeset<edge_t>& changeset) noexcept { static_cast<void>(target); static_cast<void>(changeset); }
 };
 
 
@@ -176,6 +194,10 @@ protected:
     virtual void    on_edge_inserted(edge_t& edge) noexcept { static_cast<void>(edge); }
     //! Called when \c edge is about to be removed.
     virtual void    on_edge_removed(edge_t& edge) noexcept { static_cast<void>(edge); }
+
+protected:
+    //! Called with coalesced topology changes when the outermost graph batch is closed, only for batch aware observers.
+    virtual void    on_batch(const gtpo::graph_changeset<node_t, edge_t, group_t>& changeset) noexcept { static_cast<void>(changeset); }
     //@}
     //-------------------------------------------------------------------------
 };
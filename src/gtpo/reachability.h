@@ -0,0 +1,264 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	reachability.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::int64_t, std::uint64_t
+#include <algorithm>        // std::min, std::max
+#include <unordered_map>
+#include <vector>
+
+// GTpo headers
+#include "./snapshot.h"
+#include "./algorithms.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Incrementally maintained reachability index used to answer "is destination reachable from source" queries.
+ *
+ * Every node is labelled with an interval [low, high] such that if node \c a reach node \c b, label(a) contains
+ * label(b) (interval labelling computed on the strongly connected components condensation of the graph, which is
+ * always a DAG). Non containment of labels is a constant time proof of non reachability, when labels are
+ * contained, a DFS pruned with labels is run: on large DAGs, most queries are answered in near-constant time.
+ *
+ * Index is updated incrementally:
+ *   \li Node insertion: a new unique interval is allocated for inserted node, O(1).
+ *   \li Edge insertion (u, v): labels of u and u ancestors are enlarged to contain label(v), propagation stop
+ *       as soon as a label already contains label(v), only the affected region is visited. Propagation is
+ *       abandoned once a visit budget proportional to node count is exhausted (for example when a long chain is
+ *       built top-down), index is then marked stale. Edge insertions are ignored while index is stale.
+ *   \li Edge or node removal: existing labels are still valid (reachability can only decrease), nothing is done.
+ *
+ * Incremental updates loosen labels (pruning become less efficient), index is marked as stale after a number
+ * of updates proportional to node count, and is lazily rebuilt in O(V + E) by gtpo::graph before next query.
+ *
+ * \note Index is maintained by gtpo::graph when enabled with gtpo::graph::set_reachability_indexed(), it
+ * should not be used directly.
+ */
+template <class node_t, class edge_t>
+class reachability_index
+{
+    /*! \name Reachability Index Management *///-------------------------------
+    //@{
+public:
+    reachability_index() noexcept = default;
+    ~reachability_index() noexcept = default;
+    reachability_index(const reachability_index&) = delete;
+    reachability_index& operator=(const reachability_index&) = delete;
+
+    //! Rebuild index for \c nodes topology in O(V + E).
+    template <class nodes_t>
+    auto    rebuild(const nodes_t& nodes, const nodes_t& root_nodes) -> void;
+
+    //! Clear the index (all nodes are unknown until next rebuild() or on_node_inserted() call).
+    auto    clear() noexcept -> void {
+        _labels.clear();
+        _next_post = 0;
+        _updates = 0;
+        _stale = false;
+    }
+
+    //! Return true if incremental updates have loosen (or invalidated) labels enough to require a rebuild().
+    inline auto is_stale() const noexcept -> bool {
+        return _stale || _updates > 32 + _labels.size() / 4;
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Incremental Updates *///-----------------------------------------
+    //@{
+public:
+    auto    on_node_inserted(const node_t* node) -> void {
+        if (node != nullptr) {
+            const auto post = _next_post++;
+            _labels[node] = label{post, post, 0};
+        }
+    }
+
+    auto    on_node_removed(const node_t* node) noexcept -> void {
+        if (_labels.erase(node) > 0)
+            ++_updates;
+    }
+
+    auto    on_edge_inserted(const node_t* source, const node_t* destination) -> void;
+
+    //! Labels remain valid, just record that index is getting loose.
+    inline auto on_edge_removed() noexcept -> void { ++_updates; }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Reachability Queries *///----------------------------------------
+    //@{
+public:
+    /*! \brief Return true if a directed path exists from \c source to \c destination (a node always reach itself).
+     *
+     * \note Query allocate no memory in steady state (marks and stack are reused).
+     */
+    auto    is_reachable(const node_t* source, const node_t* destination) const -> bool;
+
+private:
+    struct label {
+        std::int64_t    low = 0;
+        std::int64_t    high = 0;
+        //! Visit mark for pruned DFS, a node is visited during current query if epoch == _epoch.
+        mutable std::uint64_t   epoch = 0;
+    };
+
+    static inline auto contains(const label& a, const label& b) noexcept -> bool {
+        return a.low <= b.low && b.high <= a.high;
+    }
+
+    std::unordered_map<const node_t*, label>    _labels;
+    std::int64_t                                _next_post = 0;
+    std::size_t                                 _updates = 0;
+    //! Set when an edge insertion propagation has been abandoned, labels are no longer valid.
+    bool                                        _stale = false;
+
+    mutable std::uint64_t                       _epoch = 0;
+    mutable std::vector<const node_t*>          _stack;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+template <class node_t, class edge_t>
+template <class nodes_t>
+auto    reachability_index<node_t, edge_t>::rebuild(const nodes_t& nodes, const nodes_t& root_nodes) -> void
+{
+    using snapshot_t = gtpo::snapshot<node_t, edge_t>;
+    using node_id = typename snapshot_t::node_id;
+    clear();
+    const snapshot_t snapshot{nodes, root_nodes};
+    const auto node_count = snapshot.get_node_count();
+    _labels.reserve(node_count);
+
+    // Components are indexed in reverse topological order: when component c is labelled, all
+    // components reachable from c are already labelled.
+    const auto sccs = gtpo::strongly_connected_components(snapshot);
+    const auto members = sccs.get_members();
+    std::vector<std::int64_t> component_low(sccs.count, 0);
+    for (std::size_t c = 0; c < sccs.count; ++c) {
+        auto low = static_cast<std::int64_t>(c);
+        for (const auto member : members[c])
+            for (const auto out : snapshot.get_out_nodes(member))
+                if (sccs.component[out] != c)
+                    low = std::min(low, component_low[sccs.component[out]]);
+        component_low[c] = low;
+    }
+
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id) {
+        const auto c = sccs.component[id];
+        _labels.emplace(snapshot.get_node(id), label{component_low[c], static_cast<std::int64_t>(c), 0});
+    }
+    _next_post = static_cast<std::int64_t>(component_low.size());
+}
+
+template <class node_t, class edge_t>
+auto    reachability_index<node_t, edge_t>::on_edge_inserted(const node_t* source, const node_t* destination) -> void
+{
+    if (is_stale())     // Index will be rebuilt before next query anyway, do not pay for propagation
+        return;
+    const auto destination_label = _labels.find(destination);
+    if (source == nullptr ||
+        destination_label == _labels.end())
+        return;
+    const auto target = destination_label->second;
+    bool updated = false;
+    std::size_t budget = 64 + _labels.size() / 8;
+    _stack.clear();
+    _stack.push_back(source);
+    while (!_stack.empty()) {
+        const auto node = _stack.back();
+        _stack.pop_back();
+        auto node_label = _labels.find(node);
+        if (node_label == _labels.end() ||
+            contains(node_label->second, target))   // Propagation stop on already "reaching" nodes
+            continue;
+        if (budget-- == 0) {    // Labels of remaining ancestors are not enlarged: index is invalid until rebuilt
+            _stale = true;
+            _stack.clear();
+            return;
+        }
+        node_label->second.low = std::min(node_label->second.low, target.low);
+        node_label->second.high = std::max(node_label->second.high, target.high);
+        updated = true;
+        for (const auto in_node : node->get_in_nodes())
+            _stack.push_back(in_node);
+    }
+    if (updated)
+        ++_updates;
+}
+
+template <class node_t, class edge_t>
+auto    reachability_index<node_t, edge_t>::is_reachable(const node_t* source, const node_t* destination) const -> bool
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return false;
+    if (source == destination)
+        return true;
+    const auto source_label = _labels.find(source);
+    const auto destination_label = _labels.find(destination);
+    if (source_label == _labels.end() ||
+        destination_label == _labels.end())
+        return false;
+    const auto& target = destination_label->second;
+    if (!contains(source_label->second, target))
+        return false;       // Fast negative answer
+
+    // Label pruned DFS
+    ++_epoch;
+    source_label->second.epoch = _epoch;
+    _stack.clear();
+    _stack.push_back(source);
+    while (!_stack.empty()) {
+        const auto node = _stack.back();
+        _stack.pop_back();
+        for (const auto out_node : node->get_out_nodes()) {
+            if (out_node == destination)
+                return true;
+            const auto out_label = _labels.find(out_node);
+            if (out_label == _labels.end() ||
+                out_label->second.epoch == _epoch)
+                continue;
+            out_label->second.epoch = _epoch;
+            if (contains(out_label->second, target))
+                _stack.push_back(out_node);
+        }
+    }
+    return false;
+}
+
+} // ::gtpo
@@ -0,0 +1,274 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	snapshot.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t, std::uint64_t
+#include <algorithm>        // std::fill
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Compact visit marks (dynamic bitset) used by algorithms running on a gtpo::snapshot.
+ *
+ * Marks are indexed by snapshot dense node ids, a graph with 1M nodes use 128kB of marks.
+ */
+class node_marks
+{
+public:
+    node_marks() noexcept = default;
+    explicit node_marks(std::size_t size) { resize(size); }
+
+    //! Resize marks to \c size bits, all marks are cleared.
+    inline auto resize(std::size_t size) -> void {
+        _size = size;
+        _words.assign((size + 63) / 64, 0);
+    }
+    //! Clear all marks (capacity is preserved).
+    inline auto clear() noexcept -> void { std::fill(_words.begin(), _words.end(), 0); }
+    inline auto size() const noexcept -> std::size_t { return _size; }
+
+    inline auto set(std::size_t i) noexcept -> void { _words[i >> 6] |= bit(i); }
+    inline auto reset(std::size_t i) noexcept -> void { _words[i >> 6] &= ~bit(i); }
+    inline auto test(std::size_t i) const noexcept -> bool { return (_words[i >> 6] & bit(i)) != 0; }
+    //! Mark \c i and return true if \c i was not already marked.
+    inline auto test_and_set(std::size_t i) noexcept -> bool {
+        auto& word = _words[i >> 6];
+        const auto mask = bit(i);
+        if ((word & mask) != 0)
+            return false;
+        word |= mask;
+        return true;
+    }
+
+private:
+    static inline auto bit(std::size_t i) noexcept -> std::uint64_t { return std::uint64_t{1} << (i & 63); }
+
+    std::vector<std::uint64_t>  _words;
+    std::size_t                 _size = 0;
+};
+
+/*! \brief Immutable compressed sparse row (CSR) view of a gtpo::graph topology for read-only algorithms.
+ *
+ * Graph nodes are mapped to dense integer ids in [0, get_node_count()[, in and out adjacency lists are stored
+ * in contiguous arrays indexed by per node offsets, group membership is stored the same way. Algorithms running
+ * on a snapshot iterate on integers and use node_marks bitsets instead of chasing QObject nodes pointers and
+ * hashing visited nodes.
+ *
+ * Snapshot is built in O(V + E) with gtpo::graph::snapshot(), it is not updated when the source graph
+ * topology is modified: it should be considered invalid as soon as graph is modified.
+ *
+ * \code
+ * const auto snapshot = graph.snapshot();
+ * auto marks = snapshot.make_marks();
+ * for (const auto out_id : snapshot.get_out_nodes(snapshot.get_id(node)))
+ *   ...
+ * \endcode
+ */
+template <class node_t, class edge_t>
+class snapshot
+{
+    /*! \name Snapshot Management *///-----------------------------------------
+    //@{
+public:
+    using node_id = std::uint32_t;
+    static constexpr node_id invalid_id = std::numeric_limits<node_id>::max();
+
+    //! Contiguous read-only range of snapshot items (node ids or edges).
+    template <class T>
+    class range {
+    public:
+        range(const T* first, const T* last) noexcept : _first{first}, _last{last} { }
+        inline auto begin() const noexcept -> const T* { return _first; }
+        inline auto end() const noexcept -> const T* { return _last; }
+        inline auto size() const noexcept -> std::size_t { return static_cast<std::size_t>(_last - _first); }
+        inline auto empty() const noexcept -> bool { return _first == _last; }
+        inline auto operator[](std::size_t i) const noexcept -> const T& { return _first[i]; }
+    private:
+        const T*    _first = nullptr;
+        const T*    _last = nullptr;
+    };
+    using ids_t     = range<node_id>;
+    using edges_t   = range<const edge_t*>;
+
+    snapshot() noexcept = default;
+    ~snapshot() noexcept = default;
+    snapshot(const snapshot&) = default;
+    snapshot& operator=(const snapshot&) = default;
+    snapshot(snapshot&&) noexcept = default;
+    snapshot& operator=(snapshot&&) noexcept = default;
+
+    /*! \brief Build a snapshot of \c nodes topology, \c root_nodes order is preserved in get_root_nodes().
+     *
+     * \note Edges and group memberships refering to nodes that are not in \c nodes are ignored.
+     */
+    template <class nodes_t>
+    snapshot(const nodes_t& nodes, const nodes_t& root_nodes);
+
+    inline auto get_node_count() const noexcept -> std::size_t { return _nodes.size(); }
+    inline auto get_edge_count() const noexcept -> std::size_t { return _out_targets.size(); }
+    inline auto is_empty() const noexcept -> bool { return _nodes.empty(); }
+
+    //! Return \c node dense id, or invalid_id if \c node is not part of this snapshot.
+    inline auto get_id(const node_t* node) const noexcept -> node_id {
+        const auto id = _ids.find(node);
+        return id != _ids.end() ? id->second : invalid_id;
+    }
+    //! Return node with dense \c id.
+    inline auto get_node(node_id id) const noexcept -> const node_t* { return _nodes[id]; }
+
+    //! Return a marks bitset sized for this snapshot nodes.
+    inline auto make_marks() const -> node_marks { return node_marks{_nodes.size()}; }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Snapshot Topology *///-------------------------------------------
+    //@{
+public:
+    inline auto get_out_nodes(node_id id) const noexcept -> ids_t { return slice(_out_targets, _out_offsets, id); }
+    inline auto get_in_nodes(node_id id) const noexcept -> ids_t { return slice(_in_sources, _in_offsets, id); }
+    //! Return \c id out edges, get_out_edges(id)[i] is the edge to get_out_nodes(id)[i].
+    inline auto get_out_edges(node_id id) const noexcept -> edges_t { return slice(_out_edges, _out_offsets, id); }
+    //! Return \c id in edges, get_in_edges(id)[i] is the edge from get_in_nodes(id)[i].
+    inline auto get_in_edges(node_id id) const noexcept -> edges_t { return slice(_in_edges, _in_offsets, id); }
+
+    inline auto get_out_degree(node_id id) const noexcept -> std::size_t { return _out_offsets[id + 1] - _out_offsets[id]; }
+    inline auto get_in_degree(node_id id) const noexcept -> std::size_t { return _in_offsets[id + 1] - _in_offsets[id]; }
+
+    //! Return snapshot graph root nodes ids.
+    inline auto get_root_nodes() const noexcept -> const std::vector<node_id>& { return _root_nodes; }
+
+    inline auto is_group(node_id id) const noexcept -> bool { return _is_group.test(id); }
+    //! Return \c id group id, or invalid_id if \c id is not grouped.
+    inline auto get_group(node_id id) const noexcept -> node_id { return _groups[id]; }
+    //! Return group \c id nodes (empty for non group nodes).
+    inline auto get_group_nodes(node_id id) const noexcept -> ids_t { return slice(_group_nodes, _group_offsets, id); }
+
+private:
+    template <class T>
+    static inline auto slice(const std::vector<T>& values, const std::vector<node_id>& offsets, node_id id) noexcept -> range<T> {
+        const auto data = values.data();
+        return range<T>{data + offsets[id], data + offsets[id + 1]};
+    }
+
+    std::vector<const node_t*>                      _nodes;
+    std::unordered_map<const node_t*, node_id>      _ids;
+    std::vector<node_id>                            _root_nodes;
+
+    std::vector<node_id>        _out_offsets;
+    std::vector<node_id>        _out_targets;
+    std::vector<const edge_t*>  _out_edges;
+
+    std::vector<node_id>        _in_offsets;
+    std::vector<node_id>        _in_sources;
+    std::vector<const edge_t*>  _in_edges;
+
+    node_marks                  _is_group;
+    std::vector<node_id>        _groups;
+    std::vector<node_id>        _group_offsets;
+    std::vector<node_id>        _group_nodes;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+template <class node_t, class edge_t>
+template <class nodes_t>
+snapshot<node_t, edge_t>::snapshot(const nodes_t& nodes, const nodes_t& root_nodes)
+{
+    // 1. Dense ids
+    const auto node_count = static_cast<std::size_t>(nodes.size());
+    _nodes.reserve(node_count);
+    _ids.reserve(node_count);
+    for (const auto node : nodes) {
+        if (node == nullptr ||
+            !_ids.emplace(node, static_cast<node_id>(_nodes.size())).second)
+            continue;
+        _nodes.push_back(node);
+    }
+    const auto count = _nodes.size();
+    _root_nodes.reserve(static_cast<std::size_t>(root_nodes.size()));
+    for (const auto root_node : root_nodes) {
+        const auto id = get_id(root_node);
+        if (id != invalid_id)
+            _root_nodes.push_back(id);
+    }
+
+    // 2. In/out adjacency and group memberships
+    _out_offsets.reserve(count + 1);
+    _in_offsets.reserve(count + 1);
+    _group_offsets.reserve(count + 1);
+    _groups.assign(count, invalid_id);
+    _is_group.resize(count);
+    _out_offsets.push_back(0);
+    _in_offsets.push_back(0);
+    _group_offsets.push_back(0);
+    for (node_id id = 0; id < static_cast<node_id>(count); ++id) {
+        const auto node = _nodes[id];
+        for (const auto out_edge : node->get_out_edges()) {
+            const auto dst = out_edge != nullptr ? get_id(out_edge->get_dst()) : invalid_id;
+            if (dst == invalid_id)
+                continue;
+            _out_targets.push_back(dst);
+            _out_edges.push_back(out_edge);
+        }
+        _out_offsets.push_back(static_cast<node_id>(_out_targets.size()));
+
+        for (const auto in_edge : node->get_in_edges()) {
+            const auto src = in_edge != nullptr ? get_id(in_edge->get_src()) : invalid_id;
+            if (src == invalid_id)
+                continue;
+            _in_sources.push_back(src);
+            _in_edges.push_back(in_edge);
+        }
+        _in_offsets.push_back(static_cast<node_id>(_in_sources.size()));
+
+        if (node->get_group() != nullptr)
+            _groups[id] = get_id(node->get_group());
+        if (node->is_group()) {
+            _is_group.set(id);
+            for (const auto group_node : node->get_nodes()) {
+                const auto group_node_id = get_id(group_node);
+                if (group_node_id != invalid_id)
+                    _group_nodes.push_back(group_node_id);
+            }
+        }
+        _group_offsets.push_back(static_cast<node_id>(_group_nodes.size()));
+    }
+}
+
+} // ::gtpo
@@ -0,0 +1,322 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	topological_order.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <algorithm>        // std::sort, std::remove
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+// GTpo headers
+#include "./snapshot.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Dynamic topological order of an acyclic gtpo::graph, maintained online with Pearce-Kelly algorithm.
+ *
+ * Every node store its position in order in node_t::_topological_order, for every edge (u, v)
+ * _topological_order(u) < _topological_order(v).
+ *
+ *   \li Node insertion: node is appended at the end of order, O(1).
+ *   \li Edge insertion (x, y): if order(x) < order(y) nothing is done, otherwise only the "affected region"
+ *       (nodes reachable from y and reaching x with an order between order(y) and order(x)) is visited and
+ *       reordered (Pearce D.J., Kelly P.H.J. "A dynamic topological sort algorithm for directed acyclic graphs", 2006).
+ *   \li Node or edge removal: order remain valid.
+ *
+ * When an inserted edge create a circuit, order is no longer maintained (is_acyclic() return false), it is
+ * lazily rebuilt with Kahn algorithm by gtpo::graph when a node or an edge is removed.
+ *
+ * \note Order is maintained by gtpo::graph when enabled with gtpo::graph::set_topologically_ordered(), it
+ * should not be used directly.
+ */
+template <class node_t, class edge_t>
+class topological_order
+{
+    /*! \name Topological Order Management *///--------------------------------
+    //@{
+public:
+    topological_order() noexcept = default;
+    ~topological_order() noexcept = default;
+    topological_order(const topological_order&) = delete;
+    topological_order& operator=(const topological_order&) = delete;
+
+    //! Rebuild order for \c nodes topology in O(V + E) using Kahn algorithm, return false if topology has circuits.
+    template <class nodes_t>
+    auto    rebuild(const nodes_t& nodes, const nodes_t& root_nodes) -> bool;
+
+    //! Clear the order (all nodes are unordered).
+    auto    clear() noexcept -> void {
+        for (auto node : _order)
+            if (node != nullptr)
+                node->_topological_order = -1;
+        _order.clear();
+        _holes = 0;
+        _acyclic = true;
+        _stale = false;
+    }
+
+    //! Return true if the ordered topology has no circuits, order is valid only for acyclic topologies.
+    inline auto is_acyclic() const noexcept -> bool { return _acyclic; }
+    //! Return true if a circuit might have been removed and order should be rebuilt.
+    inline auto is_stale() const noexcept -> bool { return _stale; }
+
+    /*! \brief Return nodes in topological order (valid only if is_acyclic() is true).
+     *
+     * \note Nodes removed since last call are compacted in O(V).
+     */
+    auto    get_nodes() const -> const std::vector<node_t*>&;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Incremental Updates *///-----------------------------------------
+    //@{
+public:
+    auto    on_node_inserted(node_t* node) -> void {
+        if (node == nullptr)
+            return;
+        node->_topological_order = static_cast<int>(_order.size());
+        _order.push_back(node);
+    }
+
+    auto    on_node_removed(node_t* node) noexcept -> void {
+        if (node == nullptr ||
+            node->_topological_order < 0)
+            return;
+        _order[static_cast<std::size_t>(node->_topological_order)] = nullptr;
+        node->_topological_order = -1;
+        ++_holes;
+        if (!_acyclic)
+            _stale = true;
+    }
+
+    //! Pearce-Kelly reordering of affected region when edge (source, destination) is inserted.
+    auto    on_edge_inserted(node_t* source, node_t* destination) -> void;
+
+    inline auto on_edge_removed() noexcept -> void {
+        if (!_acyclic)      // Removed edge might have been the last edge of a circuit
+            _stale = true;
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Topological Queries *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Return true if inserting an edge from \c source to \c destination would create a circuit.
+     *
+     * When order(source) < order(destination), answer is O(1), otherwise only nodes with an order in
+     * [order(destination), order(source)] are visited.
+     */
+    auto    would_create_cycle(const node_t* source, const node_t* destination) const -> bool;
+
+private:
+    //! Collect nodes reachable from \c root with an order <= \c upper_bound in _forward, return false if \c target is reached.
+    auto    collect_forward(node_t* root, const node_t* target, int upper_bound) const -> bool;
+    //! Collect nodes reaching \c root with an order >= \c lower_bound in _backward.
+    auto    collect_backward(node_t* root, int lower_bound) const -> void;
+
+    mutable std::vector<node_t*>    _order;
+    mutable std::size_t             _holes = 0;
+    bool                            _acyclic = true;
+    bool                            _stale = false;
+
+    // Pearce-Kelly search storage, reused between updates.
+    mutable std::vector<node_t*>            _forward;
+    mutable std::vector<node_t*>            _backward;
+    mutable std::vector<node_t*>            _stack;
+    mutable std::unordered_set<const node_t*>  _marks;
+    std::vector<int>                        _positions;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+template <class node_t, class edge_t>
+template <class nodes_t>
+auto    topological_order<node_t, edge_t>::rebuild(const nodes_t& nodes, const nodes_t& root_nodes) -> bool
+{
+    using snapshot_t = gtpo::snapshot<node_t, edge_t>;
+    using node_id = typename snapshot_t::node_id;
+    clear();
+    const snapshot_t snapshot{nodes, root_nodes};
+    const auto node_count = snapshot.get_node_count();
+    std::vector<std::size_t> in_degrees(node_count, 0);
+    std::vector<node_id> queue;
+    queue.reserve(node_count);
+    for (node_id id = 0; id < static_cast<node_id>(node_count); ++id) {
+        in_degrees[id] = snapshot.get_in_degree(id);
+        if (in_degrees[id] == 0)
+            queue.push_back(id);
+    }
+    // Kahn algorithm, queue is never poped, processed nodes are in topological order
+    _order.reserve(node_count);
+    for (std::size_t q = 0; q < queue.size(); ++q) {
+        const auto id = queue[q];
+        on_node_inserted(const_cast<node_t*>(snapshot.get_node(id)));
+        for (const auto out_id : snapshot.get_out_nodes(id))
+            if (--in_degrees[out_id] == 0)
+                queue.push_back(out_id);
+    }
+    _acyclic = _order.size() == node_count;
+    if (!_acyclic) {    // Graph has circuits: order remaining nodes arbitrarily
+        for (node_id id = 0; id < static_cast<node_id>(node_count); ++id)
+            if (in_degrees[id] != 0)
+                on_node_inserted(const_cast<node_t*>(snapshot.get_node(id)));
+    }
+    return _acyclic;
+}
+
+template <class node_t, class edge_t>
+auto    topological_order<node_t, edge_t>::get_nodes() const -> const std::vector<node_t*>&
+{
+    if (_holes > 0) {
+        _order.erase(std::remove(_order.begin(), _order.end(), nullptr), _order.end());
+        for (std::size_t o = 0; o < _order.size(); ++o)
+            _order[o]->_topological_order = static_cast<int>(o);
+        _holes = 0;
+    }
+    return _order;
+}
+
+template <class node_t, class edge_t>
+auto    topological_order<node_t, edge_t>::collect_forward(node_t* root, const node_t* target, int upper_bound) const -> bool
+{
+    _forward.clear();
+    _marks.clear();
+    _stack.clear();
+    _stack.push_back(root);
+    _marks.insert(root);
+    while (!_stack.empty()) {
+        const auto node = _stack.back();
+        _stack.pop_back();
+        _forward.push_back(node);
+        for (const auto out_node : node->get_out_nodes()) {
+            if (out_node == target)
+                return false;   // Circuit
+            if (out_node->_topological_order <= upper_bound &&
+                _marks.insert(out_node).second)
+                _stack.push_back(out_node);
+        }
+    }
+    return true;
+}
+
+template <class node_t, class edge_t>
+auto    topological_order<node_t, edge_t>::collect_backward(node_t* root, int lower_bound) const -> void
+{
+    _backward.clear();
+    _marks.clear();
+    _stack.clear();
+    _stack.push_back(root);
+    _marks.insert(root);
+    while (!_stack.empty()) {
+        const auto node = _stack.back();
+        _stack.pop_back();
+        _backward.push_back(node);
+        for (const auto in_node : node->get_in_nodes())
+            if (in_node->_topological_order >= lower_bound &&
+                _marks.insert(in_node).second)
+                _stack.push_back(in_node);
+    }
+}
+
+template <class node_t, class edge_t>
+auto    topological_order<node_t, edge_t>::on_edge_inserted(node_t* source, node_t* destination) -> void
+{
+    if (!_acyclic ||
+        source == nullptr ||
+        destination == nullptr)
+        return;
+    if (source == destination) {
+        _acyclic = false;
+        return;
+    }
+    const auto lower_bound = destination->_topological_order;
+    const auto upper_bound = source->_topological_order;
+    if (lower_bound < 0 ||
+        upper_bound < 0 ||
+        upper_bound < lower_bound)  // Order is already valid
+        return;
+
+    // 1. Discovery of affected region
+    if (!collect_forward(destination, source, upper_bound)) {
+        _acyclic = false;
+        return;
+    }
+    collect_backward(source, lower_bound);
+
+    // 2. Reassignment: nodes reaching source are moved before nodes reachable from destination,
+    // using the sorted pool of affected positions.
+    const auto by_order = [](const node_t* a, const node_t* b) { return a->_topological_order < b->_topological_order; };
+    std::sort(_forward.begin(), _forward.end(), by_order);
+    std::sort(_backward.begin(), _backward.end(), by_order);
+    _positions.clear();
+    _positions.reserve(_forward.size() + _backward.size());
+    for (const auto node : _backward)
+        _positions.push_back(node->_topological_order);
+    for (const auto node : _forward)
+        _positions.push_back(node->_topological_order);
+    std::sort(_positions.begin(), _positions.end());
+    std::size_t p = 0;
+    for (const auto node : _backward) {
+        node->_topological_order = _positions[p++];
+        _order[static_cast<std::size_t>(node->_topological_order)] = node;
+    }
+    for (const auto node : _forward) {
+        node->_topological_order = _positions[p++];
+        _order[static_cast<std::size_t>(node->_topological_order)] = node;
+    }
+}
+
+template <class node_t, class edge_t>
+auto    topological_order<node_t, edge_t>::would_create_cycle(const node_t* source, const node_t* destination) const -> bool
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return false;
+    if (source == destination)
+        return true;
+    const auto upper_bound = source->_topological_order;
+    if (_acyclic &&
+        upper_bound >= 0 &&
+        upper_bound < destination->_topological_order)
+        return false;   // Source is before destination: no path from destination to source
+    // Search a path from destination to source, bounded by source order when order is valid
+    return !collect_forward(const_cast<node_t*>(destination), source,
+                            _acyclic && upper_bound >= 0 ? upper_bound : std::numeric_limits<int>::max());
+}
+
+} // ::gtpo
@@ -0,0 +1,182 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	traversal.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// STD headers
+#include <atomic>
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t
+#include <vector>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Iterative (explicit stack) DFS/BFS traversal engine with epoch stamped visit marks.
+ *
+ * Visit marks are stored directly in nodes (node_t::_visit_epoch): starting a new traversal with begin()
+ * invalidate all previous marks in O(1), without clearing or allocating a marks set. Traversal stacks
+ * are reused between traversals: in steady state, traversals do not allocate memory and can run on
+ * arbitrary deep topologies without stack overflow.
+ *
+ * Children of a visited node are generated with an \c expand functor taking the visited node and an \c emit
+ * functor to call for every child (in visit order), \c visit functor is called once for every visited node
+ * and return false to stop the traversal:
+ * \code
+ * auto& traversal = graph.get_traversal();
+ * traversal.begin();
+ * traversal.dfs(root,
+ *               [](const node_t& node, const auto& emit) { for (const auto out_node : node.get_out_nodes()) emit(out_node); },
+ *               [&nodes](const node_t& node) { nodes.push_back(&node); return true; });
+ * \endcode
+ *
+ * \warning Traversal is not reentrant: \c expand and \c visit must not start another traversal with
+ * the same engine.
+ */
+template <class node_t>
+class traversal
+{
+    /*! \name Traversal Management *///----------------------------------------
+    //@{
+public:
+    traversal() noexcept = default;
+    ~traversal() noexcept = default;
+    traversal(const traversal&) = delete;
+    traversal& operator=(const traversal&) = delete;
+
+    //! Start a new traversal, all nodes are unmarked in O(1) (engines of different graphs can be started concurrently).
+    inline auto begin() noexcept -> void { _epoch = _next_epoch.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    //! Mark \c node as visited in current traversal, return true if \c node was not already marked.
+    inline auto mark(const node_t& node) const noexcept -> bool {
+        if (node._visit_epoch == _epoch)
+            return false;
+        node._visit_epoch = _epoch;
+        return true;
+    }
+    //! Return true if \c node has been marked in current traversal.
+    inline auto is_marked(const node_t& node) const noexcept -> bool { return node._visit_epoch == _epoch; }
+
+private:
+    std::uint64_t           _epoch = 0;
+    //! Epochs are unique for all traversals of node_t nodes, marks from different engines never collide.
+    static std::atomic<std::uint64_t>   _next_epoch;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Traversal Algorithms *///----------------------------------------
+    //@{
+public:
+    /*! \brief Preorder DFS from \c root in current traversal (already marked nodes are not visited again).
+     *
+     * Nodes are marked when visited and children are stacked in reverse order: visit order is the same
+     * than a recursive preorder DFS.
+     * \return false if traversal has been stopped by \c visit.
+     */
+    template <class expand_t, class visit_t>
+    auto    dfs(const node_t* root, expand_t&& expand, visit_t&& visit) -> bool;
+
+    /*! \brief BFS from \c root in current traversal (already marked nodes are not visited again).
+     *
+     * \return false if traversal has been stopped by \c visit.
+     */
+    template <class expand_t, class visit_t>
+    auto    bfs(const node_t* root, expand_t&& expand, visit_t&& visit) -> bool;
+
+private:
+    std::vector<const node_t*>  _stack;
+    std::vector<const node_t*>  _childs;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+template <class node_t>
+std::atomic<std::uint64_t>  traversal<node_t>::_next_epoch{0};
+
+template <class node_t>
+template <class expand_t, class visit_t>
+auto    traversal<node_t>::dfs(const node_t* root, expand_t&& expand, visit_t&& visit) -> bool
+{
+    if (root == nullptr)
+        return true;
+    const auto emit = [this](const node_t* child) {
+        if (child != nullptr &&
+            !is_marked(*child))
+            _childs.push_back(child);
+    };
+    _stack.clear();
+    _stack.push_back(root);
+    while (!_stack.empty()) {
+        const auto node = _stack.back();
+        _stack.pop_back();
+        if (!mark(*node))   // Do not visit already visited branchs
+            continue;
+        if (!visit(*node)) {
+            _stack.clear();
+            return false;
+        }
+        _childs.clear();
+        expand(*node, emit);
+        _stack.insert(_stack.end(), _childs.rbegin(), _childs.rend());
+    }
+    return true;
+}
+
+template <class node_t>
+template <class expand_t, class visit_t>
+auto    traversal<node_t>::bfs(const node_t* root, expand_t&& expand, visit_t&& visit) -> bool
+{
+    if (root == nullptr ||
+        !mark(*root))
+        return true;
+    // _stack is used as a FIFO queue, nodes are marked when enqueued
+    const auto emit = [this](const node_t* child) {
+        if (child != nullptr &&
+            mark(*child))
+            _stack.push_back(child);
+    };
+    _stack.clear();
+    _stack.push_back(root);
+    for (std::size_t head = 0; head < _stack.size(); ++head) {
+        const auto node = _stack[head];
+        if (!visit(*node)) {
+            _stack.clear();
+            return false;
+        }
+        expand(*node, emit);
+    }
+    _stack.clear();
+    return true;
+}
+
+} // ::gtpo
@@ -0,0 +1,283 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanArrowItem.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+// Qt headers
+#include <QtMath>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+// QuickQanava headers
+#include "./qanArrowItem.h"
+#include "./qanEdgeItem.h"
+
+namespace qan { // ::qan
+
+/* ArrowItem Object Management *///--------------------------------------------
+ArrowItem::ArrowItem(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setTransformOrigin(QQuickItem::TopLeft);
+}
+
+void    ArrowItem::setEdgeItem(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == _edgeItem)
+        return;
+    if (_edgeItem)
+        disconnect(_edgeItem, nullptr, this, nullptr);
+    _edgeItem = edgeItem;
+    if (_edgeItem) {
+        connect(_edgeItem, &qan::EdgeItem::edgeGeometryChanged, this, &ArrowItem::updateArrow);
+        connect(_edgeItem, &qan::EdgeItem::srcShapeChanged,     this, &ArrowItem::updateArrow);
+        connect(_edgeItem, &qan::EdgeItem::dstShapeChanged,     this, &ArrowItem::updateArrow);
+    }
+    updateArrow();
+    emit edgeItemChanged();
+}
+
+void    ArrowItem::setEnd(ArrowEnd end)
+{
+    if (end != _end) {
+        _end = end;
+        updateArrow();
+        emit endChanged();
+    }
+}
+
+void    ArrowItem::setColor(const QColor& color)
+{
+    if (color != _color) {
+        _color = color;
+        _colorChanged = true;
+        update();
+        emit colorChanged();
+    }
+}
+
+void    ArrowItem::setLineWidth(qreal lineWidth)
+{
+    if (!qFuzzyCompare(1. + lineWidth, 1. + _lineWidth)) {
+        _lineWidth = lineWidth;
+        updateArrow();
+        emit lineWidthChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Arrow Geometry Management *///----------------------------------------------
+namespace { // ::qan::anonymous
+
+struct ArrowKey {
+    qan::ArrowItem::ArrowEnd    end;
+    qan::EdgeStyle::ArrowShape  shape;
+    QPointF     a1, a2, a3;
+    qreal       lineWidth;
+    bool operator==(const ArrowKey& rhs) const noexcept {
+        return end == rhs.end &&
+               shape == rhs.shape &&
+               a1 == rhs.a1 && a2 == rhs.a2 && a3 == rhs.a3 &&
+               lineWidth == rhs.lineWidth;
+    }
+};
+
+struct ArrowKeyHash {
+    std::size_t operator()(const ArrowKey& key) const noexcept {
+        std::size_t h = std::hash<int>{}(static_cast<int>(key.shape) * 2 + static_cast<int>(key.end));
+        const auto combine = [&h](qreal v) {
+            h ^= std::hash<qreal>{}(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        };
+        for (const auto& p : {key.a1, key.a2, key.a3}) {
+            combine(p.x());
+            combine(p.y());
+        }
+        combine(key.lineWidth);
+        return h;
+    }
+};
+
+} // ::qan::anonymous
+
+auto    ArrowItem::getArrowTriangles(ArrowEnd end, qan::EdgeStyle::ArrowShape shape,
+                                     const QPointF& a1, const QPointF& a2, const QPointF& a3,
+                                     qreal lineWidth) -> Triangles
+{
+    using ArrowShape = qan::EdgeStyle::ArrowShape;
+    if (shape == ArrowShape::None)
+        return nullptr;
+    static std::unordered_map<ArrowKey, Triangles, ArrowKeyHash> cache;
+    const ArrowKey key{end, shape, a1, a2, a3, lineWidth};
+    const auto cached = cache.find(key);
+    if (cached != cache.end())
+        return cached->second;
+    if (cache.size() > 256)     // Arrow geometry is usually shared by all edges, avoid unbounded growth with animated arrows
+        cache.clear();
+
+    // Generate arrow outline polygon (see EdgeXxxPath.qml for reference)
+    std::vector<QPointF> polygon;
+    bool    filled = false;
+    qreal   strokeWidth = lineWidth;
+    switch (shape) {
+    case ArrowShape::None:
+        break;
+    case ArrowShape::Arrow:         // [[fallthrough]]
+    case ArrowShape::ArrowOpen:
+        filled = shape == ArrowShape::Arrow;
+        if (end == ArrowEnd::Destination) {
+            // Take line width into account in arrow base, arrow is stroked with a fixed 2. width
+            const QPointF halfLine{0., lineWidth / 2.};
+            polygon = {a1 - halfLine, a3 + halfLine, a2};
+            strokeWidth = 2.;
+        } else
+            polygon = {a1, a3, a2};
+        break;
+    case ArrowShape::Circle:        // [[fallthrough]]
+    case ArrowShape::CircleOpen: {
+        static constexpr int circleSegments = 16;
+        const QPointF center = a2 / 2.;
+        const qreal radius = a2.x() / 2.;
+        for (int s = 0; s < circleSegments; s++) {
+            const qreal t = s * 2. * M_PI / circleSegments;
+            polygon.push_back(center + QPointF{-radius * std::cos(t), radius * std::sin(t)});
+        }
+        filled = shape == ArrowShape::Circle;
+    }
+        break;
+    case ArrowShape::Rect:          // [[fallthrough]]
+    case ArrowShape::RectOpen:
+        polygon = {a1, QPointF{0., 0.}, a3, a2};
+        filled = shape == ArrowShape::Rect;
+        break;
+    }
+
+    // Triangulate (all arrow shapes are convex) and stroke outline
+    auto triangles = std::make_shared<std::vector<QPointF>>();
+    const auto n = polygon.size();
+    if (filled) {
+        for (std::size_t p = 1; p + 1 < n; p++) {
+            triangles->push_back(polygon[0]);
+            triangles->push_back(polygon[p]);
+            triangles->push_back(polygon[p + 1]);
+        }
+    }
+    for (std::size_t p = 0; p < n; p++) {
+        const QPointF& p1 = polygon[p];
+        const QPointF& p2 = polygon[(p + 1) % n];
+        const QPointF d = p2 - p1;
+        const qreal length = std::sqrt(d.x() * d.x() + d.y() * d.y());
+        if (length < 0.0001)
+            continue;
+        const QPointF normal = QPointF{-d.y(), d.x()} * (strokeWidth / (2. * length));
+        triangles->insert(triangles->end(), {p1 + normal, p1 - normal, p2 + normal,
+                                             p2 + normal, p1 - normal, p2 - normal});
+    }
+    cache.emplace(key, triangles);
+    return triangles;
+}
+
+void    ArrowItem::updateArrow()
+{
+    Triangles triangles;
+    if (_edgeItem) {
+        if (_end == ArrowEnd::Source) {
+            setPosition(_edgeItem->getP1());
+            setRotation(_edgeItem->getSrcAngle());
+            triangles = getArrowTriangles(_end, _edgeItem->getSrcShape(),
+                                          _edgeItem->getSrcA1(), _edgeItem->getSrcA2(), _edgeItem->getSrcA3(),
+                                          _lineWidth);
+        } else {
+            setPosition(_edgeItem->getP2());
+            setRotation(_edgeItem->getDstAngle());
+            triangles = getArrowTriangles(_end, _edgeItem->getDstShape(),
+                                          _edgeItem->getDstA1(), _edgeItem->getDstA2(), _edgeItem->getDstA3(),
+                                          _lineWidth);
+        }
+    }
+    if (triangles != _triangles) {  // Cached geometry is shared: same key, same pointer
+        _triangles = triangles;
+        _trianglesChanged = true;
+        update();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+QSGNode*    ArrowItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (!_triangles ||
+        _triangles->empty()) {
+        delete node;
+        _trianglesChanged = true;
+        _colorChanged = true;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGFlatColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        _trianglesChanged = true;
+        _colorChanged = true;
+    }
+    if (_trianglesChanged) {
+        const auto& triangles = *_triangles;
+        auto geometry = node->geometry();
+        if (geometry->vertexCount() != static_cast<int>(triangles.size()))
+            geometry->allocate(static_cast<int>(triangles.size()));
+        auto vertices = geometry->vertexDataAsPoint2D();
+        for (std::size_t v = 0; v < triangles.size(); v++)
+            vertices[v].set(static_cast<float>(triangles[v].x()), static_cast<float>(triangles[v].y()));
+        node->markDirty(QSGNode::DirtyGeometry);
+        _trianglesChanged = false;
+    }
+    if (_colorChanged) {
+        static_cast<QSGFlatColorMaterial*>(node->material())->setColor(_color);
+        node->markDirty(QSGNode::DirtyMaterial);
+        _colorChanged = false;
+    }
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
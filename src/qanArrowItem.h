@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanArrowItem.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QtQml>
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+class EdgeItem;
+
+/*! \brief Draw an edge source or destination arrow head (arrow, circle or rect, filled or open).
+ *
+ * Arrow item is positioned and rotated on its edge item \c p1 / \c p2 ends, geometry is read from
+ * edge item \c srcA1..srcA3 or \c dstA1..dstA3 arrow points: no QML objects are created per edge
+ * and per arrow shape. Arrows with the same shape, size and line width share the same triangulated
+ * geometry (see getArrowTriangles()).
+ *
+ * \note Arrow item is an opt-in fast path (see EdgeTemplate.qml \c sceneGraphArrows, default to false):
+ * triangles are drawn with a flat color material, without antialiasing (enable multisampling on the view
+ * for smooth arrows) and open shapes outlines have no joins. Default edge delegate draw arrows with
+ * antialiased \c Shape.CurveRenderer shapes.
+ *
+ * \code
+ *  Qan.ArrowItem {
+ *    edgeItem: edgeTemplate.edgeItem
+ *    end: Qan.ArrowItem.Destination
+ *    color: edgeTemplate.color
+ *    lineWidth: edgeItem?.style?.lineWidth ?? 2.
+ *  }
+ * \endcode
+ *
+ * \nosubgrouping
+ */
+class ArrowItem : public QQuickItem
+{
+    /*! \name ArrowItem Object Management *///---------------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit ArrowItem(QQuickItem* parent = nullptr);
+    virtual ~ArrowItem() override = default;
+    ArrowItem(const ArrowItem&) = delete;
+
+public:
+    //! Edge end where an arrow is drawn.
+    enum class ArrowEnd : unsigned int {
+        Source      = 0,
+        Destination = 1
+    };
+    Q_ENUM(ArrowEnd)
+
+    //! Edge item whose arrow is drawn (arrow item must be in \c edgeItem CS, usually a child of edge delegate).
+    Q_PROPERTY(qan::EdgeItem* edgeItem READ getEdgeItem WRITE setEdgeItem NOTIFY edgeItemChanged FINAL)
+    inline qan::EdgeItem*   getEdgeItem() const noexcept { return _edgeItem.data(); }
+    void                    setEdgeItem(qan::EdgeItem* edgeItem);
+private:
+    QPointer<qan::EdgeItem> _edgeItem;
+signals:
+    void                    edgeItemChanged();
+
+public:
+    //! Edge end where this arrow is drawn, default to Destination.
+    Q_PROPERTY(ArrowEnd end READ getEnd WRITE setEnd NOTIFY endChanged FINAL)
+    inline ArrowEnd getEnd() const noexcept { return _end; }
+    void            setEnd(ArrowEnd end);
+private:
+    ArrowEnd        _end = ArrowEnd::Destination;
+signals:
+    void            endChanged();
+
+public:
+    //! Arrow fill and stroke color, default to black.
+    Q_PROPERTY(QColor color READ getColor WRITE setColor NOTIFY colorChanged FINAL)
+    inline const QColor&    getColor() const noexcept { return _color; }
+    void                    setColor(const QColor& color);
+private:
+    QColor                  _color{0, 0, 0};
+signals:
+    void                    colorChanged();
+
+public:
+    //! Edge line width, used for circle and rect shapes stroke, default to 2.
+    Q_PROPERTY(qreal lineWidth READ getLineWidth WRITE setLineWidth NOTIFY lineWidthChanged FINAL)
+    inline qreal    getLineWidth() const noexcept { return _lineWidth; }
+    void            setLineWidth(qreal lineWidth);
+private:
+    qreal           _lineWidth = 2.;
+signals:
+    void            lineWidthChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Arrow Geometry Management *///-----------------------------------
+    //@{
+public:
+    using Triangles = std::shared_ptr<const std::vector<QPointF>>;
+
+    /*! \brief Return triangulated \c shape arrow geometry (3 points per triangle, in arrow CS) for arrow points \c a1, \c a2, \c a3.
+     *
+     * Geometry is cached and shared for all arrows with the same end, shape, points and line width (usually
+     * all arrows of a graph), result is \c nullptr for None shape. Like EdgeSrcArrowPath.qml and EdgeDstArrowPath.qml,
+     * source arrows are stroked with \c lineWidth, destination arrows base is enlarged by \c lineWidth and stroked
+     * with a fixed 2. width.
+     * \warning Must be called from GUI thread.
+     */
+    static Triangles    getArrowTriangles(ArrowEnd end, qan::EdgeStyle::ArrowShape shape,
+                                          const QPointF& a1, const QPointF& a2, const QPointF& a3,
+                                          qreal lineWidth);
+
+protected slots:
+    //! Update arrow position, rotation and geometry from edge item.
+    void                updateArrow();
+
+private:
+    Triangles           _triangles;
+    //! True when _triangles has changed since last updatePaintNode() (geometry is copied only when modified).
+    bool                _trianglesChanged = true;
+    bool                _colorChanged = true;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::ArrowItem);
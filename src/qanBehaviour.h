@@ -114,12 +114,23 @@ public:
     //! \copydoc gtpo::dynamic_node_nehaviour::outNodeRemoved()
     virtual void    on_out_node_removed(qan::Node& target) noexcept override { Q_UNUSED(target); }
 
+    //! \copydoc gtpo::node_observer::on_batch()
+    virtual void    on_batch(qan::Node& target, const gtpo::node_changeset<qan::Edge>& changeset) noexcept override { Q_UNUSED(target); topologyChanged(changeset); }
+
 protected:
     virtual void    inNodeInserted(qan::Node& inNode, qan::Edge& edge) noexcept { Q_UNUSED(inNode); Q_UNUSED(edge); }
     virtual void    inNodeRemoved(qan::Node& inNode, qan::Edge& edge) noexcept { Q_UNUSED(inNode); Q_UNUSED(edge); }
 
     virtual void    outNodeInserted(qan::Node& outNode, qan::Edge& edge) noexcept { Q_UNUSED(outNode); Q_UNUSED(edge); }
     virtual void    outNodeRemoved(qan::Node& outNode, qan::Edge& edge) noexcept { Q_UNUSED(outNode); Q_UNUSED(edge); }
+
+    /*! \brief Called with coalesced host topology changes when a graph batch is closed (only if behaviour is batch aware).
+     *
+     * Call set_batch_aware(true) in a concrete behaviour constructor to receive a single topologyChanged() notification
+     * instead of per-edge inNodeInserted() / outNodeInserted() calls for batched modifications (for example
+     * qan::Graph::insertEdges()).
+     */
+    virtual void    topologyChanged(const gtpo::node_changeset<qan::Edge>& changeset) noexcept { Q_UNUSED(changeset); }
     //@}
     //-------------------------------------------------------------------------
 };
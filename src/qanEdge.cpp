@@ -63,13 +63,44 @@ qan::EdgeItem*   Edge::getItem() noexcept { return _item.data(); }
 void    Edge::setItem(qan::EdgeItem* edgeItem) noexcept
 {
     if (edgeItem != nullptr) {
+        const bool itemModified = edgeItem != _item;
         _item = edgeItem;
         if (edgeItem->getEdge() != this)
             edgeItem->setEdge(this);
+        if (itemModified)
+            emit itemChanged();
     }
 }
 //-----------------------------------------------------------------------------
 
+/* Edge Virtualization *///----------------------------------------------------
+void    Edge::setItemDelegate(QQmlComponent* component, qan::EdgeStyle* style) noexcept
+{
+    _itemComponent = component;
+    _itemStyle = style;
+}
+
+void    Edge::releaseItem() noexcept
+{
+    const auto item = detachItem();
+    if (item != nullptr) {
+        item->setVisible(false);
+        item->setParentItem(nullptr);
+        item->deleteLater();
+    }
+}
+
+qan::EdgeItem*  Edge::detachItem() noexcept
+{
+    if (!_item)
+        return nullptr;
+    const auto item = _item.data();
+    _item = nullptr;
+    emit itemChanged();
+    return item;
+}
+//-----------------------------------------------------------------------------
+
 /* Edge Static Factories *///--------------------------------------------------
 QQmlComponent*  Edge::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
@@ -76,11 +76,32 @@ public:
 public:
     friend class qan::EdgeItem;
 
-    Q_PROPERTY(qan::EdgeItem* item READ getItem CONSTANT)
+    //! Edge visual item, might be nullptr for non visual edges or edges virtualized out of view (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::EdgeItem* item READ getItem NOTIFY itemChanged)
     qan::EdgeItem*   getItem() noexcept;
     virtual void     setItem(qan::EdgeItem* edgeItem) noexcept;
 private:
     QPointer<qan::EdgeItem> _item;
+signals:
+    void             itemChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Virtualization *///-----------------------------------------
+    //@{
+public:
+    //! Delegate component and style used to create edge item (set by qan::Graph, used to create item again once released).
+    void                    setItemDelegate(QQmlComponent* component, qan::EdgeStyle* style) noexcept;
+    inline QQmlComponent*   getItemComponent() const noexcept { return _itemComponent.data(); }
+    inline qan::EdgeStyle*  getItemStyle() const noexcept { return _itemStyle.data(); }
+
+    //! Destroy edge item (used by qan::Graph to virtualize edge out of view).
+    void                    releaseItem() noexcept;
+    //! Return edge item without destroying it, edge no longer reference item (used by qan::Graph to pool items).
+    qan::EdgeItem*          detachItem() noexcept;
+private:
+    QPointer<QQmlComponent>     _itemComponent;
+    QPointer<qan::EdgeStyle>    _itemStyle;
     //@}
     //-------------------------------------------------------------------------
 
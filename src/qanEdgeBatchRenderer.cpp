@@ -0,0 +1,431 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+
+// Qt headers
+#include <QtMath>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// QuickQanava headers
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanArrowItem.h"
+#include "./qanEdgeItem.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* EdgeBatchRenderer Object Management *///------------------------------------
+EdgeBatchRenderer::EdgeBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+EdgeBatchRenderer::~EdgeBatchRenderer()
+{
+    clear();
+}
+
+void    EdgeBatchRenderer::setGraph(qan::Graph* graph)
+{
+    if (graph == _graph)
+        return;
+    if (_graph)
+        disconnect(_graph, nullptr, this, nullptr);
+    clear();
+    _graph = graph;
+    if (_graph) {
+        connect(_graph, &qan::Graph::edgeInserted,  this, &EdgeBatchRenderer::onEdgeInserted);
+        connect(_graph, &qan::Graph::edgesInserted, this, &EdgeBatchRenderer::onEdgesInserted);
+        connect(_graph, &qan::Graph::onEdgeRemoved, this, &EdgeBatchRenderer::onEdgeRemoved);
+        connect(_graph, &qan::Graph::edgeItemRealized, this, &EdgeBatchRenderer::onEdgeInserted);   // Virtualized edges
+        connect(_graph, &qan::Graph::nodeGrouped,   this, &EdgeBatchRenderer::onNodeGroupChanged);
+        connect(_graph, &qan::Graph::nodeUngrouped, this, &EdgeBatchRenderer::onNodeGroupChanged);
+        for (const auto edge : _graph->get_edges())
+            onEdgeInserted(edge);
+    }
+    update();
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Batched Edges Management *///-----------------------------------------------
+void    EdgeBatchRenderer::addEdgeItem(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == nullptr ||
+        _slotIds.find(edgeItem) != _slotIds.end())
+        return;
+    int slotId = -1;
+    if (!_freeSlots.empty()) {
+        slotId = _freeSlots.back();
+        _freeSlots.pop_back();
+    } else {
+        slotId = static_cast<int>(_slots.size());
+        _slots.emplace_back();
+    }
+    _slots[slotId] = Slot{edgeItem, 0, 0};
+    _slotIds.emplace(edgeItem, slotId);
+
+    connect(edgeItem, &QObject::destroyed,
+            this,     &EdgeBatchRenderer::onEdgeItemDestroyed);
+    const auto updateItem = [this, edgeItem]() { updateEdgeItem(edgeItem); };
+    connect(edgeItem, &qan::EdgeItem::selectedChanged,  this, updateItem);    // Selected edges are drawn by their item
+    connect(edgeItem, &qan::EdgeItem::hiddenChanged,    this, updateItem);
+    connect(edgeItem, &qan::EdgeItem::visibleChanged,   this, updateItem);
+    connect(edgeItem, &qan::EdgeItem::pooled,           this, [this, edgeItem]() { removeEdgeItem(edgeItem); });
+    updateEdgeItem(edgeItem);
+}
+
+void    EdgeBatchRenderer::removeEdgeItem(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == nullptr)
+        return;
+    const auto slotId = _slotIds.find(edgeItem);
+    if (slotId == _slotIds.end())
+        return;
+    disconnect(edgeItem, nullptr, this, nullptr);
+    edgeItem->setBatchRenderer(nullptr);
+    onEdgeItemDestroyed(edgeItem);  // Release slot
+}
+
+void    EdgeBatchRenderer::onEdgeItemDestroyed(QObject* edgeItem)
+{
+    // Note: edgeItem is not dereferenced, it might be partially destroyed.
+    const auto slotId = _slotIds.find(edgeItem);
+    if (slotId == _slotIds.end())
+        return;
+    auto& slot = _slots[slotId->second];
+    clearVertices(slot.offset, slot.offset + slot.capacity);
+    _garbage += slot.capacity;
+    if (slot.batched) {
+        --_batchedCount;
+        emit edgeCountChanged();
+    }
+    slot = Slot{};
+    _freeSlots.push_back(slotId->second);
+    _slotIds.erase(slotId);
+    update();
+}
+
+void    EdgeBatchRenderer::updateEdgeItem(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == nullptr)
+        return;
+    const auto slotId = _slotIds.find(edgeItem);
+    if (slotId == _slotIds.end())
+        return;
+    const auto style = edgeItem->getStyle();
+    if (style != nullptr &&
+        _styles.insert(style).second) {     // Redraw all edges on style line color or width change
+        connect(style, &qan::EdgeStyle::lineColorChanged,   this, &EdgeBatchRenderer::onStyleModified);
+        connect(style, &qan::EdgeStyle::lineWidthChanged,   this, &EdgeBatchRenderer::onStyleModified);
+        connect(style, &qan::EdgeStyle::dashedChanged,      this, &EdgeBatchRenderer::onStyleModified);   // Dashed edges are not batched
+        connect(style, &QObject::destroyed, this, [this, style]() { _styles.erase(style); });
+    }
+    auto& slot = _slots[slotId->second];
+    const bool batched = isBatchable(*edgeItem);
+    if (batched != slot.batched) {
+        slot.batched = batched;
+        _batchedCount += batched ? 1 : -1;
+        edgeItem->setBatchRenderer(batched ? this : nullptr);
+        emit edgeCountChanged();
+    }
+    if (batched)
+        generateVertices(*edgeItem, _edgeVertices);
+    else
+        _edgeVertices.clear();  // Edge is drawn by its delegate
+    writeSlot(slot, _edgeVertices);
+    update();
+}
+
+bool    EdgeBatchRenderer::isBatchable(const qan::EdgeItem& edgeItem)
+{
+    const auto style = edgeItem.getStyle();
+    if (style != nullptr &&
+        style->getDashed())
+        return false;
+    const auto edge = edgeItem.getEdge();
+    if (edge == nullptr)
+        return true;
+    const auto src = edge->get_src();
+    const auto dst = edge->get_dst();
+    return (src == nullptr || src->getGroup() == nullptr) &&    // Batched edges are drawn at renderer z, grouped
+           (dst == nullptr || dst->getGroup() == nullptr);      // edges would be hidden under their group
+}
+
+void    EdgeBatchRenderer::onNodeGroupChanged(qan::Node* node)
+{
+    if (node == nullptr)
+        return;
+    const auto update = [this](const auto& edges) {
+        for (const auto& edge : edges)
+            if (edge != nullptr)
+                updateEdgeItem(edge->getItem());
+    };
+    update(node->get_in_edges());
+    update(node->get_out_edges());
+}
+
+void    EdgeBatchRenderer::onEdgeInserted(qan::Edge* edge)
+{
+    if (edge != nullptr)
+        addEdgeItem(edge->getItem());
+}
+
+void    EdgeBatchRenderer::onEdgesInserted(QList<qan::Edge*> edges)
+{
+    for (const auto edge : edges)
+        onEdgeInserted(edge);
+}
+
+void    EdgeBatchRenderer::onEdgeRemoved(qan::Edge* edge)
+{
+    if (edge != nullptr)
+        removeEdgeItem(edge->getItem());
+}
+
+void    EdgeBatchRenderer::onStyleModified()
+{
+    for (const auto& slot : _slots)
+        if (slot.edgeItem)
+            updateEdgeItem(slot.edgeItem.data());
+}
+
+void    EdgeBatchRenderer::clear()
+{
+    for (const auto& slot : _slots) {
+        if (slot.edgeItem) {
+            disconnect(slot.edgeItem.data(), nullptr, this, nullptr);
+            slot.edgeItem->setBatchRenderer(nullptr);
+        }
+    }
+    for (const auto style : _styles)
+        disconnect(style, nullptr, this, nullptr);
+    _styles.clear();
+    _slots.clear();
+    _slotIds.clear();
+    _freeSlots.clear();
+    _batchedCount = 0;
+    _vertices.clear();
+    _garbage = 0;
+    _dirtyBegin = _dirtyEnd = 0;
+    _resized = true;
+}
+
+void    EdgeBatchRenderer::generateVertices(const qan::EdgeItem& edgeItem, std::vector<Vertex>& vertices) const
+{
+    vertices.clear();
+    if (!edgeItem.isVisible() ||
+        edgeItem.getHidden() ||
+        edgeItem.getSelected())     // Selected edges are drawn by their item
+        return;
+
+    const auto style = edgeItem.getStyle();
+    const QColor color = style != nullptr ? style->getLineColor() : QColor{0, 0, 0};
+    const qreal lineWidth = style != nullptr ? style->getLineWidth() : 2.;
+    const auto lineType = style != nullptr ? style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    // Note: QSGVertexColorMaterial expect premultiplied colors
+    const int alpha = color.alpha();
+    const auto r = static_cast<uchar>(color.red() * alpha / 255);
+    const auto g = static_cast<uchar>(color.green() * alpha / 255);
+    const auto b = static_cast<uchar>(color.blue() * alpha / 255);
+    const auto a = static_cast<uchar>(alpha);
+
+    const auto vertex = [&vertices, r, g, b, a](const QPointF& p) {
+        Vertex v;
+        v.set(static_cast<float>(p.x()), static_cast<float>(p.y()), r, g, b, a);
+        vertices.push_back(v);
+    };
+    const auto triangle = [&vertex](const QPointF& p1, const QPointF& p2, const QPointF& p3) {
+        vertex(p1);
+        vertex(p2);
+        vertex(p3);
+    };
+    const auto segment = [&triangle](const QPointF& p1, const QPointF& p2, qreal width) {
+        const QPointF d = p2 - p1;
+        const qreal length = std::sqrt(d.x() * d.x() + d.y() * d.y());
+        if (length < 0.0001)
+            return;
+        const QPointF n = QPointF{-d.y(), d.x()} * (width / (2. * length));
+        triangle(p1 + n, p1 - n, p2 + n);
+        triangle(p2 + n, p1 - n, p2 - n);
+    };
+
+    // Edge item geometry is expressed in edge item CS
+    const QPointF origin = edgeItem.mapToItem(this, QPointF{0., 0.});
+    const QPointF p1 = origin + edgeItem.getP1();
+    const QPointF p2 = origin + edgeItem.getP2();
+    switch (lineType) {
+    case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]]
+    case qan::EdgeStyle::LineType::Straight:
+        segment(p1, p2, lineWidth);
+        break;
+    case qan::EdgeStyle::LineType::Ortho: {
+        const auto& points = edgeItem.getOrthoPath();
+        for (int p = 0; p + 1 < points.size(); p++)
+            segment(origin + points[p], origin + points[p + 1], lineWidth);
+    }
+        break;
+    case qan::EdgeStyle::LineType::Curved: {
+        const auto& points = edgeItem.getCurvePolyline().getPoints();
+        for (std::size_t p = 0; p + 1 < points.size(); p++)
+            segment(origin + points[p], origin + points[p + 1], lineWidth);
+    }
+        break;
+    }
+
+    // Arrows are expressed in an arrow CS centered on edge extremity and rotated by arrow angle (see qan::ArrowItem)
+    const auto arrow = [&](qan::ArrowItem::ArrowEnd end, qan::EdgeStyle::ArrowShape shape, const QPointF& center, qreal angle,
+                           const QPointF& a1, const QPointF& a2, const QPointF& a3) {
+        const auto triangles = qan::ArrowItem::getArrowTriangles(end, shape, a1, a2, a3, lineWidth);
+        if (!triangles)
+            return;
+        const qreal radians = qDegreesToRadians(angle);
+        const qreal cos = std::cos(radians);
+        const qreal sin = std::sin(radians);
+        for (const auto& p : *triangles)
+            vertex(center + QPointF{p.x() * cos - p.y() * sin, p.x() * sin + p.y() * cos});
+    };
+    arrow(qan::ArrowItem::ArrowEnd::Destination, edgeItem.getDstShape(), p2, edgeItem.getDstAngle(),
+          edgeItem.getDstA1(), edgeItem.getDstA2(), edgeItem.getDstA3());
+    arrow(qan::ArrowItem::ArrowEnd::Source, edgeItem.getSrcShape(), p1, edgeItem.getSrcAngle(),
+          edgeItem.getSrcA1(), edgeItem.getSrcA2(), edgeItem.getSrcA3());
+}
+
+void    EdgeBatchRenderer::writeSlot(Slot& slot, const std::vector<Vertex>& vertices)
+{
+    const int count = static_cast<int>(vertices.size());
+    if (count > slot.capacity) {    // Relocate slot at the end of buffer with some headroom
+        clearVertices(slot.offset, slot.offset + slot.capacity);
+        _garbage += slot.capacity;
+        slot.capacity = ((count + count / 4 + 2) / 3) * 3;     // Keep whole triangles
+        slot.offset = static_cast<int>(_vertices.size());
+        _vertices.resize(_vertices.size() + static_cast<std::size_t>(slot.capacity));
+        _resized = true;
+    }
+    std::copy(vertices.cbegin(), vertices.cend(), _vertices.begin() + slot.offset);
+    clearVertices(slot.offset + count, slot.offset + slot.capacity);
+    if (_dirtyBegin >= _dirtyEnd) {
+        _dirtyBegin = slot.offset;
+        _dirtyEnd = slot.offset + count;
+    } else {
+        _dirtyBegin = std::min(_dirtyBegin, slot.offset);
+        _dirtyEnd = std::max(_dirtyEnd, slot.offset + count);
+    }
+    if (_garbage > 4096 &&
+        static_cast<std::size_t>(_garbage) * 2 > _vertices.size())
+        compact();
+}
+
+void    EdgeBatchRenderer::clearVertices(int first, int last)
+{
+    if (first >= last)
+        return;
+    Vertex degenerated;
+    degenerated.set(0.f, 0.f, 0, 0, 0, 0);
+    std::fill(_vertices.begin() + first, _vertices.begin() + last, degenerated);
+    if (_dirtyBegin >= _dirtyEnd) {
+        _dirtyBegin = first;
+        _dirtyEnd = last;
+    } else {
+        _dirtyBegin = std::min(_dirtyBegin, first);
+        _dirtyEnd = std::max(_dirtyEnd, last);
+    }
+}
+
+void    EdgeBatchRenderer::compact()
+{
+    std::vector<Vertex> vertices;
+    vertices.reserve(_vertices.size() - static_cast<std::size_t>(_garbage));
+    for (auto& slot : _slots) {
+        if (slot.capacity == 0)
+            continue;
+        const auto offset = static_cast<int>(vertices.size());
+        vertices.insert(vertices.end(), _vertices.cbegin() + slot.offset,
+                        _vertices.cbegin() + slot.offset + slot.capacity);
+        slot.offset = offset;
+    }
+    _vertices.swap(vertices);
+    _garbage = 0;
+    _resized = true;
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+QSGNode*    EdgeBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_vertices.empty()) {
+        delete node;
+        _resized = true;
+        _dirtyBegin = _dirtyEnd = 0;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        _resized = true;
+    }
+
+    // Copy only vertices modified since last update, unless buffer has been resized
+    auto geometry = node->geometry();
+    auto geometryVertices = geometry->vertexDataAsColoredPoint2D();
+    if (_resized ||
+        geometry->vertexCount() != static_cast<int>(_vertices.size())) {
+        geometry->allocate(static_cast<int>(_vertices.size()));
+        geometryVertices = geometry->vertexDataAsColoredPoint2D();
+        std::copy(_vertices.cbegin(), _vertices.cend(), geometryVertices);
+    } else if (_dirtyBegin < _dirtyEnd)
+        std::copy(_vertices.cbegin() + _dirtyBegin, _vertices.cbegin() + _dirtyEnd,
+                  geometryVertices + _dirtyBegin);
+    geometry->markVertexDataDirty();
+    node->markDirty(QSGNode::DirtyGeometry);
+    _resized = false;
+    _dirtyBegin = _dirtyEnd = 0;
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
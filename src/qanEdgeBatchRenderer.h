@@ -0,0 +1,203 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// Qt headers
+#include <QtQml>
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+class EdgeItem;
+class EdgeStyle;
+
+/*! \brief Draw all graph edges lines and arrows from a single scene graph geometry node.
+ *
+ * Default edge delegate (EdgeTemplate.qml) use up to three \c Shape items per edge, with 50k edges
+ * item count and per item scene graph nodes dominate memory and frame time. When an \c EdgeBatchRenderer
+ * is attached to a graph, all straight, ortho and curved edges and their arrows are triangulated in
+ * one vertex buffer. Each edge own a range of vertices (its slot) updated incrementally when its
+ * geometry change (see qan::EdgeItem::applyGeometryCache()).
+ *
+ * Batched edge items are still used for geometry generation and hit testing, but their \c batched
+ * property is true: default edge delegate does not instantiate its shapes, except for selected edges
+ * (selected edges are not drawn by the renderer).
+ *
+ * \note Renderer batch edges drawing only: one qan::EdgeItem is still created per edge (edge items are not
+ * created on demand), use qan::Graph::virtualized to avoid creating items for edges out of view.
+ *
+ * \code
+ *  Qan.GraphView {
+ *    graph: Qan.Graph { id: graph }
+ *  }
+ *  Qan.EdgeBatchRenderer {
+ *    parent: graph.containerItem
+ *    graph: graph
+ *  }
+ * \endcode
+ *
+ * Edges with a \c dashed style and edges with a grouped source or destination node are not batched:
+ * their \c batched property is false and they are drawn by their delegate. All batched edges are drawn
+ * at the renderer z (edges z from qan::EdgeItem::generateGeometryCache() is ignored), grouped edges would
+ * otherwise be hidden by their group background. Batching is re-evaluated when an edge style \c dashed
+ * property change and when an edge node is grouped or ungrouped.
+ *
+ * Batching has the following limitations:
+ *   \li Batched edges are not antialiased: triangles are drawn with a plain vertex color material (enable
+ *       multisampling on the view for smooth edges).
+ *   \li Batched edges are drawn at the renderer z, edges z is ignored (edges are always drawn below or
+ *       above all nodes depending on renderer z).
+ *   \li Batched edges delegates shapes are not instantiated: delegates hover (or any other custom state)
+ *       visual feedback is not visible until the edge is selected (only selection is drawn by the delegate).
+ *
+ * \note Renderer must be a child of graph \c containerItem (it is drawn in graph CS), edges are drawn
+ * with their style \c lineColor and \c lineWidth.
+ *
+ * \nosubgrouping
+ */
+class EdgeBatchRenderer : public QQuickItem
+{
+    /*! \name EdgeBatchRenderer Object Management *///-------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit EdgeBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~EdgeBatchRenderer() override;
+    EdgeBatchRenderer(const EdgeBatchRenderer&) = delete;
+
+public:
+    //! Graph whose edges are drawn by this renderer (all existing and future edges are batched).
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    void                setGraph(qan::Graph* graph);
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Edges Management *///------------------------------------
+    //@{
+public:
+    //! Draw \c edgeItem with this renderer (automatically called for \c graph edges).
+    void            addEdgeItem(qan::EdgeItem* edgeItem);
+    //! Stop drawing \c edgeItem with this renderer (automatically called for \c graph edges).
+    void            removeEdgeItem(qan::EdgeItem* edgeItem);
+    //! Regenerate \c edgeItem vertices (automatically called when a batched edge geometry, style or selection change).
+    void            updateEdgeItem(qan::EdgeItem* edgeItem);
+
+    //! Number of edges actually batched in this renderer (dashed and grouped edges are not counted).
+    Q_PROPERTY(int edgeCount READ getEdgeCount NOTIFY edgeCountChanged FINAL)
+    inline int      getEdgeCount() const noexcept { return _batchedCount; }
+signals:
+    void            edgeCountChanged();
+
+public:
+    //! Size of the batched vertex buffer, including unused vertices in released slots (not yet compacted).
+    inline int      getVertexCount() const noexcept { return static_cast<int>(_vertices.size()); }
+
+private:
+    //! Return true if \c edgeItem can be drawn by this renderer (not dashed and not grouped).
+    static bool     isBatchable(const qan::EdgeItem& edgeItem);
+    int             _batchedCount = 0;
+
+private:
+    void            onEdgeInserted(qan::Edge* edge);
+    void            onNodeGroupChanged(qan::Node* node);
+    void            onEdgesInserted(QList<qan::Edge*> edges);
+    void            onEdgeRemoved(qan::Edge* edge);
+    void            onEdgeItemDestroyed(QObject* edgeItem);
+    void            onStyleModified();
+    void            clear();
+
+private:
+    using Vertex = QSGGeometry::ColoredPoint2D;
+
+    //! Range of vertices owned by an edge in _vertices.
+    struct Slot {
+        QPointer<qan::EdgeItem> edgeItem;
+        int                     offset = 0;
+        int                     capacity = 0;
+        //! True when edge is drawn by this renderer (see isBatchable()).
+        bool                    batched = false;
+    };
+    std::vector<Slot>                           _slots;
+    //! Map edge items to their slot id (slot index in _slots).
+    std::unordered_map<const QObject*, int>     _slotIds;
+    std::vector<int>                            _freeSlots;
+    //! Edge styles already connected to onStyleModified().
+    std::unordered_set<const qan::EdgeStyle*>   _styles;
+
+    //! Generate \c edgeItem vertices (triangles in renderer CS) in \c vertices.
+    void            generateVertices(const qan::EdgeItem& edgeItem, std::vector<Vertex>& vertices) const;
+    //! Copy \c vertices in \c slot, relocating the slot at the end of _vertices if it is too small.
+    void            writeSlot(Slot& slot, const std::vector<Vertex>& vertices);
+    //! Fill [first, last[ vertices range with degenerated triangles.
+    void            clearVertices(int first, int last);
+    //! Pack all slots when more than half of _vertices is unused.
+    void            compact();
+
+    std::vector<Vertex>     _vertices;
+    std::vector<Vertex>     _edgeVertices;      // Temporary buffer used in updateEdgeItem()
+    int                     _garbage = 0;       // Vertices in released or relocated slots ranges
+    int                     _dirtyBegin = 0;    // Vertices range modified since last updatePaintNode()
+    int                     _dirtyEnd = 0;
+    bool                    _resized = true;    // _vertices size changed since last updatePaintNode()
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeBatchRenderer);
@@ -0,0 +1,89 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometry.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QtQml>
+#include <QPointF>
+
+namespace qan { // ::qan
+
+/*! \brief Edge item geometry value type, all points are expressed in edge item CS.
+ *
+ * Expose all qan::EdgeItem geometry with a single \c edgeGeometryChanged() notification, see
+ * qan::EdgeItem::edgeGeometry.
+ */
+struct EdgeGeometry
+{
+    Q_GADGET
+    QML_VALUE_TYPE(edgeGeometry)
+
+    Q_PROPERTY(QPointF p1 MEMBER p1 FINAL)
+    Q_PROPERTY(QPointF p2 MEMBER p2 FINAL)
+    Q_PROPERTY(QPointF c1 MEMBER c1 FINAL)
+    Q_PROPERTY(QPointF c2 MEMBER c2 FINAL)
+    Q_PROPERTY(qreal srcAngle MEMBER srcAngle FINAL)
+    Q_PROPERTY(qreal dstAngle MEMBER dstAngle FINAL)
+    Q_PROPERTY(QPointF srcA1 MEMBER srcA1 FINAL)
+    Q_PROPERTY(QPointF srcA2 MEMBER srcA2 FINAL)
+    Q_PROPERTY(QPointF srcA3 MEMBER srcA3 FINAL)
+    Q_PROPERTY(QPointF dstA1 MEMBER dstA1 FINAL)
+    Q_PROPERTY(QPointF dstA2 MEMBER dstA2 FINAL)
+    Q_PROPERTY(QPointF dstA3 MEMBER dstA3 FINAL)
+public:
+    //! Edge source and destination points.
+    QPointF     p1, p2;
+    //! Edge control points (\c c1 only for ortho edges).
+    QPointF     c1, c2;
+    //! Source and destination arrows angles (in degrees).
+    qreal       srcAngle = 0., dstAngle = 0.;
+    //! Source and destination arrows points.
+    QPointF     srcA1, srcA2, srcA3;
+    QPointF     dstA1, dstA2, dstA3;
+
+    bool        operator==(const EdgeGeometry& rhs) const noexcept {
+        return p1 == rhs.p1 && p2 == rhs.p2 &&
+               c1 == rhs.c1 && c2 == rhs.c2 &&
+               qFuzzyCompare(1. + srcAngle, 1. + rhs.srcAngle) &&
+               qFuzzyCompare(1. + dstAngle, 1. + rhs.dstAngle) &&
+               srcA1 == rhs.srcA1 && srcA2 == rhs.srcA2 && srcA3 == rhs.srcA3 &&
+               dstA1 == rhs.dstA1 && dstA2 == rhs.dstA2 && dstA3 == rhs.dstA3;
+    }
+    inline bool operator!=(const EdgeGeometry& rhs) const noexcept { return !(*this == rhs); }
+};
+
+} // ::qan
+
+Q_DECLARE_METATYPE(qan::EdgeGeometry)
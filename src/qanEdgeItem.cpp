@@ -44,8 +44,7 @@
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
 #include "./qanEdgeDraggableCtrl.h"
-
-#include "./bezier/include/bezier.h"
+#include "./qanEdgeBatchRenderer.h"
 
 namespace qan { // ::qan
 
@@ -73,15 +72,23 @@ EdgeItem::EdgeItem(QQuickItem* parent) :
             this,   &qan::EdgeItem::onHeightChanged);
 }
 
+EdgeItem::~EdgeItem()
+{
+    if (_graph)     // Routes are indexed by edge item, remove it before it become dangling
+        _graph->getOrthoRouter().removeRoute(this);
+}
+
 auto    EdgeItem::getEdge() noexcept -> qan::Edge* { return _edge.data(); }
 auto    EdgeItem::getEdge() const noexcept -> const qan::Edge* { return _edge.data(); }
 auto    EdgeItem::setEdge(qan::Edge* edge) noexcept -> void
 {
     if (_edge != edge) {
         _edge = edge;
-        edge->setItem(this);
+        if (edge != nullptr)
+            edge->setItem(this);
         const auto edgeDraggableCtrl = static_cast<EdgeDraggableCtrl*>(_draggableCtrl.get());
         edgeDraggableCtrl->setTarget(edge);
+        emit edgeChanged();
     }
 }
 
@@ -210,6 +217,14 @@ void    EdgeItem::setHidden(bool hidden) noexcept
     }
 }
 
+void    EdgeItem::setBatchRenderer(qan::EdgeBatchRenderer* batchRenderer) noexcept
+{
+    if (batchRenderer != _batchRenderer) {
+        _batchRenderer = batchRenderer;
+        emit batchedChanged();
+    }
+}
+
 void    EdgeItem::setArrowSize( qreal arrowSize ) noexcept
 {
     if (!qFuzzyCompare(1. + arrowSize, 1. + _arrowSize)) {
@@ -241,14 +256,34 @@ auto    EdgeItem::setDstShape(ArrowShape dstShape) noexcept -> bool
     return false;
 }
 
+void    EdgeItem::scheduleUpdateItem() noexcept
+{
+    if (_updateScheduled)   // Already dirty, will be updated before next frame
+        return;
+    auto graph = getGraph();
+    if (graph != nullptr &&
+        graph->window() != nullptr) {
+        _updateScheduled = true;
+        graph->scheduleEdgeUpdate(this);
+    } else
+        updateItem();
+}
+
 void    EdgeItem::updateItem() noexcept
+{
+    _updateScheduled = false;   // A pending scheduled update is no longer necessary
+    auto cache = generateGeometryCache();
+    generateGeometry(cache);
+    applyGeometryCache(cache);
+}
+
+void    EdgeItem::generateGeometry(GeometryCache& cache) const noexcept
 {
     // Algorithm:
         // Generate cache step by step until it become invalid.
-        // 1. Generate                 srcBr / dstBr / srcBrCenter / dstBrCenter / z
+        // 1. Generate                 srcBr / dstBr / srcBrCenter / dstBrCenter / z (generateGeometryCache())
         // 2. generate edge ends:      P1 / P2
         // 3. generate control points: C1 / C2
-    auto cache = generateGeometryCache();       // 1.
     if (cache.isValid()) {
         switch (cache.lineType) {               // 2.
         case qan::EdgeStyle::LineType::Undefined:       // [[fallthrough]] default to Straight
@@ -267,13 +302,31 @@ void    EdgeItem::updateItem() noexcept
             generateLabelPosition(cache);
         }
     }
+}
 
+void    EdgeItem::applyGeometryCache(const GeometryCache& cache) noexcept
+{
     // A valid geometry has been generated, generate a bounding box for edge,
     // and project all geometry in edge CS.
     if (cache.isValid())
         applyGeometry(cache);
     else
         setHidden(true);
+
+    // Register routed ortho edges path in graph ortho router (in graph CS) to re-route them on obstacles changes
+    auto graph = getGraph();
+    if (graph != nullptr) {
+        if (cache.router != nullptr &&
+            cache.isValid() && !cache.hidden) {
+            if (cache.orthoPath.size() > 2)
+                graph->getOrthoRouter().setRoute(this, cache.orthoPath);
+            else
+                graph->getOrthoRouter().setRoute(this, {cache.p1, cache.c1, cache.p2});
+        } else
+            graph->getOrthoRouter().removeRoute(this);
+    }
+    if (_batchRenderer)
+        _batchRenderer->updateEdgeItem(this);
 }
 
 EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
@@ -285,6 +338,14 @@ EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     srcBr{std::move(rha.srcBr)},    dstBr{std::move(rha.dstBr)},
     srcBrCenter{std::move(rha.srcBrCenter)},
     dstBrCenter{std::move(rha.dstBrCenter)},
+    arrowSize{rha.arrowSize},
+    srcShape{rha.srcShape},         dstShape{rha.dstShape},
+    srcPort{rha.srcPort},           dstPort{rha.dstPort},
+    srcDock{rha.srcDock},           dstDock{rha.dstDock},
+    srcClip{std::move(rha.srcClip)},
+    dstClip{std::move(rha.dstClip)},
+    router{rha.router},
+    srcKey{rha.srcKey},             dstKey{rha.dstKey},
     p1{std::move(rha.p1)},          p2{std::move(rha.p2)},
     dstA1{std::move(rha.dstA1)},
     dstA2{std::move(rha.dstA2)},
@@ -295,6 +356,7 @@ EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     srcA3{std::move(rha.srcA3)},
     srcAngle{rha.srcAngle},
     c1{std::move(rha.c1)},          c2{std::move(rha.c2)},
+    orthoPath{std::move(rha.orthoPath)},
     labelPosition{std::move(rha.labelPosition)}
 {
     srcItem.swap(rha.srcItem);
@@ -302,6 +364,37 @@ EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     rha.valid = false;
 }
 
+namespace { // ::
+
+/*! \brief Return \c nodeItem shared clip polygon with its origin in \c graphContainerItem CS.
+ *
+ * Shared clip polygon is used only when item is translated (not scaled nor rotated) in graph CS, otherwise
+ * a dedicated clip polygon is generated from \c bs, item bounding shape in graph CS.
+ */
+qan::EdgeItem::GeometryCache::Clip  generateClip(qan::NodeItem& nodeItem, const QQuickItem& graphContainerItem,
+                                                 const QPolygonF& bs)
+{
+    const QPointF origin = nodeItem.mapToItem(&graphContainerItem, QPointF{0., 0.});
+    const QPointF unit = nodeItem.mapToItem(&graphContainerItem, QPointF{1., 1.}) - origin;
+    if (qFuzzyCompare(unit.x(), 1.) &&
+        qFuzzyCompare(unit.y(), 1.))
+        return {nodeItem.getClipPolygon(), origin};
+    return {std::make_shared<const qan::ClipPolygon>(bs), QPointF{0., 0.}};
+}
+
+} // ::
+
+bool    EdgeItem::GeometryCache::Clip::intersect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept
+{
+    if (!polygon)
+        return false;
+    QPointF localIntersection;
+    if (!polygon->intersect(p1 - origin, p2 - origin, localIntersection))
+        return false;
+    intersection = localIntersection + origin;
+    return true;
+}
+
 EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
 {
     // PRECONDITIONS:
@@ -381,6 +474,7 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
             int p = 0;
             for (const auto& point: srcBs)
                 cache.srcBs[p++] = _sourceItem->mapToItem(graphContainerItem, point);
+            cache.srcClip = generateClip(*_sourceItem, *graphContainerItem, cache.srcBs);
         }
         // Generate destination bounding shape polygon
         if (dstNodeItem != nullptr) {        // Regular Node -> Node edge
@@ -390,6 +484,7 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
             int p = 0;
             for (const auto& point: dstBs)
                 cache.dstBs[p++] = dstNodeItem->mapToItem(graphContainerItem, point);
+            cache.dstClip = generateClip(*dstNodeItem, *graphContainerItem, cache.dstBs);
         }
     }
 
@@ -401,8 +496,8 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
     }
 
     // Generate edge geometry Z according to actual src and dst z
-    const qreal srcZ = qan::getItemGlobalZ_rec(srcItem);
-    const qreal dstZ = qan::getItemGlobalZ_rec(dstItem);
+    const qreal srcZ = _sourceItem->getGlobalZ();     // Cached, see qan::NodeItem::getGlobalZ()
+    const qreal dstZ = dstNodeItem->getGlobalZ();
     cache.z = qMax(srcZ, dstZ) - 0.1;   // Edge z value should be less than src/dst value to ensure port item and selection is on top of edge
 
     if (_style)
@@ -418,6 +513,29 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
     cache.srcBrCenter = srcBrCenter;
     cache.dstBrCenter = dstBrCenter;
 
+    // Copy edge style and ports configuration, geometry generation must not access any QObject
+    cache.arrowSize = getArrowSize();
+    cache.srcShape = getSrcShape();
+    cache.dstShape = getDstShape();
+    const auto srcPort = qobject_cast<const qan::PortItem*>(srcItem);
+    if (srcPort != nullptr) {
+        cache.srcPort = true;
+        cache.srcDock = srcPort->getDockType();
+    }
+    const auto dstPort = qobject_cast<const qan::PortItem*>(dstItem);
+    if (dstPort != nullptr) {
+        cache.dstPort = true;
+        cache.dstDock = dstPort->getDockType();
+    }
+    if (cache.lineType == qan::EdgeStyle::LineType::Ortho &&   // Ports edges are docked, they are not routed
+        !cache.srcPort && !cache.dstPort &&
+        getGraph() != nullptr &&
+        getGraph()->getOrthoRouting()) {
+        cache.router = &getGraph()->getOrthoRouter();
+        cache.srcKey = _sourceItem.data();
+        cache.dstKey = dstNodeItem;
+    }
+
     cache.valid = true;  // Finally, validate cache
     return cache;        // Expecting RVO
 }
@@ -430,13 +548,16 @@ void    EdgeItem::generateStraightEnds(GeometryCache& cache) const noexcept
     if (!cache.isValid())
         return;
 
-    const QLineF line = getLineIntersection(cache.srcBrCenter, cache.dstBrCenter,
-                                            cache.srcBs, cache.dstBs);
+    QPointF source{cache.srcBrCenter};
+    cache.srcClip.intersect(cache.srcBrCenter, cache.dstBrCenter, source);
+    QPointF destination{cache.dstBrCenter};
+    cache.dstClip.intersect(cache.srcBrCenter, cache.dstBrCenter, destination);
+    const QLineF line{source, destination};
 
     // Update hidden: Edge is hidden if it's size is less than the src/dst shape size sum
     {
         {
-            const auto arrowSize = getArrowSize();
+            const auto arrowSize = cache.arrowSize;
             const auto arrowLength = arrowSize * 3.;
             if (line.length() < 2.0 + arrowLength)
                 cache.hidden = true;
@@ -508,13 +629,10 @@ void    EdgeItem::generateStraightEnds(GeometryCache& cache) const noexcept
             return c; // Expect RVO
         }; // correctPortPoint()
 
-        const auto srcPort = qobject_cast<const qan::PortItem*>(cache.srcItem);
-        if (srcPort != nullptr)
-            cache.p1 = correctPortPoint(cache, srcPort->getDockType(), p1, cache.srcBrCenter, cache.srcBr );
-
-        const auto dstPort = qobject_cast<const qan::PortItem*>(cache.dstItem);
-        if (dstPort != nullptr)
-            cache.p2 = correctPortPoint(cache, dstPort->getDockType(), p2, cache.dstBrCenter, cache.dstBr );
+        if (cache.srcPort)
+            cache.p1 = correctPortPoint(cache, cache.srcDock, p1, cache.srcBrCenter, cache.srcBr );
+        if (cache.dstPort)
+            cache.p2 = correctPortPoint(cache, cache.dstDock, p2, cache.dstBrCenter, cache.dstBr );
     } // dock configuration block
 }
 
@@ -539,6 +657,19 @@ void    EdgeItem::generateOrthoEnds(GeometryCache& cache) const noexcept
             // 2.1 Check if we have a more "horiz" or "vert" edge to generate
             // 2.1 Generate P1 control point according to pair {(TR, BR, BL, TL), (horiz, vert)}
 
+    // 0. Route edge around obstacles when graph ortho routing is enabled, fallback to default geometry if there is no route
+    if (cache.router != nullptr) {
+        auto route = cache.router->route(cache.srcBr, cache.dstBr, cache.srcKey, cache.dstKey);
+        if (route.size() >= 2) {
+            cache.p1 = route.front();
+            cache.p2 = route.back();
+            cache.c1 = route.size() > 2 ? route[1] : QLineF{cache.p1, cache.p2}.center();
+            if (route.size() > 2)
+                cache.orthoPath = std::move(route);
+            return;
+        }
+    }
+
     // 1.
     if (cache.srcBrCenter.y() > cache.dstBr.top() &&            // Horizontal line
         cache.srcBrCenter.y() < cache.dstBr.bottom() ) {
@@ -620,7 +751,7 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
     if (!cache.isValid())
         return;
 
-    const qreal arrowSize = getArrowSize();
+    const qreal arrowSize = cache.arrowSize;
     const qreal arrowLength = arrowSize * 3.;
 
     // Prepare points and helper variables
@@ -637,7 +768,7 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
     cache.dstA2 = pointA2;
 
     // Update source arrow cache points
-    const auto srcShape = getSrcShape();
+    const auto srcShape = cache.srcShape;
     switch (srcShape) {
         case qan::EdgeItem::ArrowShape::Arrow:      // [[fallthrough]]
         case qan::EdgeItem::ArrowShape::ArrowOpen:
@@ -656,7 +787,7 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
         // No default, anyway the cache will be invalid
     }
     // Update destination arrow cache points
-    const auto dstShape = getDstShape();
+    const auto dstShape = cache.dstShape;
     switch (dstShape) {
         case qan::EdgeItem::ArrowShape::Arrow:      // [[fallthrough]]
         case qan::EdgeItem::ArrowShape::ArrowOpen:
@@ -684,8 +815,17 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
             break;
 
         case qan::EdgeStyle::LineType::Ortho:
-            cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
+            if (cache.orthoPath.size() > 2) {   // Routed edge: use first and last path segments
+                QPointF dstFrom = cache.orthoPath[cache.orthoPath.size() - 2];
+                QPointF srcFrom = cache.orthoPath[1];
+                cache.dstAngle = generateStraightArrowAngle(dstFrom, cache.p2, dstShape, arrowLength);
+                cache.srcAngle = generateStraightArrowAngle(srcFrom, cache.p1, srcShape, arrowLength);
+                cache.orthoPath.front() = cache.p1;
+                cache.orthoPath.back() = cache.p2;
+            } else {
+                cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
+                cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
+            }
             break;
 
         case qan::EdgeStyle::LineType::Curved:
@@ -757,8 +897,8 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
     if ( cache.lineType != qan::EdgeStyle::LineType::Curved )
         return;
 
-    const auto srcPort = qobject_cast<const qan::PortItem*>(cache.srcItem);
-    const auto dstPort = qobject_cast<const qan::PortItem*>(cache.dstItem);
+    const bool srcPort = cache.srcPort;
+    const bool dstPort = cache.dstPort;
 
     const auto xDelta = cache.p2.x() - cache.p1.x();
     const auto xDeltaAbs = std::abs(xDelta);
@@ -768,8 +908,8 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
     const QLineF line{cache.p1, cache.p2};
     const auto lineLength = line.length();
 
-    if ( srcPort == nullptr ||      // If there is a connection to a non-port item, generate a control point for it
-         dstPort == nullptr ) {
+    if ( !srcPort ||      // If there is a connection to a non-port item, generate a control point for it
+         !dstPort ) {
 
         // Invert if:
             // Top left quarter:     do not invert (xDelta < 0 && yDelta < 0)
@@ -795,13 +935,13 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
         const QPointF center{ ( cache.p1.x() + cache.p2.x() ) / 2.,           // (P1,P2) Line center
                               ( cache.p1.y() + cache.p2.y() ) / 2. };
 
-        if ( srcPort == nullptr )
+        if ( !srcPort )
             cache.c1 = center + offset;
-        if ( dstPort == nullptr )
+        if ( !dstPort )
             cache.c2 = center - offset;
     }
-    if ( srcPort != nullptr ||      // If there is a connection to a port item, generate a control point for it
-         dstPort != nullptr ) {
+    if ( srcPort ||      // If there is a connection to a port item, generate a control point for it
+         dstPort ) {
         static constexpr qreal maxOffset = 40.;
         auto offset = [](auto deltaAbs) -> auto {
             // Heuristic: for [0, maxOffset] delta, return a percentage of maxOffset, return value
@@ -888,26 +1028,26 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
                                              { 0,  0, -1,  0, 0 },    // Dock::Bottom
                                              { 0,  0,  0,  0, 0 } };   // None
 
-        unsigned int previous = srcPort != nullptr ? static_cast<unsigned int>(srcPort->getDockType()) : 4;;  // 4 = None
-        unsigned int next = dstPort != nullptr ? static_cast<unsigned int>(dstPort->getDockType()) : 4;      // 4 = None
+        unsigned int previous = srcPort ? static_cast<unsigned int>(cache.srcDock) : 4;  // 4 = None
+        unsigned int next = dstPort ? static_cast<unsigned int>(cache.dstDock) : 4;      // 4 = None
 
         using Dock = qan::NodeItem::Dock;
         const double xSmooth = qBound(-100., xDelta, 100.) / 100.;
         const double ySmooth = qBound(-100., yDelta, 100.) / 100.;
-        if ( srcPort != nullptr ) {     // Generate control point for src (C1)
+        if ( srcPort ) {     // Generate control point for src (C1)
             const auto xCorrectionFinal = xCorrection * xCorrect[previous][next] * ySmooth;
             const auto yCorrectionFinal = yCorrection * yCorrect[previous][next] * xSmooth;
-            switch ( srcPort->getDockType() ) {
+            switch ( cache.srcDock ) {
             case Dock::Left:     cache.c1 = cache.p1 + QPointF{ -xOffset,           yCorrectionFinal  };  break;
             case Dock::Top:      cache.c1 = cache.p1 + QPointF{ xCorrectionFinal,  -yOffset      };  break;
             case Dock::Right:    cache.c1 = cache.p1 + QPointF{ xOffset,            yCorrectionFinal  };  break;
             case Dock::Bottom:   cache.c1 = cache.p1 + QPointF{ xCorrectionFinal,   yOffset      };  break;
             }
         }
-        if ( dstPort != nullptr ) {     // Generate control point for dst (C2)
+        if ( dstPort ) {     // Generate control point for dst (C2)
             const auto xCorrectionFinal = xCorrection * xCorrect[previous][next] * ySmooth;
             const auto yCorrectionFinal = yCorrection * yCorrect[previous][next] * xSmooth;
-            switch ( dstPort->getDockType() ) {
+            switch ( cache.dstDock ) {
             case Dock::Left:     cache.c2 = cache.p2 + QPointF{ -xOffset,           yCorrectionFinal };  break;
             case Dock::Top:      cache.c2 = cache.p2 + QPointF{ xCorrectionFinal,   -yOffset    };  break;
             case Dock::Right:    cache.c2 = cache.p2 + QPointF{ xOffset,            yCorrectionFinal };  break;
@@ -917,8 +1057,12 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
     }
 
     // Finally, modify p1 and p2 according to c1 and c2
-    cache.p1 = getLineIntersection( cache.c1, cache.srcBrCenter, cache.srcBs);
-    cache.p2 = getLineIntersection( cache.c2, cache.dstBrCenter, cache.dstBs);
+    QPointF p1{cache.c1};
+    cache.srcClip.intersect(cache.c1, cache.srcBrCenter, p1);
+    cache.p1 = p1;
+    QPointF p2{cache.c2};
+    cache.dstClip.intersect(cache.c2, cache.dstBrCenter, p2);
+    cache.p2 = p2;
 }
 
 
@@ -961,42 +1105,96 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
         edgeBrPolygon << cache.p1 << cache.p2;
         if (cache.lineType == qan::EdgeStyle::LineType::Curved)
             edgeBrPolygon << cache.c1 << cache.c2;
+        else if (cache.lineType == qan::EdgeStyle::LineType::Ortho) {
+            edgeBrPolygon << cache.c1;
+            for (const auto& p : cache.orthoPath)
+                edgeBrPolygon << p;
+        }
         const QRectF edgeBr = edgeBrPolygon.boundingRect();
         setPosition(edgeBr.topLeft());    // Note: setPosition() call must occurs before mapFromItem()
         setSize(edgeBr.size());
 
-        _p1 = mapFromItem(graphContainerItem, cache.p1);
-        _p2 = mapFromItem(graphContainerItem, cache.p2);
-        emit lineGeometryChanged();
-
-        {   // Apply arrow geometry
-            _dstAngle = cache.dstAngle;
-            emit dstAngleChanged(); // Note: Update dstAngle before arrow geometry.
-
-            _dstA1 = cache.dstA1;    // Arrow geometry is already expressed in edge "local CS"
-            _dstA2 = cache.dstA2;
-            _dstA3 = cache.dstA3;
-            emit dstArrowGeometryChanged();
-
-            _srcAngle = cache.srcAngle;
-            emit srcAngleChanged(); // Note: Update srcAngle before arrow geometry.
-
-            _srcA1 = cache.srcA1;    // Arrow geometry is already expressed in edge "local CS"
-            _srcA2 = cache.srcA2;
-            _srcA3 = cache.srcA3;
-            emit srcArrowGeometryChanged();
-        }
-
-        // Apply control point geometry
+        // Apply line, arrows and control points geometry, notify only modified geometry
             // For otho edge: 3 points for a line P1 -> C1 -> P2
             // For Curved edge: a cubic spline with C1 and C2
+        qan::EdgeGeometry geometry;
+        geometry.p1 = mapFromItem(graphContainerItem, cache.p1);
+        geometry.p2 = mapFromItem(graphContainerItem, cache.p2);
+        // Arrow geometry is already expressed in edge "local CS"
+        geometry.srcAngle = cache.srcAngle;
+        geometry.srcA1 = cache.srcA1;
+        geometry.srcA2 = cache.srcA2;
+        geometry.srcA3 = cache.srcA3;
+        geometry.dstAngle = cache.dstAngle;
+        geometry.dstA1 = cache.dstA1;
+        geometry.dstA2 = cache.dstA2;
+        geometry.dstA3 = cache.dstA3;
+        geometry.c1 = _c1;      // Control points are left unmodified for straight edges
+        geometry.c2 = _c2;
+        QPolygonF orthoPath;
         if (cache.lineType == qan::EdgeStyle::LineType::Ortho) {
-            _c1 = mapFromItem(graphContainerItem, cache.c1);
-            emit controlPointsChanged();
-        } else if (cache.lineType == qan::EdgeStyle::LineType::Curved) { // Apply control point geometry
-            _c1 = mapFromItem(graphContainerItem, cache.c1);
-            _c2 = mapFromItem(graphContainerItem, cache.c2);
-            emit controlPointsChanged();
+            geometry.c1 = mapFromItem(graphContainerItem, cache.c1);
+            if (cache.orthoPath.size() > 2) {
+                orthoPath.reserve(static_cast<int>(cache.orthoPath.size()));
+                for (const auto& p : cache.orthoPath)
+                    orthoPath << mapFromItem(graphContainerItem, p);
+            } else
+                orthoPath << geometry.p1 << geometry.c1 << geometry.p2;
+        } else if (cache.lineType == qan::EdgeStyle::LineType::Curved) {
+            geometry.c1 = mapFromItem(graphContainerItem, cache.c1);
+            geometry.c2 = mapFromItem(graphContainerItem, cache.c2);
+        }
+
+        const bool geometryModified = geometry != getEdgeGeometry() ||
+                                      orthoPath != _orthoPath;
+        // Note: Modified parts are detected only for deprecated per part signals
+        const bool lineModified = geometryModified &&
+                                  (geometry.p1 != _p1 || geometry.p2 != _p2);
+        const bool controlPointsModified = geometryModified &&
+                                           (geometry.c1 != _c1 || geometry.c2 != _c2 || orthoPath != _orthoPath);
+        const bool srcAngleModified = geometryModified &&
+                                      !qFuzzyCompare(1. + geometry.srcAngle, 1. + _srcAngle);
+        const bool srcArrowModified = geometryModified &&
+                                      (geometry.srcA1 != _srcA1 || geometry.srcA2 != _srcA2 || geometry.srcA3 != _srcA3);
+        const bool dstAngleModified = geometryModified &&
+                                      !qFuzzyCompare(1. + geometry.dstAngle, 1. + _dstAngle);
+        const bool dstArrowModified = geometryModified &&
+                                      (geometry.dstA1 != _dstA1 || geometry.dstA2 != _dstA2 || geometry.dstA3 != _dstA3);
+        if (geometryModified) {
+            _p1 = geometry.p1;
+            _p2 = geometry.p2;
+            _c1 = geometry.c1;
+            _c2 = geometry.c2;
+            _srcAngle = geometry.srcAngle;
+            _srcA1 = geometry.srcA1;
+            _srcA2 = geometry.srcA2;
+            _srcA3 = geometry.srcA3;
+            _dstAngle = geometry.dstAngle;
+            _dstA1 = geometry.dstA1;
+            _dstA2 = geometry.dstA2;
+            _dstA3 = geometry.dstA3;
+            _orthoPath = std::move(orthoPath);
+        }
+        if (cache.lineType == qan::EdgeStyle::LineType::Curved) {
+            if (geometryModified ||
+                _curvePolyline.getPoints().empty())
+                _curvePolyline.reset(_p1, _c1, _c2, _p2);
+        } else
+            _curvePolyline.clear();
+        if (geometryModified) {
+            emit edgeGeometryChanged();
+            if (lineModified)
+                emit lineGeometryChanged();
+            if (controlPointsModified)
+                emit controlPointsChanged();
+            if (dstAngleModified)
+                emit dstAngleChanged();   // Note: Notify dstAngle before arrow geometry.
+            if (dstArrowModified)
+                emit dstArrowGeometryChanged();
+            if (srcAngleModified)
+                emit srcAngleChanged();   // Note: Notify srcAngle before arrow geometry.
+            if (srcArrowModified)
+                emit srcArrowGeometryChanged();
         }
 
         setZ(cache.z);
@@ -1026,9 +1224,28 @@ void    EdgeItem::setLine( QPoint src, QPoint dst )
 {
     _p1 = src;
     _p2 = dst;
+    emit edgeGeometryChanged();
     emit lineGeometryChanged();
 }
 
+qan::EdgeGeometry   EdgeItem::getEdgeGeometry() const noexcept
+{
+    qan::EdgeGeometry geometry;
+    geometry.p1 = _p1;
+    geometry.p2 = _p2;
+    geometry.c1 = _c1;
+    geometry.c2 = _c2;
+    geometry.srcAngle = _srcAngle;
+    geometry.dstAngle = _dstAngle;
+    geometry.srcA1 = _srcA1;
+    geometry.srcA2 = _srcA2;
+    geometry.srcA3 = _srcA3;
+    geometry.dstA1 = _dstA1;
+    geometry.dstA2 = _dstA2;
+    geometry.dstA3 = _dstA3;
+    return geometry;
+}
+
 QPointF  EdgeItem::getLineIntersection(const QPointF& p1, const QPointF& p2,
                                        const QPolygonF& polygon) const noexcept
 {
@@ -1068,6 +1285,24 @@ QLineF  EdgeItem::getLineIntersection( const QPointF& p1, const QPointF& p2,
     }
     return QLineF{source, destination};
 }
+
+QPointF  EdgeItem::getLineIntersection(const QPointF& p1, const QPointF& p2,
+                                       const qan::ClipPolygon& polygon) const noexcept
+{
+    QPointF source{p1};
+    polygon.intersect(p1, p2, source);
+    return source;
+}
+
+QLineF  EdgeItem::getLineIntersection(const QPointF& p1, const QPointF& p2,
+                                      const qan::ClipPolygon& srcBp, const qan::ClipPolygon& dstBp) const noexcept
+{
+    QPointF source{p1};
+    srcBp.intersect(p1, p2, source);
+    QPointF destination{p2};
+    dstBp.intersect(p1, p2, destination);
+    return QLineF{source, destination};
+}
 //-----------------------------------------------------------------------------
 
 
@@ -1300,32 +1535,15 @@ bool    EdgeItem::contains(const QPointF& point) const
         d = distanceFromLine(point, QLineF{_p1, _p2});
         r = (d > -0.001 && d < 6.001);
         break;
-    case qan::EdgeStyle::LineType::Curved: {
-        bezier::Bezier<3> cubicBezier({{static_cast<float>(_p1.x()), static_cast<float>(_p1.y())},
-                                       {static_cast<float>(_c1.x()), static_cast<float>(_c1.y())},
-                                       {static_cast<float>(_c2.x()), static_cast<float>(_c2.y())},
-                                       {static_cast<float>(_p2.x()), static_cast<float>(_p2.y())}});
-        // FIXME: check p in cubicBezier.tbb() (aka Tight bounding box)
-        // FIXME: At least, adapt steps to tbb.length() / thresold (here 6)
-        const auto steps = 25;
-        const auto dStep = 1.0 / static_cast<float>(steps);
-        for (int step = 0; step < steps; step++) {
-            const auto pos = dStep * step;
-            auto curveP = cubicBezier.valueAt(pos);
-            const auto d = QLineF{point, QPointF{curveP.x, curveP.y}}.length();
-            if (d > -0.001 && d < 6.001) {
-                r = true;
-                break;
-            }
-        }
-    }
+    case qan::EdgeStyle::LineType::Curved:
+        // Flattened curve is generated in applyGeometry(), with a tight bounding rect for fast rejection
+        r = _curvePolyline.contains(point, 6.001);
         break;
     case qan::EdgeStyle::LineType::Ortho:
-        d = distanceFromLine(point, QLineF{_p1, _c1});
-        r = (d > -0.001 && d < 6.001);
-        if (!r) {
-            const qreal d2 = distanceFromLine(point, QLineF{_p2, _c1});
-            r = (d2 > -0.001 && d2 < 6.001);
+        // Ortho path is P1 -> C1 -> P2, or P1 -> bends -> P2 for routed edges
+        for (int s = 1; !r && s < _orthoPath.size(); ++s) {
+            d = distanceFromLine(point, QLineF{_orthoPath[s - 1], _orthoPath[s]});
+            r = (d > -0.001 && d < 6.001);
         }
         break;
     }
@@ -39,6 +39,8 @@
 
 // QuickQanava headers
 #include "./qanStyle.h"
+#include "./qanIntersection.h"
+#include "./qanEdgeGeometry.h"
 #include "./qanNodeItem.h"
 #include "./qanSelectable.h"
 
@@ -47,6 +49,8 @@ namespace qan { // ::qan
 class Graph;
 class Edge;
 class NodeItem;
+class EdgeBatchRenderer;
+class OrthoRouter;
 
 /*! \brief Weighted directed edge linking two nodes in a graph.
  *
@@ -64,16 +68,23 @@ class EdgeItem : public QQuickItem,
     Q_INTERFACES(qan::Selectable)
 public:
     explicit EdgeItem(QQuickItem* parent = nullptr);
-    virtual ~EdgeItem() override = default;
+    virtual ~EdgeItem() override;
     EdgeItem(const EdgeItem&) = delete;
 
 public:
-    Q_PROPERTY(qan::Edge* edge READ getEdge CONSTANT FINAL)
+    Q_PROPERTY(qan::Edge* edge READ getEdge NOTIFY edgeChanged FINAL)
     auto        getEdge() noexcept -> qan::Edge*;
     auto        getEdge() const noexcept -> const qan::Edge*;
     auto        setEdge(qan::Edge* edge) noexcept -> void;
 private:
     QPointer<qan::Edge>    _edge;
+signals:
+    //! Emitted when item is bound to another edge (see qan::Graph::reuseItems).
+    void        edgeChanged();
+    //! Emitted when item is stored in its graph items pool, item is hidden and no longer bound to an edge (see qan::Graph::reuseItems).
+    void        pooled();
+    //! Emitted when a pooled item is bound to a new edge, just before it is shown again.
+    void        reused();
 
 public:
     Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged)
@@ -131,6 +142,21 @@ signals:
 private:
     bool        _hidden = false;
 
+public:
+    /*! \brief True when this edge lines and arrows are drawn by a qan::EdgeBatchRenderer.
+     *
+     * Default edge delegate does not create its shapes for batched edges (except when the edge is
+     * selected, selected edges are not drawn by the batch renderer).
+     */
+    Q_PROPERTY(bool batched READ getBatched NOTIFY batchedChanged FINAL)
+    inline bool getBatched() const noexcept { return !_batchRenderer.isNull(); }
+    //! Set the batch renderer drawing this edge (called from qan::EdgeBatchRenderer, \c nullptr to disable batching).
+    void        setBatchRenderer(qan::EdgeBatchRenderer* batchRenderer) noexcept;
+signals:
+    void        batchedChanged();
+private:
+    QPointer<qan::EdgeBatchRenderer>    _batchRenderer;
+
 public:
     Q_PROPERTY(qreal arrowSize READ getArrowSize WRITE setArrowSize NOTIFY arrowSizeChanged FINAL)
     void            setArrowSize( qreal arrowSize ) noexcept;
@@ -170,16 +196,44 @@ signals:
     void                dstShapeChanged();
 
 public slots:
-    //! Call updateItem() (override updateItem() to an empty method for invisible edges).
-    virtual void        updateItemSlot() { updateItem(); }
+    //! Schedule a coalesced updateItem() call with scheduleUpdateItem() (override updateItem() to an empty method for invisible edges).
+    virtual void        updateItemSlot() { scheduleUpdateItem(); }
+public:
+    /*! \brief Mark edge geometry dirty, updateItem() will be called once before next frame.
+     *
+     * Source and destination x, y, z, width and height changes are coalesced: edge geometry is
+     * generated only once per frame whatever the number of endpoints properties modified (see
+     * qan::Graph::scheduleEdgeUpdate()).
+     *
+     * \note updateItem() is called immediately when the edge has no graph or graph is not in a window.
+     */
+    void                scheduleUpdateItem() noexcept;
+    //! Return true if an updateItem() call has been scheduled with scheduleUpdateItem() and is still pending.
+    inline bool         isUpdateScheduled() const noexcept { return _updateScheduled; }
+private:
+    friend class qan::Graph;
+    //! \copydoc isUpdateScheduled()
+    bool                _updateScheduled = false;
+
 public:
     /*! \brief Update edge bounding box according to source and destination item actual position and size.
      *
      * \note When overriding, call base implementation at the beginning of user implementation.
      * \note Override to an empty method with no base class calls for an edge with no graphics content.
+     * \note Scheduled updates are generated in batch by qan::Graph without calling updateItem(), when
+     * overriding, also override supportsConcurrentGeometry() to return false.
      */
     virtual void        updateItem() noexcept;
 
+    /*! \brief Return true if scheduled updates geometry might be generated in batch (concurrently) by qan::Graph, default to true.
+     *
+     * Batched geometry is generated with generateGeometryCache(), generateGeometry() (on a worker thread) and
+     * applyGeometryCache(), without calling updateItem(). Subclasses customizing edge geometry (for example by
+     * overriding updateItem()) should return false: updateItem() is then called once per frame for scheduled updates
+     * (see qan::Graph::updateDirtyEdges()).
+     */
+    virtual bool        supportsConcurrentGeometry() const noexcept { return true; }
+
 protected:
      /*! Cache current edge geometry state.
       *
@@ -207,6 +261,32 @@ protected:
         QPointF     srcBrCenter;
         QPointF     dstBrCenter;
 
+        // Edge style and ports configuration (copied from edge and port items, so that geometry
+        // can be generated without accessing any QObject).
+        qreal                       arrowSize = 4.;
+        qan::EdgeStyle::ArrowShape  srcShape = qan::EdgeStyle::ArrowShape::None;
+        qan::EdgeStyle::ArrowShape  dstShape = qan::EdgeStyle::ArrowShape::Arrow;
+        bool                        srcPort = false;    //!< True if source item is a port, srcDock is then valid.
+        bool                        dstPort = false;    //!< True if destination item is a port, dstDock is then valid.
+        qan::NodeItem::Dock         srcDock = qan::NodeItem::Dock::Left;
+        qan::NodeItem::Dock         dstDock = qan::NodeItem::Dock::Left;
+
+        //! Bounding shape prepared for fast intersection, in its node item CS (see qan::NodeItem::getClipPolygon()).
+        struct Clip {
+            std::shared_ptr<const qan::ClipPolygon> polygon;
+            QPointF     origin;     //!< Node item origin in graph CS.
+            //! Intersect segment [p1, p2] (in graph CS) with clip polygon, same semantic than qan::ClipPolygon::intersect().
+            bool        intersect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept;
+        };
+        //! Source and destination clip polygons (shared with source and destination items, generated in generateGeometryCache()).
+        Clip                        srcClip;
+        Clip                        dstClip;
+
+        //! Graph ortho router (when qan::Graph::orthoRouting is enabled), with source and destination obstacles keys.
+        const qan::OrthoRouter*     router = nullptr;
+        const void*                 srcKey = nullptr;
+        const void*                 dstKey = nullptr;
+
         QPointF p1, p2;
 
         QPointF dstA1, dstA2, dstA3;
@@ -216,10 +296,23 @@ protected:
         qreal   srcAngle = 0.;
 
         QPointF c1, c2;
+        //! Routed ortho edge polyline (P1, bends, P2), empty when edge is not routed.
+        std::vector<QPointF>    orthoPath;
 
         QPointF labelPosition;
     };
-    inline GeometryCache    generateGeometryCache() const noexcept;
+    //! Gather edge geometry inputs in graph CS (must be called from GUI thread).
+    GeometryCache           generateGeometryCache() const noexcept;
+
+    /*! \brief Generate ends, control points, arrows and label geometry for a cache generated with generateGeometryCache().
+     *
+     * \note Only \c cache is accessed, this method is thread safe and is used by qan::Graph to generate
+     * dirty edges geometry concurrently (see qan::Graph::updateDirtyEdges()).
+     */
+    void                    generateGeometry(GeometryCache& cache) const noexcept;
+
+    //! Apply \c cache with applyGeometry() if it is valid, hide edge otherwise (must be called from GUI thread).
+    void                    applyGeometryCache(const GeometryCache& cache) noexcept;
 
     /*! \brief Generate edge line source and destination points (GeometryCache::p1 and GeometryCache::p2). */
     inline void             generateStraightEnds(GeometryCache& cache) const noexcept;
@@ -262,19 +355,50 @@ public:
     //! Internally used from QML to set src and dst and display an unitialized edge for previewing edges styles.
     Q_INVOKABLE void    setLine(QPoint src, QPoint dst);
     //! Edge source point in item CS (with accurate source bounding shape intersection).
-    Q_PROPERTY(QPointF p1 READ getP1() NOTIFY lineGeometryChanged FINAL)
+    Q_PROPERTY(QPointF p1 READ getP1() NOTIFY edgeGeometryChanged FINAL)
     inline  auto    getP1() const noexcept -> const QPointF& { return _p1; }
     //! Edge destination point in item CS (with accurate destination bounding shape intersection).
-    Q_PROPERTY(QPointF p2 READ getP2() NOTIFY lineGeometryChanged FINAL)
+    Q_PROPERTY(QPointF p2 READ getP2() NOTIFY edgeGeometryChanged FINAL)
     inline  auto    getP2() const noexcept -> const QPointF& { return _p2; }
+
+public:
+    /*! \brief Edge geometry (ends, control points and arrows) in item CS.
+     *
+     * \c p1, \c p2, \c c1, \c c2, \c srcAngle, \c dstAngle and arrows points properties are all notified
+     * with a single edgeGeometryChanged() signal, emitted once per geometry update and only when the
+     * geometry has actually changed (moving an edge along with its source and destination only change
+     * edge item position).
+     *
+     * \note Edge item \c x, \c y, \c width, \c height, \c z and \c labelPos are not part of edge geometry: they
+     * are still notified with their own signals, only when modified.
+     */
+    Q_PROPERTY(qan::EdgeGeometry edgeGeometry READ getEdgeGeometry NOTIFY edgeGeometryChanged FINAL)
+    qan::EdgeGeometry   getEdgeGeometry() const noexcept;
 signals:
-    void            lineGeometryChanged();
+    void                edgeGeometryChanged();
+
+    //! \deprecated Emitted after edgeGeometryChanged() when \c p1 or \c p2 are modified, use edgeGeometryChanged().
+    void                lineGeometryChanged();
+    //! \deprecated Emitted after edgeGeometryChanged() when \c c1, \c c2 or \c orthoPath are modified, use edgeGeometryChanged().
+    void                controlPointsChanged();
+    //! \deprecated Emitted after edgeGeometryChanged() when \c srcAngle is modified, use edgeGeometryChanged().
+    void                srcAngleChanged();
+    //! \deprecated Emitted after edgeGeometryChanged() when \c srcA1, \c srcA2 or \c srcA3 are modified, use edgeGeometryChanged().
+    void                srcArrowGeometryChanged();
+    //! \deprecated Emitted after edgeGeometryChanged() when \c dstAngle is modified, use edgeGeometryChanged().
+    void                dstAngleChanged();
+    //! \deprecated Emitted after edgeGeometryChanged() when \c dstA1, \c dstA2 or \c dstA3 are modified, use edgeGeometryChanged().
+    void                dstArrowGeometryChanged();
 protected:
     QPointF         _p1;
     QPointF         _p2;
 protected:
     QPointF         getLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon) const noexcept;
     QLineF          getLineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& srcBp, const QPolygonF& dstBp) const noexcept;
+    //! \copydoc getLineIntersection(const QPointF&, const QPointF&, const QPolygonF&), using vectorized qan::ClipPolygon::intersect().
+    QPointF         getLineIntersection(const QPointF& p1, const QPointF& p2, const qan::ClipPolygon& polygon) const noexcept;
+    //! \copydoc getLineIntersection(const QPointF&, const QPointF&, const QPolygonF&, const QPolygonF&), using vectorized qan::ClipPolygon::intersect().
+    QLineF          getLineIntersection(const QPointF& p1, const QPointF& p2, const qan::ClipPolygon& srcBp, const qan::ClipPolygon& dstBp) const noexcept;
     //@}
     //-------------------------------------------------------------------------
 
@@ -282,21 +406,35 @@ protected:
     //@{
 public:
     //! Edge source point in item CS (with accurate source bounding shape intersection).
-    Q_PROPERTY(QPointF c1 READ getC1() NOTIFY controlPointsChanged FINAL)
+    Q_PROPERTY(QPointF c1 READ getC1() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc c1
     inline  auto    getC1() const noexcept -> const QPointF& { return _c1; }
     //! Edge destination point in item CS (with accurate destination bounding shape intersection).
-    Q_PROPERTY(QPointF c2 READ getC2() NOTIFY controlPointsChanged FINAL)
+    Q_PROPERTY(QPointF c2 READ getC2() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc c2
     inline  auto    getC2() const noexcept -> const QPointF& { return _c2; }
-signals:
-    //! \copydoc c1
-    void            controlPointsChanged();
 private:
     //! \copydoc c1
     QPointF         _c1;
     //! \copydoc c2
     QPointF         _c2;
+    //! Flattened curve (in item CS) used for curved edges hit testing in contains().
+    qan::CurvePolyline  _curvePolyline;
+public:
+    //! \copydoc _curvePolyline
+    inline const qan::CurvePolyline&    getCurvePolyline() const noexcept { return _curvePolyline; }
+
+public:
+    /*! \brief Ortho edge polyline in item CS (P1, C1, P2 or P1, bends, P2 for edges routed with qan::Graph::orthoRouting).
+     *
+     * Empty for non ortho edges.
+     */
+    Q_PROPERTY(QPolygonF orthoPath READ getOrthoPath NOTIFY edgeGeometryChanged FINAL)
+    //! \copydoc orthoPath
+    inline  auto    getOrthoPath() const noexcept -> const QPolygonF& { return _orthoPath; }
+private:
+    //! \copydoc orthoPath
+    QPolygonF       _orthoPath;
 
 protected:
     /*! Return cubic curve angle at position \c pos between [0.; 1.] on curve defined by \c start, \c end and controls points \c c1 and \c c2.
@@ -308,73 +446,63 @@ protected:
 
 public:
     //! Destination edge arrow angle.
-    Q_PROPERTY(qreal dstAngle READ getDstAngle() NOTIFY dstAngleChanged FINAL)
+    Q_PROPERTY(qreal dstAngle READ getDstAngle() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc dstAngle
     inline  auto    getDstAngle() const noexcept -> qreal { return _dstAngle; }
 private:
     //! \copydoc dstAngle
     qreal           _dstAngle = 0.;
-signals:
-    //! \copydoc dstAngle
-    void            dstAngleChanged();
 
 public:
     /*! \brief Edge destination arrow control points (\c dstA1 is top corner, \c dstA2 is tip, \c dstA3 is bottom corner).
      *
-     * \note Destination arrow geometry is updated with a single dstArrowGeometryChanged() to avoid unecessary binding: all points
+     * \note Destination arrow geometry is updated with a single edgeGeometryChanged() to avoid unecessary binding: all points
      * geometry must be changed at the same time.
      */
-    Q_PROPERTY(QPointF dstA1 READ getDstA1() NOTIFY dstArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF dstA1 READ getDstA1() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc dstA1
     inline  auto    getDstA1() const noexcept -> const QPointF& { return _dstA1; }
     //! \copydoc dstA1
-    Q_PROPERTY(QPointF dstA2 READ getDstA2() NOTIFY dstArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF dstA2 READ getDstA2() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc dstA1
     inline  auto    getDstA2() const noexcept -> const QPointF& { return _dstA2; }
     //! \copydoc dstA1
-    Q_PROPERTY(QPointF dstA3 READ getDstA3() NOTIFY dstArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF dstA3 READ getDstA3() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc dstA1
     inline  auto    getDstA3() const noexcept -> const QPointF& { return _dstA3; }
 private:
     //! \copydoc dstA1
     QPointF         _dstA1, _dstA2, _dstA3;
-signals:
-    void            dstArrowGeometryChanged();
 
 public:
     //! Source edge arrow angle.
-    Q_PROPERTY(qreal srcAngle READ getSrcAngle() NOTIFY srcAngleChanged FINAL)
+    Q_PROPERTY(qreal srcAngle READ getSrcAngle() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc srcAngle
     inline  auto    getSrcAngle() const noexcept -> qreal { return _srcAngle; }
 private:
     //! \copydoc srcAngle
     qreal           _srcAngle = 0.;
-signals:
-    //! \copydoc srcAngle
-    void            srcAngleChanged();
 
 public:
     /*! \brief Edge source arrow control points (\c srcA1 is top corner, \c srcA2 is tip, \c srcA3 is bottom corner).
      *
-     * \note Source arrow geometry is updated with a single srcArrowGeometryChanged() to avoid unecessary binding: all points
+     * \note Source arrow geometry is updated with a single edgeGeometryChanged() to avoid unecessary binding: all points
      * geometry must be changed at the same time.
      */
-    Q_PROPERTY(QPointF srcA1 READ getSrcA1() NOTIFY srcArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF srcA1 READ getSrcA1() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc srcA1
     inline  auto    getSrcA1() const noexcept -> const QPointF& { return _srcA1; }
     //! \copydoc srcA1
-    Q_PROPERTY(QPointF srcA2 READ getSrcA2() NOTIFY srcArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF srcA2 READ getSrcA2() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc srcA1
     inline  auto    getSrcA2() const noexcept -> const QPointF& { return _srcA2; }
     //! \copydoc srcA1
-    Q_PROPERTY(QPointF srcA3 READ getSrcA3() NOTIFY srcArrowGeometryChanged FINAL)
+    Q_PROPERTY(QPointF srcA3 READ getSrcA3() NOTIFY edgeGeometryChanged FINAL)
     //! \copydoc srcA1
     inline  auto    getSrcA3() const noexcept -> const QPointF& { return _srcA3; }
 private:
     //! \copydoc srcA1
     QPointF         _srcA1, _srcA2, _srcA3;
-signals:
-    void            srcArrowGeometryChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -400,7 +528,7 @@ public:
     //! Get edge label position.
     QPointF		getLabelPos() const { return _labelPos; }
     //! Set edge label position.
-    void		setLabelPos(const QPointF labelPos) { _labelPos = labelPos; emit labelPosChanged(); }
+    void		setLabelPos(const QPointF labelPos) { if (labelPos != _labelPos) { _labelPos = labelPos; emit labelPosChanged(); } }
 protected:
     //! \sa labelPos
     QPointF     _labelPos;
@@ -34,12 +34,16 @@
 
 // Std headers
 #include <memory>
+#include <unordered_set>
+#include <algorithm>        // std::remove_if, std::reverse
+#include <iterator>         // std::make_reverse_iterator
 
 // Qt headers
 #include <QQmlProperty>
 #include <QVariant>
 #include <QQmlEngine>
 #include <QQmlComponent>
+#include <QElapsedTimer>
 
 // QuickQanava headers
 #include "./qanUtils.h"
@@ -72,10 +76,24 @@ Graph::~Graph()
     // triggering code on this partially deleted graph when a node or
     // edge destroyed() signal is binded to something that try to access this
     // partially destroyed graph (for example a nodes/edges model...!).
-    for (const auto node: get_nodes())
+    for (const auto node: get_nodes()) {
         node->disconnect(node, 0, 0, 0);
-    for (const auto edge: get_edges())
+        if (node->getItem() != nullptr)     // Node items might be destroyed after graph spatial index
+            indexItem(node->getItem(), false);
+    }
+    for (const auto edge: get_edges()) {
         edge->disconnect(edge, 0, 0, 0);
+        if (edge->getItem() != nullptr) {   // Edge items might be destroyed after graph ortho router
+            edge->getItem()->_graph = nullptr;
+            indexItem(edge->getItem(), false);
+        }
+    }
+    for (const auto incubator : _incubatedItems)    // Ready items not yet installed are owned by graph
+        if (incubator->object() != nullptr)
+            incubator->object()->deleteLater();
+    _incubatedItems.clear();
+    _incubators.clear();    // Cancel running incubations while graph is still valid
+    clearItemPools();
 }
 
 void    Graph::classBegin()
@@ -164,67 +182,72 @@ void    Graph::clear() noexcept
     _selectedNodes.clear();
     _selectedGroups.clear();
     _selectedEdges.clear();
+    _selectedNodesIndex.clear();
+    _selectedGroupsIndex.clear();
+    _selectedEdgesIndex.clear();
+    _orthoRouter.clear();
+    _dirtyObstacles.clear();
+    _spatialIndex.clear();
+    _groupsIndex.clear();
+    _dirtyIndexItems.clear();
+    clearVirtualizationIndex();
+    _pendingNodes.clear();
+    _pendingEdges.clear();
+    _incubators.clear();    // Cancel running incubations
     super_t::clear();
     _styleManager.clear();
+    notifyPendingItemCount();
 }
 
 QQuickItem* Graph::graphChildAt(qreal x, qreal y) const
 {
-    if (getContainerItem() == nullptr)
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
         return nullptr;
-    const auto childrens = getContainerItem()->childItems();
-    for (int i = childrens.count() - 1; i >= 0; --i) {
-        QQuickItem* child = childrens.at(i);
-        const QPointF point = mapToItem(child, QPointF{x, y});  // Map coordinates to the child element's coordinate space
-        if (child != nullptr &&
-            child->isVisible() &&
-            child->contains(point) &&    // Note 20160508: childAt do not call contains()
-            point.x() > -0.0001 &&
-            child->width() > point.x() &&
-            point.y() > -0.0001 &&
-            child->height() > point.y()) {
-            if (child->inherits("qan::TableGroupItem")) {
-                const auto tableGroupItem = static_cast<qan::TableGroupItem*>(child);
-                if (tableGroupItem != nullptr) {
-                    for (const auto cell: tableGroupItem->getCells()) {
-                        const auto point = mapToItem(cell, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (cell->isVisible() &&
-                            cell->contains(point) &&
-                            point.x() > -0.0001 &&
-                            cell->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            cell->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(cell->getItem(), QQmlEngine::CppOwnership);
-                            return cell->getItem();
-                        }
-                    }
+    const auto child = itemAt(mapToItem(containerItem, QPointF{x, y}));
+    if (child == nullptr)
+        return nullptr;
+    if (child->inherits("qan::TableGroupItem")) {
+        const auto tableGroupItem = static_cast<qan::TableGroupItem*>(child);
+        if (tableGroupItem != nullptr) {
+            for (const auto cell: tableGroupItem->getCells()) {
+                const auto point = mapToItem(cell, QPointF(x, y)); // Map coordinates to group child element's coordinate space
+                if (cell->isVisible() &&
+                    cell->contains(point) &&
+                    point.x() > -0.0001 &&
+                    cell->width() > point.x() &&
+                    point.y() > -0.0001 &&
+                    cell->height() > point.y()) {
+                    QQmlEngine::setObjectOwnership(cell->getItem(), QQmlEngine::CppOwnership);
+                    return cell->getItem();
                 }
             }
-            if (child->inherits("qan::GroupItem")) {  // For group, look in group childs
-                const auto groupItem = qobject_cast<qan::GroupItem*>(child);
-                if (groupItem != nullptr &&
-                    groupItem->getContainer() != nullptr) {
-                    const QList<QQuickItem *> groupChildren = groupItem->getContainer()->childItems();
-                    for (int gc = groupChildren.count() - 1; gc >= 0; --gc) {
-                        QQuickItem* groupChild = groupChildren.at(gc);
-                        const auto point = mapToItem(groupChild, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (groupChild->isVisible() &&
-                            groupChild->contains(point) &&
-                            point.x() > -0.0001 &&
-                            groupChild->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            groupChild->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(groupChild, QQmlEngine::CppOwnership);
-                            return groupChild;
-                        }
-                    }
+        }
+    }
+    if (child->inherits("qan::GroupItem")) {  // For group, look in group childs that are not indexed (grouped nodes are indexed)
+        const auto groupItem = qobject_cast<qan::GroupItem*>(child);
+        if (groupItem != nullptr &&
+            groupItem->getContainer() != nullptr) {
+            const QList<QQuickItem *> groupChildren = groupItem->getContainer()->childItems();
+            for (int gc = groupChildren.count() - 1; gc >= 0; --gc) {
+                QQuickItem* groupChild = groupChildren.at(gc);
+                if (_spatialIndex.contains(groupChild))
+                    continue;
+                const auto point = mapToItem(groupChild, QPointF(x, y)); // Map coordinates to group child element's coordinate space
+                if (groupChild->isVisible() &&
+                    groupChild->contains(point) &&
+                    point.x() > -0.0001 &&
+                    groupChild->width() > point.x() &&
+                    point.y() > -0.0001 &&
+                    groupChild->height() > point.y()) {
+                    QQmlEngine::setObjectOwnership(groupChild, QQmlEngine::CppOwnership);
+                    return groupChild;
                 }
             }
-            QQmlEngine::setObjectOwnership(child, QQmlEngine::CppOwnership);
-            return child;
         }
     }
-    return nullptr;
+    QQmlEngine::setObjectOwnership(child, QQmlEngine::CppOwnership);
+    return child;
 }
 
 qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem* except) const
@@ -234,58 +257,46 @@ qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem*
         // except can be nullptr
     if (!s.isValid())
         return nullptr;
+    if (getContainerItem() == nullptr)
+        return nullptr;
 
     // Algorithm:
-        // 1. Copy internal group list
-        // 2. Order the container of group from maximum to minimum z
-        // 3. Return the first group containing rect(p,s)
+        // 1. Query groups index for non collapsed groups containing p
+        // 2. Return the group with maximum global z (cached, see qan::NodeItem::getGlobalZ()) containing rect(p,s),
+        //    ties are broken on stacking order (nested groups are painted after their parent group)
 
     // 1.
-    std::vector<qan::Group*> groups;
-    groups.reserve(static_cast<unsigned int>(get_groups().size()));
-    for (const auto group : qAsConst(get_groups().getContainer())) {
-        if (group != nullptr)
-            groups.push_back(group);
-    }
+    updateSpatialIndex();
+    std::vector<qan::SpatialIndex::Key> keys;
+    _groupsIndex.itemsAt(p, keys);
 
     // 2.
-    std::sort(groups.begin(), groups.end(), [](const auto g1, const auto g2) -> bool {
-        if (g1 == nullptr || g2 == nullptr)
-            return false;
-        const auto g1Item = g1->getItem();
-        const auto g2Item = g2->getItem();
-        if (g1Item == nullptr ||
-            g2Item == nullptr)
-            return false;
-        const auto g1GlobalZ = qan::getItemGlobalZ_rec(g1Item);
-        const auto g2GlobalZ = qan::getItemGlobalZ_rec(g2Item);
-        return g1GlobalZ > g2GlobalZ;
-    });
-
-    // 3.
-    if (getContainerItem() == nullptr)
-            return nullptr;
-    for (const auto group : qAsConst(groups)) {
-        if (group &&
-            group->getItem() != nullptr &&
-            group->getItem() != except) {
-            const auto groupItem = group->getGroupItem();
-            if (groupItem == nullptr)
-                continue;
-            if (groupItem->getCollapsed())
-                continue;  // Do not return collapsed groups
-
-            const auto groupRect =  QRectF{groupItem->mapToItem(getContainerItem(), QPointF{0., 0.}),
-                                           QSizeF{groupItem->width(), groupItem->height()}};
-            const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
-                                                                 QSizeF{1,1};   // to be fully contained by group to trigger a drop.
-            if (groupRect.contains(QRectF{p, targetSize})) {
-                QQmlEngine::setObjectOwnership(group, QQmlEngine::CppOwnership);
-                return group;
-            }
+    qan::Group* topGroup = nullptr;
+    qreal topZ = 0.;
+    for (const auto key : keys) {
+        const auto groupItem = static_cast<qan::GroupItem*>(const_cast<QQuickItem*>(static_cast<const QQuickItem*>(key)));
+        const auto group = groupItem->getGroup();
+        if (group == nullptr ||
+            groupItem == except)
+            continue;
+        QRectF groupRect;
+        if (!_groupsIndex.getRect(key, groupRect))
+            continue;
+        const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
+                                                             QSizeF{1,1};   // to be fully contained by group to trigger a drop.
+        if (!groupRect.contains(QRectF{p, targetSize}))
+            continue;
+        const qreal z = groupItem->getGlobalZ();
+        if (topGroup == nullptr ||
+            z > topZ ||
+            (z == topZ && qan::isItemStackedAbove(groupItem, topGroup->getItem()))) {  // At equal z, group painted last wins
+            topGroup = group;
+            topZ = z;
         }
-    } // for all groups
-    return nullptr;
+    }
+    if (topGroup != nullptr)
+        QQmlEngine::setObjectOwnership(topGroup, QQmlEngine::CppOwnership);
+    return topGroup;
 }
 //-----------------------------------------------------------------------------
 
@@ -422,9 +433,14 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
         const auto rootContext = qmlContext(this);
         if (rootContext == nullptr)
             throw qan::Error{ "Error can't access to local QML context." };
-        QObject* object = component->beginCreate(rootContext);
-        if (object == nullptr ||
-            component->isError()) {
+        // Node and edge items might be reused from component items pool (see reuseItems)
+        const auto pooledItem = (node != nullptr || edge != nullptr) ? takePooledItem(component) :
+                                                                       nullptr;
+        QObject* object = pooledItem != nullptr ? pooledItem :
+                                                  component->beginCreate(rootContext);
+        if (pooledItem == nullptr &&
+            (object == nullptr ||
+             component->isError())) {
             if (object != nullptr)
                 object->deleteLater();
             throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
@@ -438,6 +454,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
                 nodeItem->setNode(node);
                 nodeItem->setGraph(this);
                 nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
+                nodeItem->setLevelOfDetail(_levelOfDetail);
                 _styleManager.setStyleComponent(&style, component );
             }
         } else if (edge != nullptr) {
@@ -455,6 +472,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
                 group->setItem(groupItem);
                 groupItem->setGraph(this);
                 groupItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
+                groupItem->setLevelOfDetail(_levelOfDetail);
                 _styleManager.setStyleComponent(groupItem->getStyle(), component);
             }
         } else {
@@ -462,6 +480,16 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
             if (nodeItem != nullptr)                                    // is a preview item, but now actual underlining node.
                 nodeItem->setItemStyle(&style);
         }
+        if (pooledItem != nullptr) {
+            item = pooledItem;
+            item->setVisible(true);
+            item->setParentItem(getContainerItem());
+            if (node != nullptr)
+                emit static_cast<qan::NodeItem*>(item)->reused();
+            else
+                emit static_cast<qan::EdgeItem*>(item)->reused();
+            return item;
+        }
         component->completeCreate();
         if (!component->isError()) {
             QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
@@ -612,6 +640,168 @@ QQuickItem* Graph::createItemFromComponent(QQmlComponent* component)
     }
     return QPointer<QQuickItem>{item};
 }
+
+void    Graph::setReuseItems(bool reuseItems)
+{
+    if (reuseItems == _reuseItems)
+        return;
+    _reuseItems = reuseItems;
+    if (!_reuseItems)
+        clearItemPools();
+    emit reuseItemsChanged();
+}
+
+void    Graph::setMaxPooledItems(int maxPooledItems)
+{
+    maxPooledItems = std::max(0, maxPooledItems);
+    if (maxPooledItems == _maxPooledItems)
+        return;
+    _maxPooledItems = maxPooledItems;
+    for (auto& pool : _itemPools) {     // Destroy pooled items above new maximum
+        auto& items = pool.second.items;
+        while (items.size() > static_cast<std::size_t>(_maxPooledItems)) {
+            if (items.back())
+                items.back()->deleteLater();
+            items.pop_back();
+        }
+    }
+    emit maxPooledItemsChanged();
+}
+
+int     Graph::getPooledItemCount() const noexcept
+{
+    std::size_t count = 0;
+    for (const auto& pool : _itemPools)
+        count += pool.second.items.size();
+    return static_cast<int>(count);
+}
+
+void    Graph::clearItemPools()
+{
+    for (auto& pool : _itemPools) {
+        QObject::disconnect(pool.second.componentDestroyed);
+        for (const auto& item : pool.second.items)
+            if (item)
+                item->deleteLater();
+    }
+    _itemPools.clear();
+}
+
+bool    Graph::poolNodeItem(qan::Node& node)
+{
+    // PRECONDITIONS:
+        // reuseItems must be true
+        // node must have an item created from a delegate component
+        // groups and nodes with ports are not pooled
+    const auto nodeItem = node.getItem();
+    const auto component = node.getItemComponent();
+    if (!_reuseItems ||
+        nodeItem == nullptr ||
+        component == nullptr ||
+        node.isGroup() ||
+        nodeItem->getPorts().size() != 0)
+        return false;
+    auto& pool = getItemPool(*component);
+    if (pool.size() >= static_cast<std::size_t>(_maxPooledItems))
+        return false;
+
+    if (nodeItem->getSelected())
+        nodeItem->setSelected(false);
+    indexItem(nodeItem, false);
+    node.detachItem();
+    QObject::disconnect(nodeItem, nullptr, this, nullptr);  // Graph notifications are connected again on reuse
+    nodeItem->setVisible(false);
+    nodeItem->setParentItem(nullptr);
+    nodeItem->setNode(nullptr);
+    // Reset item state modified by graph, and restore state initially set by delegate, delegate
+    // specific state should be reset in pooled()
+    nodeItem->setCollapsed(false);
+    nodeItem->setDragged(false);
+    nodeItem->restoreDelegateState();
+    pool.emplace_back(nodeItem);
+    emit nodeItem->pooled();
+    return true;
+}
+
+bool    Graph::poolEdgeItem(qan::Edge& edge)
+{
+    // PRECONDITIONS:
+        // reuseItems must be true
+        // edge must have an item created from a delegate component
+        // edges bound to ports are not pooled (ports keep a reference on their edges items)
+    const auto edgeItem = edge.getItem();
+    const auto component = edge.getItemComponent();
+    if (!_reuseItems ||
+        edgeItem == nullptr ||
+        component == nullptr ||
+        qobject_cast<qan::PortItem*>(edgeItem->getSourceItem()) != nullptr ||
+        qobject_cast<qan::PortItem*>(edgeItem->getDestinationItem()) != nullptr)
+        return false;
+    auto& pool = getItemPool(*component);
+    if (pool.size() >= static_cast<std::size_t>(_maxPooledItems))
+        return false;
+
+    if (edgeItem->getSelected())
+        edgeItem->setSelected(false);
+    indexItem(edgeItem, false);
+    edge.detachItem();
+    QObject::disconnect(edgeItem, nullptr, this, nullptr);  // Graph notifications are connected again on reuse
+    if (edgeItem->_sourceItem)                               // Stop following previous source and destination geometry
+        QObject::disconnect(edgeItem->_sourceItem.data(), nullptr, edgeItem, nullptr);
+    if (edgeItem->_destinationItem)
+        QObject::disconnect(edgeItem->_destinationItem.data(), nullptr, edgeItem, nullptr);
+    edgeItem->_sourceItem = nullptr;
+    edgeItem->_destinationItem = nullptr;
+    _orthoRouter.removeRoute(edgeItem);
+    edgeItem->setVisible(false);
+    edgeItem->setParentItem(nullptr);
+    edgeItem->setEdge(nullptr);
+    // Reset item state to EdgeItem defaults, source and destination shapes overrides are
+    // reset to current style shapes (style is not modified when item is reused with the same style)
+    edgeItem->setHidden(false);
+    const auto style = edgeItem->getStyle();
+    edgeItem->setSrcShape(style != nullptr ? style->getSrcShape() : qan::EdgeStyle::ArrowShape::None);
+    edgeItem->setDstShape(style != nullptr ? style->getDstShape() : qan::EdgeStyle::ArrowShape::Arrow);
+    pool.emplace_back(edgeItem);
+    emit edgeItem->pooled();
+    return true;
+}
+
+std::vector<QPointer<QQuickItem>>&  Graph::getItemPool(QQmlComponent& component)
+{
+    auto pool = _itemPools.find(&component);
+    if (pool == _itemPools.end()) {     // Pooled items can't be reused once their component is destroyed
+        pool = _itemPools.emplace(&component, ItemPool{}).first;
+        const QQmlComponent* key = &component;
+        pool->second.componentDestroyed = connect(&component, &QObject::destroyed, this, [this, key]() {
+            const auto destroyedPool = _itemPools.find(key);
+            if (destroyedPool != _itemPools.end()) {
+                for (const auto& item : destroyedPool->second.items)
+                    if (item)
+                        item->deleteLater();
+                _itemPools.erase(destroyedPool);
+            }
+        });
+    }
+    return pool->second.items;
+}
+
+QQuickItem* Graph::takePooledItem(QQmlComponent* component)
+{
+    if (!_reuseItems)
+        return nullptr;
+    const auto pool = _itemPools.find(component);
+    if (pool == _itemPools.end())
+        return nullptr;
+    auto& items = pool->second.items;
+    while (!items.empty()) {
+        const QPointer<QQuickItem> item = items.back();
+        items.pop_back();
+        if (item)
+            return item.data();
+    }
+    return nullptr;
+}
 //-----------------------------------------------------------------------------
 
 /* Graph Factories *///--------------------------------------------------------
@@ -651,44 +841,9 @@ bool    Graph::insertNode(Node* node, QQmlComponent* nodeComponent, qan::NodeSty
     }
     try {
         QQmlEngine::setObjectOwnership(node, QQmlEngine::CppOwnership);
-        qan::NodeItem* nodeItem = nullptr;
         if (nodeComponent != nullptr &&
-            nodeStyle != nullptr) {
-            _styleManager.setStyleComponent(nodeStyle, nodeComponent);
-            nodeItem = static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                       *nodeStyle,
-                                                                       node));
-        }
-        if (nodeItem != nullptr) {
-            nodeItem->setNode(node);
-            nodeItem->setGraph(this);
-            node->setItem(nodeItem);
-            auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeClicked,
-                    this,       notifyNodeClicked);
-
-            auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeRightClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeRightClicked,
-                    this,       notifyNodeRightClicked);
-
-            auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
-                    this,     notifyNodeDoubleClicked);
-            node->setItem(nodeItem);
-            {   // Send item to front
-                const auto z = nextMaxZ();
-                nodeItem->setZ(z);
-            }
-        }
+            nodeStyle != nullptr)
+            configureNode(*node, *nodeComponent, *nodeStyle);
         super_t::insert_node(node);
     } catch (const qan::Error& e) {
         qWarning() << "qan::Graph::insertNode(): Error: " << e.getMsg();
@@ -705,6 +860,123 @@ bool    Graph::insertNode(Node* node, QQmlComponent* nodeComponent, qan::NodeSty
     return true;
 }
 
+std::size_t Graph::insertNodes(const std::vector<qan::Node*>& nodes, QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+{
+    if (nodes.empty())
+        return 0;
+    if (nodeComponent == nullptr) {
+        nodeComponent = _nodeDelegate.get(); // If no delegate component is specified, try the default node delegate
+        const auto engine = qmlEngine(this);
+        if (nodeComponent == nullptr &&
+            engine != nullptr)
+            nodeComponent = qan::Node::delegate(*engine);
+    }
+    if (nodeComponent != nullptr &&
+        nodeComponent->isError()) {
+        qWarning() << "qan::Graph::insertNodes(): Component error: " << nodeComponent->errors();
+        return 0;
+    }
+    if (nodeStyle == nullptr)
+        nodeStyle = qan::Node::style(nullptr);
+
+    // Filter nullptr, already inserted and duplicated nodes before creating their delegates
+    std::vector<qan::Node*> insertedNodes;
+    insertedNodes.reserve(nodes.size());
+    std::unordered_set<const qan::Node*> uniqueNodes;
+    for (const auto node : nodes) {
+        if (node == nullptr ||
+            hasNode(node) ||
+            !uniqueNodes.insert(node).second)
+            continue;
+        insertedNodes.push_back(node);
+    }
+    try {
+        for (const auto node : insertedNodes) {
+            QQmlEngine::setObjectOwnership(node, QQmlEngine::CppOwnership);
+            if (nodeComponent != nullptr &&
+                nodeStyle != nullptr)
+                configureNode(*node, *nodeComponent, *nodeStyle);
+        }
+        super_t::insert_nodes(insertedNodes);
+    } catch (const qan::Error& e) {
+        qWarning() << "qan::Graph::insertNodes(): Error: " << e.getMsg();
+        return 0;
+    }
+    catch (...) {
+        qWarning() << "qan::Graph::insertNodes(): Error: Topology error.";
+        return 0;
+    }
+    for (const auto node : insertedNodes)   // Notify user.
+        onNodeInserted(*node);
+    emit nodesInserted(QList<qan::Node*>(insertedNodes.cbegin(), insertedNodes.cend()));
+    return insertedNodes.size();
+}
+
+qan::NodeItem*  Graph::configureNode(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle)
+{
+    _styleManager.setStyleComponent(&nodeStyle, &nodeComponent);
+    node.setItemDelegate(&nodeComponent, &nodeStyle);   // Keep delegate to create item again once virtualized
+    if (_virtualized) {     // Item is created in updateVirtualization() if node is in view
+        scheduleVirtualizationUpdate(node);
+        return nullptr;
+    }
+    if (_asynchronous) {    // Item is incubated in updatePolish()
+        _pendingNodes.emplace_back(&node);
+        _incubating = true;
+        scheduleIncubation();
+        return nullptr;
+    }
+    return createNodeItem(node, nodeComponent, nodeStyle);
+}
+
+qan::NodeItem*  Graph::createNodeItem(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle)
+{
+    auto nodeItem = static_cast<qan::NodeItem*>(createFromComponent(&nodeComponent, nodeStyle, &node));
+    if (nodeItem == nullptr)
+        return nullptr;
+    initNodeItem(node, *nodeItem);
+    return nodeItem;
+}
+
+void    Graph::initNodeItem(qan::Node& node, qan::NodeItem& item)
+{
+    const auto nodeItem = &item;
+    nodeItem->saveDelegateState();      // Only saved for a newly created item, not for a reused one
+    nodeItem->setNode(&node);
+    nodeItem->setGraph(this);
+    node.setItem(nodeItem);
+    auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeClicked(nodeItem->getNode(), p);
+    };
+    connect(nodeItem,   &qan::NodeItem::nodeClicked,
+            this,       notifyNodeClicked);
+
+    auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeRightClicked(nodeItem->getNode(), p);
+    };
+    connect(nodeItem,   &qan::NodeItem::nodeRightClicked,
+            this,       notifyNodeRightClicked);
+
+    auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeDoubleClicked(nodeItem->getNode(), p);
+    };
+    connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
+            this,     notifyNodeDoubleClicked);
+    {   // Send item to front when it is created for the first time, restore its z when it is
+        // created again after a release (see realizeNode() and onItemIncubated())
+        qreal z = 0.;
+        nodeItem->setZ(node.getStoredItemZ(z) ? z : nextMaxZ());
+    }
+    if (_orthoRouting) {
+        connectObstacle(nodeItem, true);
+        scheduleObstacleUpdate(nodeItem);
+    }
+    indexItem(nodeItem, true);
+}
+
 bool    Graph::removeNode(qan::Node* node, bool force)
 {
     // PRECONDITIONS:
@@ -719,8 +991,22 @@ bool    Graph::removeNode(qan::Node* node, bool force)
 
     onNodeRemoved(*node);
     emit nodeRemoved(node);
-    if (_selectedNodes.contains(node))
-        _selectedNodes.removeAll(node);
+    removeFromSelection(*node);     // O(1), see _selectedNodesIndex
+    if (_orthoRouting &&
+        node->getItem() != nullptr) {   // Re-route edges that were avoiding node
+        std::vector<qan::OrthoRouter::Key> routes;
+        _orthoRouter.removeObstacle(node->getItem(), routes);
+        scheduleRoutesUpdate(routes);
+    }
+    if (_reuseItems) {      // Pool items before adjacent edges and node are destroyed
+        for (const auto inEdge : node->get_in_edges())
+            if (inEdge != nullptr)
+                poolEdgeItem(*inEdge);
+        for (const auto outEdge : node->get_out_edges())
+            if (outEdge != nullptr)
+                poolEdgeItem(*outEdge);
+        poolNodeItem(*node);
+    }
     return super_t::remove_node(node);  // warning node pointer now invalid
 }
 
@@ -861,19 +1147,46 @@ bool    Graph::configureEdge(qan::Edge& edge, QQmlComponent& edgeComponent, qan:
                              qan::Node& src, qan::Node* dst)
 {
     _styleManager.setStyleComponent(&style, &edgeComponent);
+    edge.setItemDelegate(&edgeComponent, &style);       // Keep delegate to create item again once virtualized
+    edge.set_src(&src);
+    if (dst != nullptr)
+        edge.set_dst(dst);
+    if (_virtualized &&     // Item is created in updateVirtualization() once both nodes items exist
+        (src.getItem() == nullptr ||
+         (dst != nullptr && dst->getItem() == nullptr))) {
+        scheduleVirtualizationUpdate(edge);
+        return true;
+    }
+    if (_asynchronous &&    // Item is incubated in updatePolish() once both nodes items exist
+        !_virtualized) {
+        _pendingEdges.emplace_back(&edge);
+        _incubating = true;
+        scheduleIncubation();
+        return true;
+    }
+    return createEdgeItem(edge, edgeComponent, style) != nullptr;
+}
+
+qan::EdgeItem*  Graph::createEdgeItem(qan::Edge& edge, QQmlComponent& edgeComponent, qan::EdgeStyle& style)
+{
     auto edgeItem = qobject_cast< qan::EdgeItem* >(createFromComponent(&edgeComponent, style, nullptr, &edge));
     if (edgeItem == nullptr) {
         qWarning() << "qan::Graph::insertEdge(): Warning: Edge creation from QML delegate failed.";
-        return false;
+        return nullptr;
     }
-    edge.setItem(edgeItem);
-    edgeItem->setSourceItem(src.getItem());
-    if (dst != nullptr)
-        edgeItem->setDestinationItem(dst->getItem());
+    initEdgeItem(edge, *edgeItem);
+    return edgeItem;
+}
 
-    edge.set_src(&src);
-    if (dst != nullptr)
-        edge.set_dst(dst);
+void    Graph::initEdgeItem(qan::Edge& edge, qan::EdgeItem& item)
+{
+    const auto edgeItem = &item;
+    edgeItem->setEdge(&edge);
+    edge.setItem(edgeItem);
+    if (edge.get_src() != nullptr)
+        edgeItem->setSourceItem(edge.get_src()->getItem());
+    if (edge.get_dst() != nullptr)
+        edgeItem->setDestinationItem(edge.get_dst()->getItem());
 
     auto notifyEdgeClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
@@ -889,38 +1202,1119 @@ bool    Graph::configureEdge(qan::Edge& edge, QQmlComponent& edgeComponent, qan:
     connect(edgeItem,   &qan::EdgeItem::edgeRightClicked,
             this,       notifyEdgeRightClicked);
 
-    auto notifyEdgeDoubleClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
-        if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
-            emit this->edgeDoubleClicked(edgeItem->getEdge(), p);
-    };
-    connect(edgeItem, &qan::EdgeItem::edgeDoubleClicked,
-            this,     notifyEdgeDoubleClicked);
-    return true;
+    auto notifyEdgeDoubleClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
+        if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
+            emit this->edgeDoubleClicked(edgeItem->getEdge(), p);
+    };
+    connect(edgeItem, &qan::EdgeItem::edgeDoubleClicked,
+            this,     notifyEdgeDoubleClicked);
+    indexItem(edgeItem, true);
+}
+
+std::vector<qan::Edge*> Graph::insertEdges(const std::vector<std::pair<qan::Node*, qan::Node*>>& edges,
+                                            QQmlComponent* edgeComponent)
+{
+    if (edges.empty())
+        return {};
+    if (edgeComponent == nullptr) {
+        const auto engine = qmlEngine(this);
+        if (engine != nullptr)
+            edgeComponent = qan::Edge::delegate(*engine, nullptr);
+        if (edgeComponent == nullptr)
+            edgeComponent = _edgeDelegate.get();    // Otherwise, use default edge delegate component
+    }
+    const auto style = qan::Edge::style(nullptr);
+    if (style == nullptr) {
+        qWarning() << "qan::Graph::insertEdges(): Error: style() factory has returned a nullptr style.";
+        return {};
+    }
+    // Edges are inserted in topology first, items are created only once topology
+    // insertion has succeeded, so that nothing but plain edges has to be freed on error.
+    std::vector<qan::Edge*> insertedEdges;
+    insertedEdges.reserve(edges.size());
+    try {
+        for (const auto& sourceDestination : edges) {
+            const auto source = sourceDestination.first;
+            const auto destination = sourceDestination.second;
+            if (source == nullptr ||
+                destination == nullptr)
+                continue;
+            auto edge = new qan::Edge{nullptr};
+            QQmlEngine::setObjectOwnership(edge, QQmlEngine::CppOwnership);
+            edge->set_src(source);
+            edge->set_dst(destination);
+            insertedEdges.push_back(edge);
+        }
+        super_t::insert_edges(insertedEdges);
+    } catch (...) {
+        qWarning() << "qan::Graph::insertEdges(): Error: Topology error.";
+    }
+    // Free edges that have not been inserted in topology (either on allocation error
+    // or when gtpo insertion has failed), edges owned by topology are kept.
+    const auto notInserted = std::remove_if(insertedEdges.begin(), insertedEdges.end(),
+                                            [this](qan::Edge* edge) {
+                                                if (edge->get_graph() == this)
+                                                    return false;
+                                                delete edge;
+                                                return true;
+                                            });
+    insertedEdges.erase(notInserted, insertedEdges.end());
+    if (edgeComponent != nullptr) {
+        for (const auto edge : insertedEdges)
+            configureEdge(*edge,  *edgeComponent, *style,
+                          *edge->get_src(), edge->get_dst());
+    }
+    for (const auto edge : insertedEdges)   // Notify user.
+        onEdgeInserted(*edge);
+    if (!insertedEdges.empty())
+        emit edgesInserted(QList<qan::Edge*>(insertedEdges.cbegin(), insertedEdges.cend()));
+    return insertedEdges;
+}
+
+void    Graph::onEdgeInserted(qan::Edge& edge) { Q_UNUSED(edge) /* Nil */ }
+
+bool    Graph::removeEdge(qan::Node* source, qan::Node* destination) {
+    return super_t::remove_edge(source, destination);
+}
+bool    Graph::removeEdge(qan::Edge* edge, bool force) {
+    if (edge == nullptr)
+        return false;
+    if (!force &&
+        (edge->getIsProtected() ||
+         edge->getLocked()))
+        return false;
+    removeFromSelection(*edge);     // O(1), see _selectedEdgesIndex
+    emit onEdgeRemoved(edge);
+    poolEdgeItem(*edge);
+    return super_t::remove_edge(edge);
+}
+
+bool    Graph::hasEdge(const qan::Node* source, const qan::Node* destination) const
+{
+    if (source == nullptr || destination == nullptr)
+        return false;
+    return super_t::has_edge(source, destination);
+}
+
+bool    Graph::hasEdge(const qan::Edge* edge) const { return hasEdge(edge->get_src(), edge->get_dst()); }
+
+void    Graph::scheduleEdgeUpdate(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == nullptr)
+        return;
+    if (_dirtyEdges.empty())
+        polish();           // updatePolish() will be called on GUI thread before next scene graph synchronization
+    _dirtyEdges.emplace_back(edgeItem);
+}
+
+void    Graph::updateDirtyEdges()
+{
+    // Algorithm:
+        // 1. Gather dirty edges geometry inputs (bounding shapes in graph CS, dock types, line type,
+        //    arrow size, etc.) in plain geometry caches, on GUI thread.
+        // 2. Generate caches geometry concurrently with _edgesGeometryPool, GUI thread generate the
+        //    first chunk and wait for others.
+        // 3. Apply all generated geometry on GUI thread.
+        // Edge items that do not support concurrent geometry generation (see
+        // qan::EdgeItem::supportsConcurrentGeometry()) are updated with a direct updateItem() call in 3.
+
+    // Note: updating an edge might schedule other updates (for example, a group resized by
+    // its content), take ownership of the current dirty list before updating, new updates
+    // will be polished on next frame.
+    if (_orthoRouting)                                      // Might schedule edges whose route intersect moved nodes
+        updateObstacles();
+    std::vector<QPointer<qan::EdgeItem>> dirtyEdges;
+    dirtyEdges.swap(_dirtyEdges);
+
+    std::vector<qan::EdgeItem*> edgeItems;                  // 1.
+    std::vector<qan::EdgeItem::GeometryCache> caches;
+    std::vector<QPointer<qan::EdgeItem>> customEdgeItems;
+    edgeItems.reserve(dirtyEdges.size());
+    caches.reserve(dirtyEdges.size());
+    for (const auto& edgeItem : dirtyEdges) {
+        if (!edgeItem ||
+            !edgeItem->_updateScheduled)    // Might have already been updated with a direct updateItem() call
+            continue;
+        if (!edgeItem->supportsConcurrentGeometry()) {
+            customEdgeItems.push_back(edgeItem);
+            continue;
+        }
+        edgeItem->_updateScheduled = false;
+        edgeItems.push_back(edgeItem.data());
+        caches.push_back(edgeItem->generateGeometryCache());
+    }
+
+    const auto count = caches.size();                       // 2.
+    const auto generate = [&edgeItems, &caches](std::size_t first, std::size_t last) {
+        for (auto c = first; c < last; c++)
+            edgeItems[c]->generateGeometry(caches[c]);
+    };
+    static constexpr std::size_t minChunkSize = 256;    // Do not pay threads synchronization for a few edges
+    const auto threadCount = static_cast<std::size_t>(std::max(0, _edgesGeometryPool.maxThreadCount()));
+    const auto chunkCount = std::min(threadCount + 1, count / minChunkSize);
+    if (chunkCount <= 1)
+        generate(0, count);
+    else {
+        const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+        for (std::size_t chunk = 1; chunk < chunkCount; chunk++) {
+            const auto first = chunk * chunkSize;
+            const auto last = std::min(count, first + chunkSize);
+            if (first < last)
+                _edgesGeometryPool.start([&generate, first, last]() { generate(first, last); });
+        }
+        generate(0, std::min(count, chunkSize));
+        _edgesGeometryPool.waitForDone();
+    }
+
+    for (std::size_t c = 0; c < count; c++)                 // 3.
+        edgeItems[c]->applyGeometryCache(caches[c]);
+    for (const auto& edgeItem : customEdgeItems)
+        if (edgeItem &&
+            edgeItem->_updateScheduled)
+            edgeItem->updateItem();
+}
+
+void    Graph::updatePolish()
+{
+    QQuickItem::updatePolish();
+    if (_virtualizationScheduled)
+        updateVirtualization();
+    if (_incubationScheduled)
+        incubatePendingItems();
+    if (!_dirtyIndexItems.empty())
+        updateSpatialIndex();
+    updateDirtyEdges();
+}
+
+void    Graph::setOrthoRouting(bool orthoRouting)
+{
+    if (orthoRouting == _orthoRouting)
+        return;
+    _orthoRouting = orthoRouting;
+    _orthoRouter.clear();
+    _dirtyObstacles.clear();
+    for (const auto node : get_nodes()) {
+        const auto nodeItem = node != nullptr ? node->getItem() : nullptr;
+        if (nodeItem == nullptr)
+            continue;
+        connectObstacle(nodeItem, _orthoRouting);
+        if (_orthoRouting)
+            scheduleObstacleUpdate(nodeItem);
+    }
+    for (const auto edge : get_edges())     // Route (or restore default geometry of) all edges
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            edge->getItem()->updateItemSlot();
+    polish();
+    emit orthoRoutingChanged();
+}
+
+void    Graph::connectObstacle(qan::NodeItem* nodeItem, bool enable)
+{
+    if (nodeItem == nullptr)
+        return;
+    const auto geometrySignals = {&QQuickItem::xChanged, &QQuickItem::yChanged,
+                                  &QQuickItem::widthChanged, &QQuickItem::heightChanged};
+    for (const auto signal : geometrySignals) {
+        if (enable)
+            QObject::connect(nodeItem, signal, this, &Graph::onObstacleGeometryChanged, Qt::UniqueConnection);
+        else
+            QObject::disconnect(nodeItem, signal, this, &Graph::onObstacleGeometryChanged);
+    }
+}
+
+void    Graph::scheduleObstacleUpdate(qan::NodeItem* nodeItem)
+{
+    if (nodeItem == nullptr ||
+        nodeItem->getNode() == nullptr)
+        return;
+    if (nodeItem->getNode()->isGroup()) {   // Group content has moved in graph CS
+        for (const auto node : nodeItem->getNode()->get_nodes())
+            if (node != nullptr)
+                scheduleObstacleUpdate(node->getItem());
+        return;
+    }
+    if (_dirtyObstacles.empty())
+        polish();
+    _dirtyObstacles.emplace_back(nodeItem);
+}
+
+void    Graph::onObstacleGeometryChanged()
+{
+    scheduleObstacleUpdate(qobject_cast<qan::NodeItem*>(sender()));
+}
+
+void    Graph::updateObstacles()
+{
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
+        return;
+    std::vector<qan::OrthoRouter::Key> routes;
+    for (const auto& nodeItem : _dirtyObstacles) {
+        if (!nodeItem)
+            continue;
+        const QRectF nodeRect = nodeItem->mapRectToItem(containerItem, QRectF{0., 0., nodeItem->width(), nodeItem->height()});
+        _orthoRouter.setObstacle(nodeItem.data(), nodeRect, routes);
+    }
+    _dirtyObstacles.clear();
+    scheduleRoutesUpdate(routes);
+}
+
+void    Graph::scheduleRoutesUpdate(const std::vector<qan::OrthoRouter::Key>& routes)
+{
+    // Note: Routes keys are edge items (see qan::EdgeItem::applyGeometryCache()), edge items remove their
+    // route on destruction.
+    for (const auto route : routes) {
+        auto edgeItem = const_cast<qan::EdgeItem*>(static_cast<const qan::EdgeItem*>(route));
+        if (!edgeItem->_updateScheduled) {
+            edgeItem->_updateScheduled = true;
+            if (_dirtyEdges.empty())
+                polish();
+            _dirtyEdges.emplace_back(edgeItem);
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Virtualization *///---------------------------------------------------
+void    Graph::setVirtualized(bool virtualized)
+{
+    if (virtualized == _virtualized)
+        return;
+    _virtualized = virtualized;
+    if (_virtualized) {     // Index all nodes, edges are indexed with their source and destination nodes
+        for (const auto node : get_nodes())
+            if (node != nullptr)
+                scheduleVirtualizationUpdate(*node);
+    } else {      // Realize all virtualized items
+        _virtualizationScheduled = false;
+        clearVirtualizationIndex();
+        for (const auto node : get_nodes())
+            if (node != nullptr)
+                realizeNode(node);
+        for (const auto edge : get_edges())
+            if (edge != nullptr)
+                realizeEdge(*edge);
+    }
+    emit virtualizedChanged();
+}
+
+void    Graph::setViewportRect(const QRectF& viewportRect)
+{
+    if (viewportRect == _viewportRect)
+        return;
+    _viewportRect = viewportRect;
+    scheduleVirtualizationUpdate();
+    emit viewportRectChanged();
+}
+
+void    Graph::setVirtualizationMargin(qreal virtualizationMargin)
+{
+    if (qFuzzyCompare(1. + virtualizationMargin, 1. + _virtualizationMargin))
+        return;
+    _virtualizationMargin = std::max(0., virtualizationMargin);
+    scheduleVirtualizationUpdate();
+    emit virtualizationMarginChanged();
+}
+
+void    Graph::scheduleVirtualizationUpdate()
+{
+    if (!_virtualized ||
+        _virtualizationScheduled)
+        return;
+    _virtualizationScheduled = true;
+    polish();
+}
+
+void    Graph::scheduleVirtualizationUpdate(qan::Node& node)
+{
+    if (!_virtualized)
+        return;
+    if (_dirtyVirtualNodes.empty() ||
+        _dirtyVirtualNodes.back() != &node)     // Item x, y, width and height changes usually come in a row
+        _dirtyVirtualNodes.emplace_back(&node);
+    scheduleVirtualizationUpdate();
+}
+
+void    Graph::scheduleVirtualizationUpdate(qan::Edge& edge)
+{
+    if (!_virtualized)
+        return;
+    _dirtyVirtualEdges.emplace_back(&edge);
+    scheduleVirtualizationUpdate();
+}
+
+void    Graph::updateVirtualization()
+{
+    // Algorithm:
+        // 0. Update dirty nodes and edges rects in virtualization index.
+        // 1. Release realized edges that are out of view.
+        // 2. Release realized nodes that are out of view and no longer have adjacent edge items.
+        // 3. Realize edges in view and their source and destination nodes.
+        // 4. Realize nodes in view.
+    // Items are realized when they intersect view inflated by margin, but released only when more than
+    // two margins away from view: panning back and forth does not create and destroy the same items.
+    // Only the realized primitives are checked for release, realized primitives are queried from
+    // virtualization index: cost is proportional to the number of items in view, not to graph size.
+    _virtualizationScheduled = false;
+    if (!_virtualized)
+        return;
+    updateVirtualizationIndex();                                                // 0.
+    const qreal m = _virtualizationMargin;
+    const QRectF realizeRect = _viewportRect.adjusted(-m, -m, m, m);
+    const QRectF releaseRect = _viewportRect.adjusted(-2. * m, -2. * m, 2. * m, 2. * m);
+    const auto inReleaseRect = [&](const qan::SpatialIndex& index, qan::SpatialIndex::Key key) {
+        QRectF rect;
+        return !_viewportRect.isEmpty() &&
+               index.getRect(key, rect) &&
+               rect.intersects(releaseRect);
+    };
+
+    auto& keys = _virtualizationKeys;                                           // 1.
+    keys.clear();
+    for (const auto edge : _realizedEdges)
+        if (!inReleaseRect(_virtualEdgesIndex, edge) &&
+            isEdgeVirtualizable(*edge))
+            keys.push_back(edge);
+    for (const auto key : keys)
+        releaseEdgeItem(*static_cast<qan::Edge*>(const_cast<void*>(key)));
+
+    keys.clear();                                                               // 2.
+    for (const auto node : _realizedNodes)
+        if (!inReleaseRect(_virtualNodesIndex, node) &&
+            isNodeVirtualizable(*node))
+            keys.push_back(node);
+    for (const auto key : keys) {
+        auto& node = *static_cast<qan::Node*>(const_cast<void*>(key));
+        const auto hasEdgeItem = [](const auto& edges) {
+            return std::any_of(edges.cbegin(), edges.cend(), [](const auto& edge) {
+                return edge != nullptr && edge->getItem() != nullptr; });
+        };
+        if (!hasEdgeItem(node.get_in_edges()) &&    // Node is required by an edge in view
+            !hasEdgeItem(node.get_out_edges()))
+            releaseNodeItem(node);
+    }
+    if (_viewportRect.isEmpty())
+        return;
+
+    keys.clear();                                                               // 3.
+    _virtualEdgesIndex.itemsIn(realizeRect, keys);
+    for (const auto key : keys) {
+        auto& edge = *static_cast<qan::Edge*>(const_cast<void*>(key));
+        if (edge.getItem() != nullptr)
+            continue;
+        realizeNode(edge.get_src());
+        realizeNode(edge.get_dst());
+        realizeEdge(edge);
+    }
+
+    keys.clear();                                                               // 4.
+    _virtualNodesIndex.itemsIn(realizeRect, keys);
+    for (const auto key : keys) {
+        const auto node = static_cast<qan::Node*>(const_cast<void*>(key));
+        if (node->getItem() == nullptr)
+            realizeNode(node);
+    }
+    keys.clear();
+}
+
+qan::NodeItem*  Graph::realizeNode(qan::Node* node)
+{
+    if (node == nullptr)
+        return nullptr;
+    if (node->getItem() != nullptr)
+        return node->getItem();
+    const auto nodeComponent = node->getItemComponent();
+    const auto nodeStyle = node->getItemStyle();
+    if (nodeComponent == nullptr ||
+        nodeStyle == nullptr)
+        return nullptr;
+    const QRectF geometry = node->getItemGeometry();    // Stored geometry, item does not exist yet
+    const auto nodeItem = createNodeItem(*node, *nodeComponent, *nodeStyle);
+    if (nodeItem != nullptr) {
+        nodeItem->setPosition(geometry.topLeft());
+        if (!geometry.isEmpty())                         // Otherwise, keep delegate default size
+            nodeItem->setSize(geometry.size());
+        if (_virtualNodesIndex.contains(node))
+            _realizedNodes.insert(node);
+        emit nodeItemRealized(node);
+    }
+    return nodeItem;
+}
+
+qan::EdgeItem*  Graph::realizeEdge(qan::Edge& edge)
+{
+    if (edge.getItem() != nullptr)
+        return edge.getItem();
+    const auto edgeComponent = edge.getItemComponent();
+    const auto edgeStyle = edge.getItemStyle();
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (edgeComponent == nullptr ||
+        edgeStyle == nullptr ||
+        src == nullptr ||
+        src->getItem() == nullptr ||
+        (dst != nullptr && dst->getItem() == nullptr))
+        return nullptr;
+    const auto edgeItem = createEdgeItem(edge, *edgeComponent, *edgeStyle);
+    if (edgeItem != nullptr) {
+        if (_virtualEdgesIndex.contains(&edge))
+            _realizedEdges.insert(&edge);
+        emit edgeItemRealized(&edge);
+    }
+    return edgeItem;
+}
+
+bool    Graph::isNodeVirtualizable(const qan::Node& node) const
+{
+    if (node.isGroup() ||
+        node.getGroup() != nullptr)     // Group items and their content are managed by group
+        return false;
+    const auto nodeItem = node.getItem();
+    return nodeItem == nullptr ||
+           (!nodeItem->getSelected() &&
+            !nodeItem->getDragged() &&
+            nodeItem->getPorts().size() == 0);  // Edges might be bound to ports
+}
+
+bool    Graph::isEdgeVirtualizable(qan::Edge& edge) const
+{
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    if (src == nullptr ||
+        dst == nullptr ||
+        src->isGroup() || dst->isGroup() ||
+        src->getGroup() != nullptr ||
+        dst->getGroup() != nullptr)
+        return false;
+    const auto edgeItem = edge.getItem();
+    return edgeItem == nullptr ||
+           (!edgeItem->getSelected() &&
+            edgeItem->getSourceItem() == src->getItem() &&       // Not bound to a port
+            edgeItem->getDestinationItem() == dst->getItem());
+}
+
+void    Graph::releaseNodeItem(qan::Node& node)
+{
+    _realizedNodes.erase(&node);
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+    if (_orthoRouting) {    // Node is no longer an obstacle
+        std::vector<qan::OrthoRouter::Key> routes;
+        _orthoRouter.removeObstacle(nodeItem, routes);
+        scheduleRoutesUpdate(routes);
+    }
+    if (!poolNodeItem(node)) {
+        indexItem(nodeItem, false);
+        node.releaseItem();
+    }
+}
+
+void    Graph::releaseEdgeItem(qan::Edge& edge)
+{
+    _realizedEdges.erase(&edge);
+    if (!poolEdgeItem(edge)) {
+        indexItem(edge.getItem(), false);
+        edge.releaseItem();
+    }
+}
+
+bool    Graph::isNodeIndexable(const qan::Node& node) const
+{
+    return node.getItemComponent() != nullptr &&
+           !node.isGroup() &&
+           node.getGroup() == nullptr;     // Group items and their content are managed by group
+}
+
+bool    Graph::isEdgeIndexable(const qan::Edge& edge) const
+{
+    const auto src = edge.get_src();
+    const auto dst = edge.get_dst();
+    return edge.getItemComponent() != nullptr &&
+           src != nullptr && dst != nullptr &&  // Edges connected to edges are never virtualized
+           !src->isGroup() && !dst->isGroup() &&
+           src->getGroup() == nullptr &&
+           dst->getGroup() == nullptr;
+}
+
+void    Graph::updateVirtualizationIndex()
+{
+    // Note: index based loops, realizing non virtualizable primitives might schedule other updates.
+    for (std::size_t n = 0; n < _dirtyVirtualNodes.size(); n++) {
+        const QPointer<qan::Node> node = _dirtyVirtualNodes[n];
+        if (!node)
+            continue;
+        indexVirtualNode(*node);
+        for (const auto& inEdge : node->get_in_edges())    // Edges rects depend on their nodes geometry
+            if (inEdge != nullptr)
+                _dirtyVirtualEdges.emplace_back(inEdge);
+        for (const auto& outEdge : node->get_out_edges())
+            if (outEdge != nullptr)
+                _dirtyVirtualEdges.emplace_back(outEdge);
+    }
+    _dirtyVirtualNodes.clear();
+    for (std::size_t e = 0; e < _dirtyVirtualEdges.size(); e++) {
+        const QPointer<qan::Edge> edge = _dirtyVirtualEdges[e];
+        if (edge)
+            indexVirtualEdge(*edge);
+    }
+    _dirtyVirtualEdges.clear();
+}
+
+namespace { // ::qan::
+
+//! Node rect in virtualization index: node that have never been realized might have an empty size.
+QRectF  virtualNodeRect(const qan::Node& node)
+{
+    const QRectF rect = node.getItemGeometry();
+    return rect.isEmpty() ? QRectF{rect.topLeft(), QSizeF{1., 1.}} : rect;
+}
+
+} // ::qan::
+
+void    Graph::indexVirtualNode(qan::Node& node)
+{
+    const auto nodePtr = &node;     // Note: node is no longer a qan::Node when destroyed() is emitted
+    if (!isNodeIndexable(node)) {
+        if (_virtualNodesIndex.contains(nodePtr)) {
+            QObject::disconnect(nodePtr, &QObject::destroyed, this, nullptr);
+            _virtualNodesIndex.remove(nodePtr);
+            _realizedNodes.erase(nodePtr);
+        }
+        realizeNode(nodePtr);       // Nodes that can't be indexed are never virtualized
+        return;
+    }
+    if (!_virtualNodesIndex.contains(nodePtr))
+        QObject::connect(nodePtr, &QObject::destroyed, this, [this, nodePtr]() {
+            _virtualNodesIndex.remove(nodePtr);
+            _realizedNodes.erase(nodePtr);
+        });
+    _virtualNodesIndex.setRect(nodePtr, virtualNodeRect(node));
+    if (node.getItem() != nullptr)
+        _realizedNodes.insert(nodePtr);
+}
+
+void    Graph::indexVirtualEdge(qan::Edge& edge)
+{
+    const auto edgePtr = &edge;
+    if (!isEdgeIndexable(edge)) {
+        if (_virtualEdgesIndex.contains(edgePtr)) {
+            QObject::disconnect(edgePtr, &QObject::destroyed, this, nullptr);
+            _virtualEdgesIndex.remove(edgePtr);
+            _realizedEdges.erase(edgePtr);
+        }
+        if (edge.getItemComponent() != nullptr) {   // Visual edges that can't be indexed are never virtualized
+            realizeNode(edge.get_src());
+            realizeNode(edge.get_dst());
+            realizeEdge(edge);
+        }
+        return;
+    }
+    if (!_virtualEdgesIndex.contains(edgePtr))
+        QObject::connect(edgePtr, &QObject::destroyed, this, [this, edgePtr]() {
+            _virtualEdgesIndex.remove(edgePtr);
+            _realizedEdges.erase(edgePtr);
+        });
+    _virtualEdgesIndex.setRect(edgePtr, virtualNodeRect(*edge.get_src()).united(virtualNodeRect(*edge.get_dst())));
+    if (edge.getItem() != nullptr)
+        _realizedEdges.insert(edgePtr);
+}
+
+void    Graph::clearVirtualizationIndex()
+{
+    for (const auto node : get_nodes())
+        if (node != nullptr &&
+            _virtualNodesIndex.contains(node))
+            QObject::disconnect(node, &QObject::destroyed, this, nullptr);
+    for (const auto edge : get_edges())
+        if (edge != nullptr &&
+            _virtualEdgesIndex.contains(edge))
+            QObject::disconnect(edge, &QObject::destroyed, this, nullptr);
+    _virtualNodesIndex.clear();
+    _virtualEdgesIndex.clear();
+    _realizedNodes.clear();
+    _realizedEdges.clear();
+    _dirtyVirtualNodes.clear();
+    _dirtyVirtualEdges.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Asynchronous Items Creation *///-------------------------------------
+void    Graph::setAsynchronous(bool asynchronous)
+{
+    if (asynchronous == _asynchronous)
+        return;
+    _asynchronous = asynchronous;
+    if (!_asynchronous)
+        completePendingItems();
+    emit asynchronousChanged();
+}
+
+void    Graph::setIncubationBudget(int incubationBudget)
+{
+    incubationBudget = std::max(1, incubationBudget);   // At least one item is started per frame
+    if (incubationBudget == _incubationBudget)
+        return;
+    _incubationBudget = incubationBudget;
+    emit incubationBudgetChanged();
+}
+
+int     Graph::getPendingItemCount() const noexcept
+{
+    auto count = static_cast<int>(_pendingNodes.size() + _pendingEdges.size());
+    for (const auto& incubator : _incubators)
+        if (!incubator->isInstalled())      // Loading or waiting for installation
+            ++count;
+    return count;
+}
+
+void    Graph::completePendingItems()
+{
+    // Note: Forced items are installed in onItemIncubated(), index based loops since user code called from
+    // nodeItemRealized() and edgeItemRealized() might insert other nodes or edges.
+    _completingItems = true;
+    while (!_incubatedItems.empty()) {
+        const auto incubator = _incubatedItems.front();
+        _incubatedItems.pop_front();
+        installIncubatedItem(*incubator);
+    }
+    for (std::size_t i = 0; i < _incubators.size(); i++)
+        if (_incubators[i]->isLoading())
+            _incubators[i]->forceCompletion();
+    while (!_pendingNodes.empty()) {
+        const QPointer<qan::Node> node = _pendingNodes.front();
+        _pendingNodes.pop_front();
+        if (node &&
+            node->getItem() == nullptr)
+            incubateNode(*node, true);
+    }
+    std::vector<QPointer<qan::Edge>> pendingEdges;
+    pendingEdges.swap(_pendingEdges);
+    for (const auto& edge : pendingEdges)
+        if (edge &&
+            edge->getItem() == nullptr)
+            incubateEdge(*edge, true);
+    _completingItems = false;
+    notifyPendingItemCount();
+}
+
+void    Graph::scheduleIncubation()
+{
+    if (_incubationScheduled)
+        return;
+    _incubationScheduled = true;
+    polish();
+}
+
+void    Graph::incubatePendingItems()
+{
+    // Algorithm:
+        // 1. Install ready incubated items until incubationBudget is consumed (user code connected to
+        //    nodeItemRealized() and edgeItemRealized() is run there), then remove installed incubators.
+        // 2. With remaining budget, start pending nodes incubation.
+        // 3. With remaining budget, start incubation of pending edges whose source and destination
+        //    nodes are no longer waiting for their item.
+        // 4. Schedule a new pass on next frame if budget has been consumed, completed incubations
+        //    schedule a pass too (waiting edges might now be incubated).
+    _incubationScheduled = false;
+    QElapsedTimer timer;
+    timer.start();
+    const auto inBudget = [this, &timer]() { return timer.elapsed() < _incubationBudget; };
+    while (!_incubatedItems.empty() &&                                          // 1.
+           inBudget()) {
+        const auto incubator = _incubatedItems.front();
+        _incubatedItems.pop_front();
+        installIncubatedItem(*incubator);
+    }
+    _incubators.erase(std::remove_if(_incubators.begin(), _incubators.end(),
+                                     [](const auto& incubator) { return incubator->isInstalled(); }),
+                      _incubators.end());
+
+    while (!_pendingNodes.empty() &&                                             // 2.
+           inBudget()) {
+        const QPointer<qan::Node> node = _pendingNodes.front();
+        _pendingNodes.pop_front();
+        if (node &&
+            node->getItem() == nullptr)
+            incubateNode(*node, false);
+    }
+
+    std::unordered_set<const qan::Node*> waitingNodes;                         // 3.
+    for (const auto& node : _pendingNodes)
+        if (node)
+            waitingNodes.insert(node.data());
+    for (const auto& incubator : _incubators)
+        if (!incubator->isInstalled() &&
+            incubator->getNode() != nullptr)
+            waitingNodes.insert(incubator->getNode());
+    const auto isWaiting = [&waitingNodes](const qan::Node* node) {
+        return node != nullptr &&
+               waitingNodes.find(node) != waitingNodes.end();
+    };
+    std::vector<QPointer<qan::Edge>> pendingEdges;      // Edges might be inserted from user code during incubation
+    pendingEdges.swap(_pendingEdges);
+    for (const auto& edge : pendingEdges) {
+        if (!edge ||
+            edge->getItem() != nullptr)
+            continue;
+        if (!inBudget() ||
+            isWaiting(edge->get_src()) ||
+            isWaiting(edge->get_dst()))
+            _pendingEdges.push_back(edge);
+        else
+            incubateEdge(*edge, false);
+    }
+
+    if (!_incubatedItems.empty() ||                                            // 4.
+        !_pendingNodes.empty() ||
+        (!_pendingEdges.empty() && !inBudget()))
+        QMetaObject::invokeMethod(this, [this]() { scheduleIncubation(); }, Qt::QueuedConnection);
+    notifyPendingItemCount();
+}
+
+void    Graph::incubateNode(qan::Node& node, bool synchronous)
+{
+    const auto nodeComponent = node.getItemComponent();
+    const auto nodeStyle = node.getItemStyle();
+    if (nodeComponent == nullptr ||
+        nodeStyle == nullptr)
+        return;
+    const auto context = qmlContext(this);
+    if (synchronous ||
+        context == nullptr ||
+        hasPooledItem(*nodeComponent)) {    // Pooled items are reused synchronously, they are cheap to configure
+        realizeNode(&node);
+        return;
+    }
+    auto incubator = std::make_unique<qan::ItemIncubator>(*this, *nodeStyle, &node, nullptr);
+    const auto nodeIncubator = incubator.get();
+    _incubators.push_back(std::move(incubator));
+    nodeComponent->create(*nodeIncubator, context);   // Might complete synchronously without an incubation controller
+}
+
+void    Graph::incubateEdge(qan::Edge& edge, bool synchronous)
+{
+    const auto edgeComponent = edge.getItemComponent();
+    const auto edgeStyle = edge.getItemStyle();
+    if (edgeComponent == nullptr ||
+        edgeStyle == nullptr)
+        return;
+    const auto context = qmlContext(this);
+    if (synchronous ||
+        context == nullptr ||
+        hasPooledItem(*edgeComponent)) {
+        if (createEdgeItem(edge, *edgeComponent, *edgeStyle) != nullptr)
+            emit edgeItemRealized(&edge);
+        return;
+    }
+    auto incubator = std::make_unique<qan::ItemIncubator>(*this, *edgeStyle, nullptr, &edge);
+    const auto edgeIncubator = incubator.get();
+    _incubators.push_back(std::move(incubator));
+    edgeComponent->create(*edgeIncubator, context);
+}
+
+bool    Graph::hasPooledItem(const QQmlComponent& component) const
+{
+    if (!_reuseItems)
+        return false;
+    const auto pool = _itemPools.find(&component);
+    return pool != _itemPools.end() &&
+           !pool->second.items.empty();
+}
+
+void    Graph::initIncubatedItem(qan::ItemIncubator& incubator, QObject* object)
+{
+    // Note: Edge is bound to its item only once incubation is ready, qan::EdgeItem::setEdge() would
+    // otherwise expose an incomplete item with qan::Edge::getItem().
+    if (incubator.getNode() != nullptr) {
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+        if (nodeItem != nullptr) {
+            nodeItem->setNode(incubator.getNode());
+            nodeItem->setGraph(this);
+            nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(incubator.getStyle()));
+            nodeItem->setLevelOfDetail(_levelOfDetail);
+        }
+    } else if (incubator.getEdge() != nullptr) {
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(object);
+        if (edgeItem != nullptr) {
+            edgeItem->setGraph(this);
+            edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(incubator.getStyle()));
+        }
+    }
+}
+
+void    Graph::onItemIncubated(qan::ItemIncubator& incubator)
+{
+    if (_completingItems) {
+        installIncubatedItem(incubator);
+        return;
+    }
+    // Note: incubator might be completed synchronously from updatePolish(), do not polish() directly.
+    _incubatedItems.push_back(&incubator);
+    QMetaObject::invokeMethod(this, [this]() { scheduleIncubation(); }, Qt::QueuedConnection);
+}
+
+void    Graph::installIncubatedItem(qan::ItemIncubator& incubator)
+{
+    if (incubator.isInstalled())
+        return;
+    incubator.setInstalled();
+    const auto object = incubator.object();
+    if (incubator.isError() ||
+        object == nullptr)
+        qWarning() << "qan::Graph::onItemIncubated(): Error: " << incubator.errors();
+    else {
+        QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
+        const auto node = incubator.getNode();
+        const auto edge = incubator.getEdge();
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(object);
+        if (node != nullptr &&
+            nodeItem != nullptr &&
+            node->getItem() == nullptr) {
+            nodeItem->setVisible(true);
+            nodeItem->setParentItem(getContainerItem());
+            initNodeItem(*node, *nodeItem);
+            const QRectF geometry = node->getItemGeometry();    // Stored geometry, see qan::Node::setItemGeometry()
+            nodeItem->setPosition(geometry.topLeft());
+            if (!geometry.isEmpty())
+                nodeItem->setSize(geometry.size());
+            emit nodeItemRealized(node);
+        } else if (edge != nullptr &&
+                   edgeItem != nullptr &&
+                   edge->getItem() == nullptr) {
+            edgeItem->setVisible(true);
+            edgeItem->setParentItem(getContainerItem());
+            initEdgeItem(*edge, *edgeItem);
+            emit edgeItemRealized(edge);
+        } else      // Node or edge has been removed (or its item created) during incubation
+            object->deleteLater();
+    }
+}
+
+void    Graph::notifyPendingItemCount()
+{
+    const auto count = getPendingItemCount();
+    if (count != _notifiedPendingItemCount) {
+        _notifiedPendingItemCount = count;
+        emit pendingItemCountChanged();
+    }
+    if (count == 0 &&
+        _incubating) {
+        _incubating = false;
+        emit itemsIncubated();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Level of Detail *///-------------------------------------------------
+void    Graph::setLevelOfDetail(qan::NodeItem::LevelOfDetail levelOfDetail)
+{
+    if (levelOfDetail == _levelOfDetail)
+        return;
+    _levelOfDetail = levelOfDetail;
+    for (const auto node : get_nodes()) {   // Note: groups are nodes
+        const auto nodeItem = node != nullptr ? node->getItem() : nullptr;
+        if (nodeItem != nullptr)
+            nodeItem->setLevelOfDetail(_levelOfDetail);
+    }
+    emit levelOfDetailChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Spatial Index *///---------------------------------------------------
+QList<QQuickItem*>  Graph::itemsIn(const QRectF& rect) const
+{
+    updateSpatialIndex();
+    std::vector<qan::SpatialIndex::Key> keys;
+    _spatialIndex.itemsIn(rect, keys);
+    QList<QQuickItem*> items;
+    items.reserve(static_cast<int>(keys.size()));
+    for (const auto key : keys) {
+        const auto item = const_cast<QQuickItem*>(static_cast<const QQuickItem*>(key));
+        if (isIndexedItemValid(item)) {
+            QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+            items.append(item);
+        }
+    }
+    return items;
+}
+
+QQuickItem* Graph::itemAt(const QPointF& point) const
+{
+    const auto containerItem = getContainerItem();
+    if (containerItem == nullptr)
+        return nullptr;
+    updateSpatialIndex();
+    std::vector<qan::SpatialIndex::Key> keys;
+    _spatialIndex.itemsAt(point, keys);
+
+    // Return the item with maximum global z containing point, at equal z, nodes are
+    // prefered over groups, and groups over edges, then last painted item is prefered.
+    QQuickItem* topItem = nullptr;
+    std::pair<qreal, int> topZ{0., 0};
+    for (const auto key : keys) {
+        const auto item = const_cast<QQuickItem*>(static_cast<const QQuickItem*>(key));
+        if (!isIndexedItemValid(item))
+            continue;
+        const QPointF p = item->mapFromItem(containerItem, point);
+        if (!item->contains(p) ||      // Note: contains() take edges shape into account
+            p.x() < -0.0001 || p.x() > item->width() ||
+            p.y() < -0.0001 || p.y() > item->height())
+            continue;
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        const std::pair<qreal, int> z = nodeItem != nullptr ?
+                    std::make_pair(nodeItem->getGlobalZ(), nodeItem->getNode()->isGroup() ? 1 : 2) :
+                    std::make_pair(item->z(), 0);   // Edges are always container item childs
+        if (topItem == nullptr ||
+            z > topZ ||
+            (z == topZ && qan::isItemStackedAbove(item, topItem))) {    // At equal z, item painted last wins
+            topItem = item;
+            topZ = z;
+        }
+    }
+    if (topItem != nullptr)
+        QQmlEngine::setObjectOwnership(topItem, QQmlEngine::CppOwnership);
+    return topItem;
+}
+
+QList<QQuickItem*>  Graph::nearest(const QPointF& point, int k) const
+{
+    QList<QQuickItem*> items;
+    if (k <= 0)
+        return items;
+    updateSpatialIndex();
+    // Invisible or unbound items are filtered out after index query: query more items until k valid items are found.
+    std::vector<qan::SpatialIndex::Key> keys;
+    for (int n = k; ; n *= 2) {
+        keys.clear();
+        _spatialIndex.nearest(point, n, keys);
+        items.clear();
+        for (const auto key : keys) {
+            const auto item = const_cast<QQuickItem*>(static_cast<const QQuickItem*>(key));
+            if (isIndexedItemValid(item))
+                items.append(item);
+            if (items.size() == k)
+                break;
+        }
+        if (items.size() == k ||
+            static_cast<int>(keys.size()) < n)  // All index items have been queried
+            break;
+    }
+    for (const auto item : qAsConst(items))
+        QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+    return items;
+}
+
+const qan::SpatialIndex&    Graph::getSpatialIndex() const
+{
+    updateSpatialIndex();
+    return _spatialIndex;
+}
+
+void    Graph::indexItem(QQuickItem* item, bool enable)
+{
+    if (item == nullptr)
+        return;
+    const auto geometrySignals = {&QQuickItem::xChanged, &QQuickItem::yChanged,
+                                  &QQuickItem::widthChanged, &QQuickItem::heightChanged};
+    for (const auto signal : geometrySignals) {
+        if (enable)
+            QObject::connect(item, signal, this, &Graph::onIndexedItemGeometryChanged, Qt::UniqueConnection);
+        else
+            QObject::disconnect(item, signal, this, &Graph::onIndexedItemGeometryChanged);
+    }
+    const auto groupItem = qobject_cast<qan::GroupItem*>(item);
+    if (enable) {
+        QObject::connect(item, &QQuickItem::parentChanged, this, &Graph::onIndexedItemGeometryChanged, Qt::UniqueConnection);
+        if (groupItem != nullptr)   // Collapsed groups are not indexed in groups index
+            QObject::connect(groupItem, &qan::NodeItem::collapsedChanged, this, &Graph::onIndexedItemGeometryChanged, Qt::UniqueConnection);
+        const qan::SpatialIndex::Key key = item;   // Note: item is no longer a QQuickItem when destroyed() is emitted
+        QObject::connect(item, &QObject::destroyed, this, [this, key]() {
+            _spatialIndex.remove(key);
+            _groupsIndex.remove(key);
+        });
+        scheduleIndexUpdate(item);
+    } else {
+        QObject::disconnect(item, &QQuickItem::parentChanged, this, &Graph::onIndexedItemGeometryChanged);
+        if (groupItem != nullptr)
+            QObject::disconnect(groupItem, &qan::NodeItem::collapsedChanged, this, &Graph::onIndexedItemGeometryChanged);
+        QObject::disconnect(item, &QObject::destroyed, this, nullptr);
+        _spatialIndex.remove(item);
+        _groupsIndex.remove(item);
+    }
+}
+
+void    Graph::scheduleIndexUpdate(QQuickItem* item)
+{
+    if (item == nullptr)
+        return;
+    const auto groupItem = qobject_cast<qan::GroupItem*>(item);
+    if (groupItem != nullptr &&
+        groupItem->getGroup() != nullptr) {     // Group content has moved in container CS
+        for (const auto node : groupItem->getGroup()->get_nodes())
+            if (node != nullptr)
+                scheduleIndexUpdate(node->getItem());
+    } else if (_virtualized) {                  // Node geometry has changed in virtualization index
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        if (nodeItem != nullptr &&
+            nodeItem->getNode() != nullptr)
+            scheduleVirtualizationUpdate(*nodeItem->getNode());
+    }
+    if (_dirtyIndexItems.empty())
+        polish();
+    _dirtyIndexItems.emplace_back(item);
 }
 
-bool    Graph::removeEdge(qan::Node* source, qan::Node* destination) {
-    return super_t::remove_edge(source, destination);
+void    Graph::onIndexedItemGeometryChanged()
+{
+    scheduleIndexUpdate(qobject_cast<QQuickItem*>(sender()));
 }
-bool    Graph::removeEdge(qan::Edge* edge, bool force) {
-    if (edge == nullptr)
-        return false;
-    if (!force &&
-        (edge->getIsProtected() ||
-         edge->getLocked()))
-        return false;
-    _selectedEdges.removeAll(edge);
-    emit onEdgeRemoved(edge);
-    return super_t::remove_edge(edge);
+
+void    Graph::updateSpatialIndex() const
+{
+    if (_dirtyIndexItems.empty())
+        return;
+    const auto containerItem = getContainerItem();
+    for (const auto& item : _dirtyIndexItems) {
+        if (!item)
+            continue;
+        const auto nodeItem = qobject_cast<const qan::NodeItem*>(item.data());
+        const auto edgeItem = qobject_cast<const qan::EdgeItem*>(item.data());
+        const bool bound = (nodeItem != nullptr && nodeItem->getNode() != nullptr) ||
+                           (edgeItem != nullptr && edgeItem->getEdge() != nullptr);
+        if (containerItem == nullptr ||
+            item->parentItem() == nullptr ||
+            !bound) {
+            _spatialIndex.remove(item.data());
+            _groupsIndex.remove(item.data());
+            continue;
+        }
+        const QRectF itemRect = item->mapRectToItem(containerItem, QRectF{0., 0., item->width(), item->height()});
+        _spatialIndex.setRect(item.data(), itemRect);
+        const auto groupItem = qobject_cast<const qan::GroupItem*>(item.data());
+        if (groupItem != nullptr) {     // Collapsed groups can't be drop targets
+            if (groupItem->getCollapsed())
+                _groupsIndex.remove(item.data());
+            else
+                _groupsIndex.setRect(item.data(), itemRect);
+        }
+    }
+    _dirtyIndexItems.clear();
 }
 
-bool    Graph::hasEdge(const qan::Node* source, const qan::Node* destination) const
+bool    Graph::isIndexedItemValid(const QQuickItem* item) noexcept
 {
-    if (source == nullptr || destination == nullptr)
+    if (item == nullptr ||
+        !item->isVisible())
         return false;
-    return super_t::has_edge(source, destination);
+    if (const auto nodeItem = qobject_cast<const qan::NodeItem*>(item))
+        return nodeItem->getNode() != nullptr;
+    if (const auto edgeItem = qobject_cast<const qan::EdgeItem*>(item))
+        return edgeItem->getEdge() != nullptr;
+    return false;
 }
-
-bool    Graph::hasEdge(const qan::Edge* edge) const { return hasEdge(edge->get_src(), edge->get_dst()); }
 //-----------------------------------------------------------------------------
 
 /* Graph Group Management *///-------------------------------------------------
@@ -992,6 +2386,9 @@ bool    Graph::insertGroup(Group* group, QQmlComponent* groupComponent, qan::Nod
             const auto z = nextMaxZ();
             groupItem->setZ(z);
         }
+        if (_orthoRouting)      // Group are not obstacles, but moving a group move its content
+            connectObstacle(groupItem, true);
+        indexItem(groupItem, true);
     }
     if (group != nullptr) {       // Notify user.
         onNodeInserted(*group);
@@ -1024,10 +2421,7 @@ void    Graph::removeGroup(qan::Group* group, bool removeContent, bool force)
         onNodeRemoved(*group);      // group are node, notify group
         emit nodeRemoved(group);    // removed as a node
 
-        if (_selectedNodes.contains(group))
-            _selectedNodes.removeAll(group);
-        if (_selectedGroups.contains(group))
-            _selectedGroups.removeAll(group);
+        removeFromSelection(*group);
         remove_group(group);
     } else {
         removeGroupContent_rec(group);
@@ -1051,8 +2445,7 @@ void    Graph::removeGroupContent_rec(qan::Group* group)
     onNodeRemoved(*group);      // group are node, notify group
     emit nodeRemoved(group);    // removed as a node
 
-    if (_selectedNodes.contains(group))
-        _selectedNodes.removeAll(group);
+    removeFromSelection(*group);
 
     super_t::remove_group(group);
 }
@@ -1076,6 +2469,8 @@ bool    qan::Graph::groupNode(qan::Group* group, qan::Node* node, qan::TableCell
         qWarning() << "qan::Graph::groupNode(): Error, can't group a group in itself.";
         return false;
     }
+    if (node->getItem() == nullptr)     // Virtualized node: grouped nodes are never virtualized
+        realizeNode(node);
     try {
         super_t::group_node(node, group);
         if (node->get_group() == group &&  // Check that group insertion succeed
@@ -1083,6 +2478,7 @@ bool    qan::Graph::groupNode(qan::Group* group, qan::Node* node, qan::TableCell
             node->getItem() != nullptr ) {
             group->getGroupItem()->groupNodeItem(node->getItem(), groupCell, transform);
             emit nodeGrouped(node, group);
+            scheduleVirtualizationUpdate(*node);    // Grouped nodes are no longer virtualized
         }
         return true;
     } catch (...) { qWarning() << "qan::Graph::groupNode(): Topology error."; }
@@ -1112,6 +2508,7 @@ bool    qan::Graph::ungroupNode(qan::Node* node, qan::Group* group, bool transfo
                 group->getGroupItem()->ungroupNodeItem(node->getItem(), transform);
             super_t::ungroup_node(node, group);
             emit nodeUngrouped(node, group);
+            scheduleVirtualizationUpdate(*node);
             const auto tableGroup = qobject_cast<qan::TableGroup*>(group);
             if (tableGroup != nullptr)  // Note: Specific handling of table, table maintain
                 emit tableModified(tableGroup);  // reference to node in it's cell, force an update
@@ -1245,16 +2642,10 @@ void    setPrimitiveSelected(Primitive_t& primitive,
                              bool selected,
                              qan::Graph& graph)
 {
-    // Note: graph.selectionPolicy is not taken into account
+    // Note: graph.selectionPolicy is not taken into account, locked primitives are not selected in setItemsSelected()
     if (primitive.getItem() == nullptr)
         return;
-    if (selected &&             // Allow only "deselect" for locked primitives
-        primitive.getLocked())
-        return;
-    primitive.getItem()->setSelected(selected); // Note: graph.removeFromSelection() is called from primitive qan::Selectable::setSelected()
-    if (selected)
-        graph.addToSelection(primitive);
-    return;
+    graph.setItemsSelected({primitive.getItem()}, selected);
 }
 
 } // qan::impl
@@ -1295,93 +2686,163 @@ bool    Graph::selectEdge(qan::Edge& edge, Qt::KeyboardModifiers modifiers) { re
 bool    Graph::selectEdge(qan::Edge* edge) { return edge != nullptr ? selectEdge(*edge) : false; }
 
 template <class Primitive_t>
-void    addToSelectionImpl(QPointer<Primitive_t> primitive,
-                        qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives,
+bool    removeFromSelectionImpl(const std::unordered_set<const QObject*>& primitives,
+                                qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives,
+                                qan::Graph::SelectionIndex& selectionIndex,
+                                qan::Graph& graph)
+{
+    // Note: Primitives are located with selectionIndex and removed with swapAndPop(), removing
+    // a primitive is O(1) whatever the selection size.
+    bool removed = false;
+    for (const auto primitive : primitives) {
+        const auto entry = selectionIndex.find(primitive);
+        if (entry == selectionIndex.end())
+            continue;   // Not in this selection container
+        const int position = entry->second;
+        selectionIndex.erase(entry);
+        const auto& selectedPrimitive = selectedPrimitives.getContainer()[static_cast<std::size_t>(position)];
+        if (selectedPrimitive)      // Null when primitive is being destroyed
+            QObject::disconnect(selectedPrimitive.data(), &QObject::destroyed, &graph, nullptr);
+        const auto moved = selectedPrimitives.swapAndPop(position);
+        if (moved) {
+            const auto movedEntry = selectionIndex.find(moved.data());
+            if (movedEntry != selectionIndex.end())
+                movedEntry->second = position;
+        }
+        removed = true;
+    }
+    return removed;
+}
+
+template <class Primitive_t>
+void    addToSelectionImpl(const std::vector<QPointer<Primitive_t>>& primitives,
+                           qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives,
+                           qan::Graph::SelectionIndex& selectionIndex,
                            qan::Graph& graph)
 {
-    if (!primitive)
-        return;
-    const auto primitiveItem = primitive->getItem();
-    if (!primitiveItem)
-        return;
-    if (!selectedPrimitives.contains(primitive.data())) {
-        selectedPrimitives.append(primitive);
-
-        QObject::connect(primitive.data(),  &Primitive_t::destroyed,
-                         &graph,            [&selectedPrimitives, primitive]() {
-                             selectedPrimitives.removeAll(primitive.data());
+    // PRECONDITIONS:
+        // primitives must not be already selected
+    int position = static_cast<int>(selectedPrimitives.size());
+    for (const auto& primitive : primitives) {
+        const QObject* key = primitive.data();
+        selectionIndex.emplace(key, position++);
+        QObject::connect(primitive.data(),  &QObject::destroyed,
+                         &graph,            [&selectedPrimitives, &selectionIndex, &graph, key]() {
+                             if (removeFromSelectionImpl<Primitive_t>({key}, selectedPrimitives, selectionIndex, graph))
+                                 emit graph.selectionChanged();
                          });
-        primitiveItem->setSelected(true);
-        // Eventually, create and configure node item selection item
-        if (primitiveItem->getSelectionItem() == nullptr)
-            primitiveItem->setSelectionItem(graph.createSelectionItem(primitiveItem));   // Safe, any argument might be nullptr
-        // Note 20220329: primitive.getItem()->configureSelectionItem() is called from setSelectionItem()
     }
+    selectedPrimitives.append(primitives.cbegin(), primitives.cend());
 }
 
 void    Graph::addToSelection(qan::Node& node) {
-    addToSelectionImpl<qan::Node>(QPointer<qan::Node>(&node), _selectedNodes, *this);
-    emit selectionChanged();
+    if (node.getItem() != nullptr)
+        setItemsSelected({node.getItem()}, true);
 }
 void    Graph::addToSelection(qan::Group& group) {
-    addToSelectionImpl<qan::Group>(&group, _selectedGroups, *this);
-    emit selectionChanged();
-}
-void    Graph::addToSelection(qan::Edge& edge)
-{
-    // Note 20221002: Do not use addToSelectionImpl<>() since it has no support for QVector<QPointer<qan::Edge>>
-    if (!_selectedEdges.contains(&edge)) {
-        _selectedEdges.append(QPointer<qan::Edge>{&edge});
-        if (edge.getItem() != nullptr) {
-            edge.getItem()->setSelected(true);
-            // Eventually, create and configure node item selection item
-            if (edge.getItem()->getSelectionItem() == nullptr)
-                edge.getItem()->setSelectionItem(createSelectionItem(edge.getItem()));   // Safe, any argument might be nullptr
-            // Note 20220329: primitive.getItem()->configureSelectionItem() is called from setSelectionItem()
-        }
-        emit selectionChanged();
-    }
+    if (group.getItem() != nullptr)
+        setItemsSelected({group.getItem()}, true);
 }
-
-template <class Primitive_t>
-void    removeFromSelectionImpl(QPointer<Primitive_t> primitive,
-                                qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives)
-{
-    if (selectedPrimitives.contains(primitive.data()))
-        selectedPrimitives.removeAll(primitive.data());
+void    Graph::addToSelection(qan::Edge& edge) {
+    if (edge.getItem() != nullptr)
+        setItemsSelected({edge.getItem()}, true);
 }
 
 void    Graph::removeFromSelection(qan::Node& node) {
-    removeFromSelectionImpl<qan::Node>(&node, _selectedNodes);
-    emit selectionChanged();
+    if (removeFromSelectionImpl<qan::Node>({&node}, _selectedNodes, _selectedNodesIndex, *this))
+        emit selectionChanged();
 }
 void    Graph::removeFromSelection(qan::Group& group) {
-    removeFromSelectionImpl<qan::Group>(&group, _selectedGroups);
-    emit selectionChanged();
+    if (removeFromSelectionImpl<qan::Group>({&group}, _selectedGroups, _selectedGroupsIndex, *this))
+        emit selectionChanged();
+}
+void    Graph::removeFromSelection(qan::Edge& edge) {
+    if (removeFromSelectionImpl<qan::Edge>({&edge}, _selectedEdges, _selectedEdgesIndex, *this))
+        emit selectionChanged();
 }
 
-// Note: Called from
+// Note: Called from qan::Selectable::setSelected()
 void    Graph::removeFromSelection(QQuickItem* item) {
+    if (_selectionBatchUpdate)  // Selection containers are updated directly in selectItems()
+        return;
     const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-    if (nodeItem != nullptr &&
-        nodeItem->getNode() != nullptr) {
-        _selectedNodes.removeAll(nodeItem->getNode());
+    const auto edgeItem = nodeItem == nullptr ? qobject_cast<qan::EdgeItem*>(item) : nullptr;
+    const auto node = nodeItem != nullptr ? nodeItem->getNode() : nullptr;
+    bool removed = false;
+    if (node != nullptr)
+        removed = node->isGroup() ? removeFromSelectionImpl<qan::Group>({node}, _selectedGroups, _selectedGroupsIndex, *this) :
+                                    removeFromSelectionImpl<qan::Node>({node}, _selectedNodes, _selectedNodesIndex, *this);
+    else if (edgeItem != nullptr &&
+             edgeItem->getEdge() != nullptr)
+        removed = removeFromSelectionImpl<qan::Edge>({edgeItem->getEdge()}, _selectedEdges, _selectedEdgesIndex, *this);
+    if (removed)
+        emit selectionChanged();
+}
+
+void    Graph::setItemsSelected(const std::vector<QQuickItem*>& items, bool selected)
+{
+    if (selectItems(items, selected))
         emit selectionChanged();
+}
+
+bool    Graph::selectItems(const std::vector<QQuickItem*>& items, bool selected)
+{
+    // Algorithm:
+        // 1. Modify items selection state, collect primitives whose selection state has changed.
+        //    Selectable::setSelected() call removeFromSelection() with a linear lookup in selection
+        //    containers for every deselected item: it is disabled during batch update.
+        // 2. Update selection containers in batch.
+    std::vector<QPointer<qan::Node>>    nodes;
+    std::vector<QPointer<qan::Group>>   groups;
+    std::vector<QPointer<qan::Edge>>    edges;
+    std::unordered_set<const QObject*>  primitives;
+
+    // 1.
+    _selectionBatchUpdate = true;
+    for (const auto item : items) {
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        const auto edgeItem = nodeItem == nullptr ? qobject_cast<qan::EdgeItem*>(item) : nullptr;
+        qan::Node* node = nodeItem != nullptr ? nodeItem->getNode() : nullptr;
+        qan::Edge* edge = edgeItem != nullptr ? edgeItem->getEdge() : nullptr;
+        if (node == nullptr &&
+            edge == nullptr)
+            continue;
+        qan::Selectable* selectable = nodeItem != nullptr ? static_cast<qan::Selectable*>(nodeItem) :
+                                                            static_cast<qan::Selectable*>(edgeItem);
+        if (selectable->getSelected() == selected)
+            continue;
+        if (selected &&     // Allow only "deselect" for locked primitives
+            (node != nullptr ? node->getLocked() : edge->getLocked()))
+            continue;
+        selectable->setSelected(selected);  // Note: Eventually create selection item
+        if (selected &&
+            selectable->getSelectionItem() == nullptr)
+            selectable->setSelectionItem(createSelectionItem(item));   // Safe, any argument might be nullptr
+        if (!selected)
+            primitives.insert(node != nullptr ? static_cast<const QObject*>(node) : static_cast<const QObject*>(edge));
+        else if (node != nullptr && node->isGroup())
+            groups.emplace_back(qobject_cast<qan::Group*>(node));
+        else if (node != nullptr)
+            nodes.emplace_back(node);
+        else
+            edges.emplace_back(edge);
+    }
+    _selectionBatchUpdate = false;
+
+    // 2.
+    if (selected) {
+        addToSelectionImpl<qan::Node>(nodes, _selectedNodes, _selectedNodesIndex, *this);
+        addToSelectionImpl<qan::Group>(groups, _selectedGroups, _selectedGroupsIndex, *this);
+        addToSelectionImpl<qan::Edge>(edges, _selectedEdges, _selectedEdgesIndex, *this);
     } else {
-        const auto groupItem = qobject_cast<qan::GroupItem*>(item);
-        if (groupItem != nullptr &&
-            groupItem->getGroup() != nullptr) {
-            _selectedGroups.removeAll(groupItem->getGroup());
-            emit selectionChanged();
-        } else {
-            const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                _selectedEdges.removeAll(edgeItem->getEdge());
-                emit selectionChanged();
-            }
-        }
+        removeFromSelectionImpl<qan::Node>(primitives, _selectedNodes, _selectedNodesIndex, *this);
+        removeFromSelectionImpl<qan::Group>(primitives, _selectedGroups, _selectedGroupsIndex, *this);
+        removeFromSelectionImpl<qan::Edge>(primitives, _selectedEdges, _selectedEdgesIndex, *this);
     }
+    return !nodes.empty() ||
+           !groups.empty() ||
+           !edges.empty() ||
+           !primitives.empty();
 }
 
 void    Graph::selectAll()
@@ -1395,65 +2856,59 @@ void    Graph::selectAll()
 
 void    Graph::removeSelection()
 {
-    const auto& selectedNodes = getSelectedNodes();
-    for (const auto& node: qAsConst(selectedNodes))
+    // Note: Copy and clear selection before removing content: removeNode(), removeGroup()
+    // and removeEdge() otherwise update selection containers while they are iterated, with
+    // a linear lookup for every removed primitive.
+    const std::vector<QPointer<qan::Node>>  selectedNodes(_selectedNodes.cbegin(), _selectedNodes.cend());
+    const std::vector<QPointer<qan::Group>> selectedGroups(_selectedGroups.cbegin(), _selectedGroups.cend());
+    const std::vector<QPointer<qan::Edge>>  selectedEdges(_selectedEdges.cbegin(), _selectedEdges.cend());
+    clearSelection();
+
+    for (const auto& node: selectedNodes)
         if (node &&
             !node->getIsProtected() &&
             !node->getLocked())
             removeNode(node);
 
-    const auto& selectedGroups = getSelectedGroups();
-    for (const auto& group: qAsConst(selectedGroups))
+    for (const auto& group: selectedGroups)
         if (group &&
             !group->getIsProtected() &&
             !group->getLocked())
             removeGroup(group);
 
-    const auto& selectedEdges = getSelectedEdges();
-    for (const auto& edge: qAsConst(selectedEdges))
+    for (const auto& edge: selectedEdges)
         if (edge &&
             !edge->getIsProtected() &&
             !edge->getLocked())
             removeEdge(edge);
-
-    clearSelection();
 }
 
 void    Graph::clearSelection()
 {
-    // Note: getItem()->setSelected() actually _modify_ content
-    // of _selectedNodes and _selectedGroups, a deep copy of theses
-    // container is necessary to avoid iterating on a vector that
-    // has changed while iterator has been modified.
-    SelectedNodes selectedNodesCopy;
-    std::copy(_selectedNodes.cbegin(),
-               _selectedNodes.cend(),
-               std::back_inserter(selectedNodesCopy));
-    for (auto node : selectedNodesCopy)
-        if (node != nullptr &&
-            node->getItem() != nullptr)
-            node->getItem()->setSelected(false);
-    _selectedNodes.clear();
-
-    SelectedGroups selectedGroupsCopy;
-    std::copy(_selectedGroups.cbegin(),
-              _selectedGroups.cend(),
-              std::back_inserter(selectedGroupsCopy));
-    for (auto group : selectedGroupsCopy)
-        if (group != nullptr &&
-            group->getItem() != nullptr)
-            group->getItem()->setSelected(false);
-    _selectedGroups.clear();
-
-    SelectedEdges selectedEdgesCopy;
-    std::copy(_selectedEdges.cbegin(),
-              _selectedEdges.cend(),
-              std::back_inserter(selectedEdgesCopy));
-    for (auto& edge : qAsConst(selectedEdgesCopy))
-        if (edge != nullptr &&
-            edge->getItem() != nullptr)
-            edge->getItem()->setSelected(false);
-    _selectedEdges.clear();
+    std::vector<QQuickItem*> items;
+    items.reserve(_selectedNodes.size() + _selectedGroups.size() + _selectedEdges.size());
+    const auto collectItems = [&items](const auto& selectedPrimitives) {
+        for (const auto& primitive : selectedPrimitives)
+            if (primitive &&
+                primitive->getItem() != nullptr)
+                items.push_back(primitive->getItem());
+    };
+    collectItems(_selectedNodes);
+    collectItems(_selectedGroups);
+    collectItems(_selectedEdges);
+    selectItems(items, false);
+
+    // Remaining primitives have no selected item
+    const auto clearPrimitives = [this](auto& selectedPrimitives, SelectionIndex& selectionIndex) {
+        for (const auto& primitive : selectedPrimitives)
+            if (primitive)
+                QObject::disconnect(primitive.data(), &QObject::destroyed, this, nullptr);
+        selectedPrimitives.clear();
+        selectionIndex.clear();
+    };
+    clearPrimitives(_selectedNodes, _selectedNodesIndex);
+    clearPrimitives(_selectedGroups, _selectedGroupsIndex);
+    clearPrimitives(_selectedEdges, _selectedEdgesIndex);
 
     emit selectionChanged();
 }
@@ -1942,30 +3397,51 @@ std::vector<QPointer<const qan::Node>>  Graph::collectRootNodes() const noexcept
 std::vector<const qan::Node*>   Graph::collectDfs(bool collectGroup) const noexcept
 {
     std::vector<const qan::Node*> nodes;
-    std::unordered_set<const qan::Node*> marks;
-    auto& rootNodes = get_root_nodes();
-    for (const auto rootNode : rootNodes)
-        collectDfsRec(rootNode, marks,
-                      nodes, collectGroup);
+    const auto expand = [collectGroup](const qan::Node& visited, const auto& emit) {
+        if (collectGroup &&
+            visited.isGroup()) {
+            for (const auto groupNode : visited.get_nodes())
+                emit(groupNode);
+        }
+        for (const auto outNode : visited.get_out_nodes())
+            emit(outNode);
+    };
+    const auto collect = [&nodes](const qan::Node& visited) {
+        nodes.push_back(&visited);
+        return true;
+    };
+    auto& traversal = get_traversal();
+    traversal.begin();
+    for (const auto rootNode : get_root_nodes())
+        traversal.dfs(rootNode, expand, collect);
     return nodes;
 }
 
 std::vector<const qan::Node*>   Graph::collectDfs(const qan::Node& node, bool collectGroup) const noexcept
 {
     std::vector<const qan::Node*> childs;
-    std::unordered_set<const qan::Node*> marks;
+    const auto expand = [collectGroup](const qan::Node& visited, const auto& emit) {
+        if (collectGroup &&
+            visited.isGroup()) {
+            for (const auto groupNode : visited.get_nodes())
+                emit(groupNode);
+        }
+        for (const auto outNode : visited.get_out_nodes())
+            emit(outNode);
+    };
+    const auto collect = [&childs](const qan::Node& visited) {
+        childs.push_back(&visited);
+        return true;
+    };
+    auto& traversal = get_traversal();
+    traversal.begin();
     if (collectGroup &&
         node.isGroup()) {
-        const auto group = qobject_cast<const qan::Group*>(&node);
-        if (group != nullptr) {
-            for (const auto groupNode : group->get_nodes())
-                collectDfsRec(qobject_cast<qan::Node*>(groupNode), marks,
-                              childs, collectGroup);
-        }
+        for (const auto groupNode : node.get_nodes())
+            traversal.dfs(groupNode, expand, collect);
     }
-    for (const auto& outNode : node.get_out_nodes())
-        collectDfsRec(qobject_cast<qan::Node*>(outNode), marks,
-                      childs, collectGroup);
+    for (const auto outNode : node.get_out_nodes())
+        traversal.dfs(outNode, expand, collect);
     return childs;
 }
 
@@ -1982,32 +3458,6 @@ auto    Graph::collectSubNodes(const QVector<qan::Node*> nodes, bool collectGrou
     return r;
 }
 
-void    Graph::collectDfsRec(const qan::Node* node,
-                             std::unordered_set<const qan::Node*>& marks,
-                             std::vector<const qan::Node*>& childs,
-                             bool collectGroup) const noexcept
-{
-    if (node == nullptr)
-        return;
-    if (marks.find(node) != marks.end())    // Do not collect on already visited
-        return;                             // branchs
-    marks.insert(node);
-    childs.push_back(node);
-    if (collectGroup &&
-        node->isGroup()) {
-        const auto group = qobject_cast<const qan::Group*>(node);
-        if (group) {
-            for (const auto groupNode : group->get_nodes())
-                collectDfsRec(qobject_cast<const qan::Node*>(groupNode), marks,
-                              childs, collectGroup);
-        }
-    }
-    for (const auto outNode : node->get_out_nodes()) {
-        collectDfsRec(qobject_cast<const qan::Node*>(outNode), marks,
-                      childs, collectGroup);
-    }
-}
-
 auto    Graph::collectInnerEdges(const std::vector<const qan::Node*>& nodes) const -> std::unordered_set<const qan::Edge*>
 {
     // Algorithm:
@@ -2041,224 +3491,426 @@ auto    Graph::collectInnerEdges(const std::vector<const qan::Node*>& nodes) con
 
 std::vector<const qan::Node*>   Graph::collectNeighbours(const qan::Node& node) const
 {
-    const auto collectNeighboursDfs_rec = [](const qan::Node* visited,
-            std::vector<const qan::Node*>& neighbours,
-            std::unordered_set<const qan::Node*>& marks,
-            const auto& lambda) {
-        if (visited == nullptr)
-            return;
-        if (marks.find(visited) != marks.end())    // Do not collect on already visited
-            return;                                // branchs
-        marks.insert(visited);
-        neighbours.push_back(visited);
-
-        // Collect group neighbours
-        const auto group = qobject_cast<const qan::Group*>(visited);
-        if (visited->isGroup() &&
-            group != nullptr) {
-            for (const auto groupNode : group->get_nodes())  // Collect all nodes in a group
-                lambda(groupNode, neighbours, marks,
-                       lambda);
-        }
-        // Collect group parent group neighbours
-        const auto nodeGroup = visited->getGroup();
-        if (nodeGroup != nullptr)
-            lambda(nodeGroup, neighbours, marks,
-                   lambda);
-    };
-
     std::vector<const qan::Node*> neighbours;
-    std::unordered_set<const qan::Node*> marks;
-    collectNeighboursDfs_rec(&node, neighbours, marks,
-                            collectNeighboursDfs_rec);
-
+    auto& traversal = get_traversal();
+    traversal.begin();
+    traversal.dfs(&node,
+                  [](const qan::Node& visited, const auto& emit) {
+                        if (visited.isGroup()) {    // Collect all nodes in a group
+                            for (const auto groupNode : visited.get_nodes())
+                                emit(groupNode);
+                        }
+                        emit(visited.getGroup());   // Collect group parent group neighbours
+                  },
+                  [&neighbours](const qan::Node& visited) {
+                        neighbours.push_back(&visited);
+                        return true;
+                  });
     return neighbours;
 }
 
 std::vector<const qan::Node*>   Graph::collectGroups(const qan::Node& node) const
 {
-    std::unordered_set<const qan::Node*> marks;
     std::vector<const qan::Node*> groups;
-
-    const auto collectGroups_rec = [](const qan::Node* visited,
-                                      std::vector<const qan::Node*>& groups,
-                                      std::unordered_set<const qan::Node*>& marks,
-                                      const auto& lambda) {
-        if (visited == nullptr)
-            return;
-        if (marks.find(visited) != marks.end()) // Do not collect on already visited
-            return;                             // group
-        marks.insert(visited);
-        if (visited->isGroup())
-            groups.push_back(visited);
-        if (visited->getGroup() != nullptr)
-            lambda(visited->getGroup(), groups,
-                   marks, lambda);
-    };
-
-    const auto group = node.getGroup();
-    if (group != nullptr)
-        collectGroups_rec(group, groups,
-                          marks, collectGroups_rec);
+    auto& traversal = get_traversal();
+    traversal.begin();
+    for (const qan::Node* group = node.getGroup();
+         group != nullptr &&
+         traversal.mark(*group);            // Do not collect on already visited group
+         group = group->getGroup()) {
+        if (group->isGroup())
+            groups.push_back(group);
+    }
     return groups;
 }
 
 std::vector<const qan::Node*>   Graph::collectAncestors(const qan::Node& node) const
 {
-    // ALGORITHM:
-      // 0. Collect node neighbour.
-      // 1. Collect ancestors of neighbors.
-      // 2. Remove original neighbors from ancestors.
-
-    const auto collectAncestorsDfs_rec = [](const qan::Node* visited,
-            std::vector<const qan::Node*>& parents,
-            std::unordered_set<const qan::Node*>& marks,
-            const auto& lambda) {
-        if (visited == nullptr)
-            return;
-        if (marks.find(visited) != marks.end())    // Do not collect on already visited
-            return;                                // branchs
-        marks.insert(visited);
-        parents.push_back(visited);
-
-        if (visited->getGroup() != nullptr)
-            parents.push_back(visited->getGroup());
-
-        // 1.1 Collect ancestor
-        for (const auto inNode : visited->get_in_nodes())
-            lambda(inNode, parents, marks,
-                   lambda);
-    };
+    return collectRelatives(node, /*inNodes*/true);
+}
+
+std::vector<const qan::Node*>   Graph::collectChilds(const qan::Node& node) const
+{
+    return collectRelatives(node, /*inNodes*/false);
+}
 
-    std::vector<const qan::Node*> parents;
-    std::unordered_set<const qan::Node*> marks;
+std::vector<const qan::Node*>   Graph::collectRelatives(const qan::Node& node, bool inNodes) const
+{
+    // ALGORITHM:
+      // 0. Collect node neighbours.
+      // 1. Collect ancestors (or childs) of neighbours.
+      // 2. Remove protected nodes from ancestors (or childs).
     auto excepts = collectGroups(node);
     excepts.push_back(&node);
-    //qWarning() << "qan::Graph::collectAncestors(): excepts.size=" << excepts.size();
 
     // 0. Collect target nodes
     std::vector<const qan::Node*> targetNodes;
     if (node.isGroup()) {
-        const auto neighbours = collectNeighbours(node);
-        targetNodes = neighbours;
-        std::copy(neighbours.cbegin(), neighbours.cend(), std::back_inserter(excepts));
+        targetNodes = collectNeighbours(node);
+        std::copy(targetNodes.cbegin(), targetNodes.cend(), std::back_inserter(excepts));
     } else {
-        const auto& inNodes = node.get_in_nodes();
-        for (const auto& inNode: inNodes)
-            targetNodes.push_back(const_cast<const qan::Node*>(inNode));
-    }
-
-    // 1. Collect target nodes ancestors or group neighbours ancestors
+        const auto& nodes = inNodes ? node.get_in_nodes() : node.get_out_nodes();
+        targetNodes.assign(nodes.cbegin(), nodes.cend());
+    }
+
+    // 1. Collect target nodes ancestors (or childs) or group neighbours ancestors (or childs)
+    std::vector<const qan::Node*> relatives;
+    auto& traversal = get_traversal();
+    traversal.begin();
+    const auto expand = [inNodes](const qan::Node& visited, const auto& emit) {
+        const auto& nodes = inNodes ? visited.get_in_nodes() : visited.get_out_nodes();
+        for (const auto relative : nodes)
+            emit(relative);
+    };
+    const auto collect = [&relatives](const qan::Node& visited) {
+        relatives.push_back(&visited);
+        if (visited.getGroup() != nullptr)
+            relatives.push_back(visited.getGroup());
+        return true;
+    };
     for (const auto targetNode: targetNodes)
-        collectAncestorsDfs_rec(targetNode, parents, marks,
-                                collectAncestorsDfs_rec);
+        traversal.dfs(targetNode, expand, collect);
 
-    // 2. Remove protected nodes from ancestors
-    parents.erase(std::remove_if(parents.begin(), parents.end(),
-                                 [&excepts](auto e) -> bool {
-        return std::find(excepts.begin(), excepts.end(), e) != excepts.end();
-    }), parents.end());
-    return parents;
+    // 2. Remove protected nodes, marked in a new traversal
+    traversal.begin();
+    for (const auto except : excepts)
+        traversal.mark(*except);
+    relatives.erase(std::remove_if(relatives.begin(), relatives.end(),
+                                   [&traversal](auto relative) -> bool {
+        return traversal.is_marked(*relative);
+    }), relatives.end());
+    return relatives;
 }
 
-std::vector<const qan::Node*>   Graph::collectChilds(const qan::Node& node) const
+void    Graph::setReachabilityIndexed(bool reachabilityIndexed) noexcept
 {
-    // ALGORITHM:
-      // 0. Collect node neighbour.
-      // 1. Collect childs of neighbours.
-      // 2. Remove protected nodes from childs.
-
-    const auto collectChildsDfs_rec = [](const qan::Node* visited,
-            std::vector<const qan::Node*>& childs,
-            std::unordered_set<const qan::Node*>& marks,
-            const auto& lambda) {
-        if (visited == nullptr)
-            return;
-        if (marks.find(visited) != marks.end())    // Do not collect on already visited
-            return;                                // branchs
-        marks.insert(visited);
-        childs.push_back(visited);
-
-        if (visited->getGroup() != nullptr)
-            childs.push_back(visited->getGroup());
-
-        // 1.1 Collect childs
-        for (const auto outNode : visited->get_out_nodes())
-            lambda(outNode, childs, marks,
-                   lambda);
+    if (reachabilityIndexed != is_reachability_indexed()) {
+        set_reachability_indexed(reachabilityIndexed);
+        emit reachabilityIndexedChanged();
+    }
+}
+
+bool    Graph::isAncestor(qan::Node* node, qan::Node* candidate) const
+{
+    if (node != nullptr && candidate != nullptr)
+        return isAncestor(*node, *candidate);
+    return false;
+}
+
+bool    Graph::isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept
+{
+    if (is_reachability_indexed())
+        return &node != &candidate &&
+               is_reachable(&candidate, &node);
+
+    const auto expand = [](const qan::Node& visited, const auto& emit) {
+        for (const auto inNode : visited.get_in_nodes())
+            emit(inNode);
+    };
+    const auto notCandidate = [&candidate](const qan::Node& visited) {
+        return &visited != &candidate;     // Stop traversal on candidate
     };
+    auto& traversal = get_traversal();
+    traversal.begin();
+    traversal.mark(node);       // Circuit detection
+    for (const auto inNode : node.get_in_nodes()) {
+        if (!traversal.dfs(inNode, expand, notCandidate))
+            return true;
+    }
+    return false;
+}
+
+std::vector<const qan::Node*>   Graph::collectDfs(const Snapshot& snapshot, bool collectGroup) const noexcept
+{
+    std::vector<const qan::Node*> nodes;
+    if (snapshot.is_empty())
+        return nodes;
+    nodes.reserve(snapshot.get_node_count());
+    auto marks = snapshot.make_marks();
+    std::vector<Snapshot::node_id> stack;
+    const auto& rootNodes = snapshot.get_root_nodes();
+    stack.assign(rootNodes.crbegin(), rootNodes.crend());   // First root node on top of stack
+    collectDfsIter(snapshot, stack, marks, nodes, collectGroup);
+    return nodes;
+}
 
+std::vector<const qan::Node*>   Graph::collectDfs(const Snapshot& snapshot, const qan::Node& node, bool collectGroup) const noexcept
+{
     std::vector<const qan::Node*> childs;
-    std::unordered_set<const qan::Node*> marks;
+    const auto nodeId = snapshot.get_id(&node);
+    if (nodeId == Snapshot::invalid_id)
+        return childs;
+    auto marks = snapshot.make_marks();
+    std::vector<Snapshot::node_id> stack;
+    const auto outNodes = snapshot.get_out_nodes(nodeId);
+    stack.assign(std::make_reverse_iterator(outNodes.end()), std::make_reverse_iterator(outNodes.begin()));
+    if (collectGroup &&
+        snapshot.is_group(nodeId)) {
+        const auto groupNodes = snapshot.get_group_nodes(nodeId);
+        stack.insert(stack.end(), std::make_reverse_iterator(groupNodes.end()), std::make_reverse_iterator(groupNodes.begin()));
+    }
+    collectDfsIter(snapshot, stack, marks, childs, collectGroup);
+    return childs;
+}
 
-    // 0. Collect node neighbours
-    auto excepts = collectGroups(node);
-    excepts.push_back(&node);
-    //qWarning() << "qan::Graph::collectChilds(): excepts.size=" << excepts.size();
+void    Graph::collectDfsIter(const Snapshot& snapshot, std::vector<Snapshot::node_id>& stack,
+                              gtpo::node_marks& marks, std::vector<const qan::Node*>& nodes,
+                              bool collectGroup) const noexcept
+{
+    // Nodes are marked when poped and childs pushed in reverse order: visit order
+    // is the same than recursive collectDfsRec()
+    while (!stack.empty()) {
+        const auto id = stack.back();
+        stack.pop_back();
+        if (!marks.test_and_set(id))    // Do not collect on already visited
+            continue;                   // branchs
+        nodes.push_back(snapshot.get_node(id));
+        const auto outNodes = snapshot.get_out_nodes(id);
+        stack.insert(stack.end(), std::make_reverse_iterator(outNodes.end()), std::make_reverse_iterator(outNodes.begin()));
+        if (collectGroup &&
+            snapshot.is_group(id)) {    // Group nodes are visited before group out nodes
+            const auto groupNodes = snapshot.get_group_nodes(id);
+            stack.insert(stack.end(), std::make_reverse_iterator(groupNodes.end()), std::make_reverse_iterator(groupNodes.begin()));
+        }
+    }
+}
 
-    std::vector<const qan::Node*> targetNodes;
-    if (node.isGroup()) {
-        const auto neighbours = collectNeighbours(node);
-        targetNodes = neighbours;
-        std::copy(neighbours.cbegin(), neighbours.cend(), std::back_inserter(excepts));
-    } else {
-        const auto& outNodes = node.get_out_nodes();
-        for (const auto& outNode: outNodes)
-            targetNodes.push_back(const_cast<const qan::Node*>(outNode));
+auto    Graph::collectInnerEdges(const Snapshot& snapshot, const std::vector<const qan::Node*>& nodes) const -> std::unordered_set<const qan::Edge*>
+{
+    std::unordered_set<const qan::Edge*>  innerEdges;
+    if (nodes.size() == 0)
+        return innerEdges;
+    auto nodesMarks = snapshot.make_marks();
+    for (const auto node: nodes) {
+        const auto nodeId = snapshot.get_id(node);
+        if (nodeId != Snapshot::invalid_id)
+            nodesMarks.set(nodeId);
+    }
+    for (const auto node: nodes) {
+        const auto nodeId = snapshot.get_id(node);
+        if (nodeId == Snapshot::invalid_id)
+            continue;
+        const auto outNodes = snapshot.get_out_nodes(nodeId);
+        const auto outEdges = snapshot.get_out_edges(nodeId);
+        for (std::size_t o = 0; o < outNodes.size(); ++o)
+            if (nodesMarks.test(outNodes[o]))
+                innerEdges.insert(outEdges[o]);
     }
+    return innerEdges;
+}
 
-    // 1. Collect node childs
-    for (const auto target: targetNodes)
-        collectChildsDfs_rec(target, childs, marks,
-                             collectChildsDfs_rec);
+std::vector<const qan::Node*>   Graph::collectNeighbours(const Snapshot& snapshot, const qan::Node& node) const
+{
+    std::vector<const qan::Node*> neighbours;
+    const auto nodeId = snapshot.get_id(&node);
+    if (nodeId == Snapshot::invalid_id)
+        return neighbours;
+    auto marks = snapshot.make_marks();
+    std::vector<Snapshot::node_id> stack{nodeId};
+    while (!stack.empty()) {
+        const auto id = stack.back();
+        stack.pop_back();
+        if (!marks.test_and_set(id))
+            continue;
+        neighbours.push_back(snapshot.get_node(id));
+        // Collect group parent group neighbours, then group neighbours (visited first)
+        const auto groupId = snapshot.get_group(id);
+        if (groupId != Snapshot::invalid_id)
+            stack.push_back(groupId);
+        const auto groupNodes = snapshot.get_group_nodes(id);
+        stack.insert(stack.end(), std::make_reverse_iterator(groupNodes.end()), std::make_reverse_iterator(groupNodes.begin()));
+    }
+    return neighbours;
+}
 
-    // 2. Remove protected nodes from child
-    childs.erase(std::remove_if(childs.begin(), childs.end(),
-                                [&excepts](auto e) -> bool {
-        return std::find(excepts.begin(), excepts.end(), e) != excepts.end();
-    }), childs.end());
-    return childs;
+std::vector<const qan::Node*>   Graph::collectAncestors(const Snapshot& snapshot, const qan::Node& node) const
+{
+    return collectRelatives(snapshot, node, /*inNodes*/true);
 }
 
-bool    Graph::isAncestor(qan::Node* node, qan::Node* candidate) const
+std::vector<const qan::Node*>   Graph::collectChilds(const Snapshot& snapshot, const qan::Node& node) const
 {
-    if (node != nullptr && candidate != nullptr)
-        return isAncestor(*node, *candidate);
-    return false;
+    return collectRelatives(snapshot, node, /*inNodes*/false);
 }
 
-bool    Graph::isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept
+std::vector<const qan::Node*>   Graph::collectRelatives(const Snapshot& snapshot, const qan::Node& node, bool inNodes) const
 {
-    std::unordered_set<const qan::Node*> marks;
-    marks.insert(&node);
-
-    const auto isAncestorDfs_rec = [&node](const qan::Node* visited, const qan::Node& candidate,
-                                      std::unordered_set<const qan::Node*>& marks,
-                                      const auto& lambda) {
-        if (visited == nullptr)
-            return false;
-        if (visited == &node)    // Circuit detection
-            return false;
-        if (visited == &candidate)
-            return true;
-        if (marks.find(visited) != marks.end())    // Do not collect on already visited
-            return false;                       // branchs
-        marks.insert(visited);
-        for (const auto inNode : visited->get_in_nodes())
-            if (lambda(inNode, candidate,
-                       marks, lambda))
-                return true;
-        return false;
-    };
+    // ALGORITHM: see collectAncestors() and collectChilds()
+      // 0. Collect node neighbours.
+      // 1. Collect ancestors (or childs) of neighbours.
+      // 2. Remove protected nodes.
+    std::vector<const qan::Node*> relatives;
+    const auto nodeId = snapshot.get_id(&node);
+    if (nodeId == Snapshot::invalid_id)
+        return relatives;
 
-    for (const auto inNode : node.get_in_nodes()) {
-        if (isAncestorDfs_rec(inNode, candidate,
-                              marks, isAncestorDfs_rec))
+    auto excepts = snapshot.make_marks();
+    excepts.set(nodeId);
+    for (auto groupId = snapshot.get_group(nodeId);
+         groupId != Snapshot::invalid_id &&
+         !excepts.test(groupId);
+         groupId = snapshot.get_group(groupId))
+        excepts.set(groupId);
+
+    // 0. Collect target nodes
+    std::vector<Snapshot::node_id> stack;
+    if (snapshot.is_group(nodeId)) {
+        for (const auto neighbour : collectNeighbours(snapshot, node)) {
+            const auto neighbourId = snapshot.get_id(neighbour);
+            excepts.set(neighbourId);
+            stack.push_back(neighbourId);
+        }
+    } else {
+        const auto targets = inNodes ? snapshot.get_in_nodes(nodeId) : snapshot.get_out_nodes(nodeId);
+        stack.assign(targets.begin(), targets.end());
+    }
+    std::reverse(stack.begin(), stack.end());
+
+    // 1. Collect target nodes relatives
+    auto marks = snapshot.make_marks();
+    while (!stack.empty()) {
+        const auto id = stack.back();
+        stack.pop_back();
+        if (!marks.test_and_set(id))
+            continue;
+        relatives.push_back(snapshot.get_node(id));
+        const auto groupId = snapshot.get_group(id);
+        if (groupId != Snapshot::invalid_id)
+            relatives.push_back(snapshot.get_node(groupId));
+        const auto nextNodes = inNodes ? snapshot.get_in_nodes(id) : snapshot.get_out_nodes(id);
+        stack.insert(stack.end(), std::make_reverse_iterator(nextNodes.end()), std::make_reverse_iterator(nextNodes.begin()));
+    }
+
+    // 2. Remove protected nodes
+    relatives.erase(std::remove_if(relatives.begin(), relatives.end(),
+                                   [&snapshot, &excepts](auto relative) -> bool {
+        return excepts.test(snapshot.get_id(relative));
+    }), relatives.end());
+    return relatives;
+}
+
+bool    Graph::isAncestor(const Snapshot& snapshot, const qan::Node& node, const qan::Node& candidate) const noexcept
+{
+    const auto nodeId = snapshot.get_id(&node);
+    const auto candidateId = snapshot.get_id(&candidate);
+    if (nodeId == Snapshot::invalid_id ||
+        candidateId == Snapshot::invalid_id)
+        return false;
+    auto marks = snapshot.make_marks();
+    const auto inNodes = snapshot.get_in_nodes(nodeId);
+    std::vector<Snapshot::node_id> stack(inNodes.begin(), inNodes.end());
+    while (!stack.empty()) {
+        const auto id = stack.back();
+        stack.pop_back();
+        if (id == nodeId)           // Circuit detection
+            continue;
+        if (id == candidateId)
             return true;
+        if (!marks.test_and_set(id))
+            continue;
+        const auto visitedInNodes = snapshot.get_in_nodes(id);
+        stack.insert(stack.end(), visitedInNodes.begin(), visitedInNodes.end());
     }
     return false;
 }
 
+QVariantList    Graph::stronglyConnectedComponents() const
+{
+    return toVariantList(collectStronglyConnectedComponents());
+}
+
+std::vector<std::vector<const qan::Node*>>  Graph::collectStronglyConnectedComponents() const
+{
+    const auto graphSnapshot = snapshot();
+    return toNodes(graphSnapshot, gtpo::strongly_connected_components(graphSnapshot).get_members());
+}
+
+QVariantList    Graph::connectedComponents() const
+{
+    return toVariantList(collectConnectedComponents());
+}
+
+std::vector<std::vector<const qan::Node*>>  Graph::collectConnectedComponents() const
+{
+    const auto graphSnapshot = snapshot();
+    return toNodes(graphSnapshot, gtpo::weakly_connected_components(graphSnapshot).get_members());
+}
+
+QVariantList    Graph::bfsLayers(qan::Node* source) const
+{
+    if (source == nullptr)
+        return QVariantList{};
+    return toVariantList(collectBfsLayers(*source));
+}
+
+std::vector<std::vector<const qan::Node*>>  Graph::collectBfsLayers(const qan::Node& source) const
+{
+    const auto graphSnapshot = snapshot();
+    const auto sourceId = graphSnapshot.get_id(&source);
+    if (sourceId == Snapshot::invalid_id)
+        return {};
+    return toNodes(graphSnapshot, gtpo::bfs_layers(graphSnapshot, sourceId));
+}
+
+QVariantList    Graph::shortestPath(qan::Node* source, qan::Node* destination) const
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return QVariantList{};
+    const auto path = collectShortestPath(*source, *destination,
+                                          [](const qan::Edge& edge) { return edge.getWeight(); });
+    QVariantList pathNodes;
+    pathNodes.reserve(static_cast<int>(path.size()));
+    for (const auto node : path)
+        pathNodes.append(QVariant::fromValue(const_cast<qan::Node*>(node)));
+    return pathNodes;
+}
+
+std::vector<const qan::Node*>   Graph::collectShortestPath(const qan::Node& source, const qan::Node& destination,
+                                                           const std::function<qreal(const qan::Edge&)>& weight) const
+{
+    const auto graphSnapshot = snapshot();
+    const auto sourceId = graphSnapshot.get_id(&source);
+    const auto destinationId = graphSnapshot.get_id(&destination);
+    if (sourceId == Snapshot::invalid_id ||
+        destinationId == Snapshot::invalid_id ||
+        !weight)
+        return {};
+    const auto paths = gtpo::dijkstra_shortest_paths(graphSnapshot, sourceId, weight);
+    std::vector<const qan::Node*> path;
+    for (const auto id : paths.get_path(destinationId))
+        path.push_back(graphSnapshot.get_node(id));
+    return path;
+}
+
+std::vector<std::vector<const qan::Node*>>  Graph::toNodes(const Snapshot& snapshot, const std::vector<std::vector<Snapshot::node_id>>& ids)
+{
+    std::vector<std::vector<const qan::Node*>> nodes;
+    nodes.reserve(ids.size());
+    for (const auto& idsList : ids) {
+        std::vector<const qan::Node*> nodesList;
+        nodesList.reserve(idsList.size());
+        for (const auto id : idsList)
+            nodesList.push_back(snapshot.get_node(id));
+        nodes.push_back(std::move(nodesList));
+    }
+    return nodes;
+}
+
+QVariantList    Graph::toVariantList(const std::vector<std::vector<const qan::Node*>>& nodes)
+{
+    QVariantList variantLists;
+    variantLists.reserve(static_cast<int>(nodes.size()));
+    for (const auto& nodesList : nodes) {
+        QVariantList variantList;
+        variantList.reserve(static_cast<int>(nodesList.size()));
+        for (const auto node : nodesList)
+            variantList.append(QVariant::fromValue(const_cast<qan::Node*>(node)));
+        variantLists.append(QVariant{variantList});
+    }
+    return variantLists;
+}
+
 auto    Graph::collectGroupsNodes(const QVector<const qan::Group*>& groups) const noexcept -> std::unordered_set<const qan::Node*>
 {
     std::unordered_set<const qan::Node*> r;
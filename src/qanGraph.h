@@ -34,14 +34,24 @@
 
 #pragma once
 
+// Std headers
+#include <functional>       // std::function
+#include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <memory>
+
 #include "./gtpo/node.h"
 #include "./gtpo/graph.h"
+#include "./gtpo/algorithms.h"
 
 // Qt headers
 #include <QString>
+#include <QVariant>
 #include <QQuickItem>
 #include <QQmlParserStatus>
 #include <QSharedPointer>
+#include <QThreadPool>
 #include <QAbstractListModel>
 
 // QuickQanava headers
@@ -54,6 +64,9 @@
 #include "./qanNavigable.h"
 #include "./qanSelectable.h"
 #include "./qanConnector.h"
+#include "./qanOrthoRouter.h"
+#include "./qanSpatialIndex.h"
+#include "./qanItemIncubator.h"
 
 
 //! Main QuickQanava namespace
@@ -81,6 +94,7 @@ class Graph : public gtpo::graph<QQuickItem, qan::Node, qan::Group, qan::Edge>
 
     using super_t = gtpo::graph<QQuickItem, qan::Node, qan::Group, qan::Edge>;
     friend class qan::Selectable;
+    friend class qan::ItemIncubator;
 
     /*! \name Graph Object Management *///-------------------------------------
     //@{
@@ -162,13 +176,17 @@ public:
     /*! \brief Similar to QQuickItem::childAt() method, except that it take edge bounding shape into account.
      *
      * Using childAt() method will most of the time return qan::Edge items since childAt() use bounding boxes
-     * for item detection.
+     * for item detection. Candidates items are looked up in graph spatial index (see itemAt()), only
+     * nodes, groups, edges, table cells and group container children items are returned.
      *
      * \return nullptr if there is no child at requested position, or a QQuickItem that can be casted qan::Node, qan::Edge or qan::Group with qobject_cast<>.
      */
     Q_INVOKABLE QQuickItem* graphChildAt(qreal x, qreal y) const;
 
-    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account (and is hence faster, but still O(n)).
+    /*! \brief Return the top-most (maximum global z) non collapsed group containing rect(\c p, \c s), in container item CS.
+     *
+     * Candidates groups are looked up in a spatial index of non collapsed groups (see getSpatialIndex()), complexity
+     * is logarithmic in groups count.
      *
      * \arg except Return every compatible group except \c except (can be nullptr).
      */
@@ -341,6 +359,63 @@ private:
     std::unique_ptr<QQmlComponent>  createComponent(const QString& url);
     //! Secure utility to create a QQuickItem from a given QML component \c component (might issue warning if component is nullptr or not successfully loaded).
     QQuickItem*                     createItemFromComponent(QQmlComponent* component);
+
+public:
+    /*! \brief Reuse items of removed nodes and edges instead of destroying them, default to false.
+     *
+     * When enabled, items of removed (or virtualized, see \c virtualized) nodes and edges are reset and stored
+     * in a per delegate component pool, createFromComponent() then rebind pooled items to new nodes and edges
+     * created with the same delegate instead of instantiating a new QML delegate (selection items are reused with
+     * their node item). Items emit qan::NodeItem::pooled() / qan::EdgeItem::pooled() when stored, and reused()
+     * when rebound: delegates with an internal state should reset it in these handlers.
+     *
+     * Before pooled() is emitted, node items are unselected, \c collapsed and \c dragged are reset to false
+     * and \c draggable, \c resizable, \c selectable and \c minimumSize are restored to the values they had
+     * when item was first created (see qan::NodeItem::saveDelegateState()). Edge items \c hidden is reset to
+     * false and \c srcShape / \c dstShape overrides are reset to their style shapes.
+     *
+     * \note Groups, nodes with ports and edges bound to ports items are never pooled. Disabling
+     * \c reuseItems destroy all pooled items.
+     */
+    Q_PROPERTY(bool reuseItems READ getReuseItems WRITE setReuseItems NOTIFY reuseItemsChanged FINAL)
+    inline bool     getReuseItems() const noexcept { return _reuseItems; }
+    void            setReuseItems(bool reuseItems);
+private:
+    bool            _reuseItems = false;
+signals:
+    void            reuseItemsChanged();
+
+public:
+    //! Maximum number of pooled items per delegate component, default to 256.
+    Q_PROPERTY(int maxPooledItems READ getMaxPooledItems WRITE setMaxPooledItems NOTIFY maxPooledItemsChanged FINAL)
+    inline int      getMaxPooledItems() const noexcept { return _maxPooledItems; }
+    void            setMaxPooledItems(int maxPooledItems);
+private:
+    int             _maxPooledItems = 256;
+signals:
+    void            maxPooledItemsChanged();
+
+public:
+    //! Return the number of items currently pooled (for all delegate components).
+    Q_INVOKABLE int     getPooledItemCount() const noexcept;
+    //! Destroy all pooled items.
+    Q_INVOKABLE void    clearItemPools();
+private:
+    //! Reset and pool \c node item, return false if item could not be pooled (node item is then not modified).
+    bool            poolNodeItem(qan::Node& node);
+    //! Reset and pool \c edge item, return false if item could not be pooled (edge item is then not modified).
+    bool            poolEdgeItem(qan::Edge& edge);
+    //! Return \c component pooled items (pool is created on first use).
+    std::vector<QPointer<QQuickItem>>&  getItemPool(QQmlComponent& component);
+    //! Return a pooled item created from \c component, or nullptr if there is no such item.
+    QQuickItem*     takePooledItem(QQmlComponent* component);
+    struct ItemPool {
+        std::vector<QPointer<QQuickItem>>   items;
+        //! Connection to component destroyed() signal (pooled items are destroyed with their component).
+        QMetaObject::Connection             componentDestroyed;
+    };
+    //! Pooled items per delegate component.
+    std::unordered_map<const QQmlComponent*, ItemPool>  _itemPools;
     //@}
     //-------------------------------------------------------------------------
 
@@ -390,6 +465,22 @@ public:
                                        QQmlComponent* nodeComponent = nullptr,
                                        qan::NodeStyle* nodeStyle = nullptr);
 
+    /*! \brief Insert a set of existing \c nodes with a specific delegate component and a custom style in a single batch.
+     *
+     * Use this method to load large graphs: topology containers are reserved once, graph nodes model
+     * is updated with a single rows insertion and a single nodesInserted() signal is emitted.
+     *
+     * \note nodeInserted() is _not_ emitted for batch inserted nodes, onNodeInserted() is still called for every node.
+     * \note If \c nodeComponent is nullptr, default node delegate is used, if \c nodeStyle is nullptr, default
+     * qan::Node style is used.
+     * \warning \c nodes ownership is set to Cpp in current QmlEngine.
+     *
+     * \return the number of successfully inserted nodes (nullptr or already inserted nodes are ignored).
+     */
+    std::size_t             insertNodes(const std::vector<qan::Node*>& nodes,
+                                        QQmlComponent* nodeComponent = nullptr,
+                                        qan::NodeStyle* nodeStyle = nullptr);
+
     /*! \brief Remove node \c node from this graph. Shortcut to gtpo::GenGraph<>::removeNode().
      *
      *  \arg force if force is true, even locked or protected are removed (default to false).
@@ -402,6 +493,18 @@ public:
     //! Return true if \c node is registered in graph.
     bool                    hasNode(const qan::Node* node) const;
 
+private:
+    /*! \brief Internal utility used to create and configure \c node graphical delegate using \c nodeComponent and \c nodeStyle.
+     *
+     * \return the created node item, or nullptr if delegate creation fails or when item creation is deferred (see \c virtualized
+     * and \c asynchronous).
+     */
+    qan::NodeItem*          configureNode(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle);
+    //! Create \c node item, \c node must not already have an item.
+    qan::NodeItem*          createNodeItem(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle);
+    //! Connect a newly created \c nodeItem to graph.
+    void                    initNodeItem(qan::Node& node, qan::NodeItem& nodeItem);
+
 public:
     //! Access the list of nodes with an abstract item model interface.
     Q_PROPERTY(QAbstractItemModel* nodes READ getNodesModel CONSTANT FINAL)
@@ -433,6 +536,9 @@ signals:
     //! \copydoc onNodeRemoved()
     void            nodeRemoved(qan::Node* node);
 
+    //! Emitted _after_ a set of nodes has been inserted with insertNodes().
+    void            nodesInserted(QList<qan::Node*> nodes);
+
 signals:
     /*! \brief Emitted whenever a node registered in this graph is clicked.
      */
@@ -533,10 +639,40 @@ private:
      */
     bool                    configureEdge(qan::Edge& source, QQmlComponent& edgeComponent, qan::EdgeStyle& style,
                                           qan::Node& src, qan::Node* dst);
+    //! Create \c edge item between \c edge source and destination node items.
+    qan::EdgeItem*          createEdgeItem(qan::Edge& edge, QQmlComponent& edgeComponent, qan::EdgeStyle& style);
+    //! Connect a newly created \c edgeItem to graph and to \c edge source and destination node items.
+    void                    initEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem);
 public:
     template <class Edge_t>
     qan::Edge*              insertNonVisualEdge(qan::Node& src, qan::Node* dstNode);
 
+    /*! \brief Create and insert an edge for every (source, destination) pair in \c edges in a single batch.
+     *
+     * Topology containers are reserved once, graph edges model is updated with a single rows
+     * insertion and a single edgesInserted() signal is emitted (edgeInserted() is _not_ emitted,
+     * onEdgeInserted() is still called for every inserted edge).
+     *
+     * Edge items are created (or deferred for virtualized / asynchronous graphs) only once edges
+     * have been inserted in topology, edges that could not be inserted are deleted.
+     *
+     * \note If \c edgeComponent is nullptr, default edge delegate is used.
+     * \return the inserted edges. Pairs with a nullptr source or destination are skipped and
+     * _not_ returned: returned vector might be shorter than \c edges and its indexes do not
+     * necessarily match \c edges indexes.
+     */
+    std::vector<qan::Edge*> insertEdges(const std::vector<std::pair<qan::Node*, qan::Node*>>& edges,
+                                        QQmlComponent* edgeComponent = nullptr);
+
+protected:
+    /*! \brief Notify user immediately after a new edge \c edge has been inserted in graph.
+     *
+     * \note Signal edgeInserted() is emitted at the same time for insertEdge(), edgesInserted() is
+     * emitted once all edges have been notified for insertEdges().
+     * \note Default implementation is empty.
+     */
+    virtual void            onEdgeInserted(qan::Edge& edge);
+
 public:
     //! Shortcut to gtpo::GenGraph<>::removeEdge().
     Q_INVOKABLE virtual bool    removeEdge(qan::Node* source, qan::Node* destination);
@@ -550,6 +686,70 @@ public:
     //! Return true if edge is in graph.
     Q_INVOKABLE bool        hasEdge(const qan::Edge* edge) const;
 
+public:
+    /*! \brief Schedule a coalesced geometry update for \c edgeItem before next frame.
+     *
+     * Edge items do not regenerate their geometry each time an endpoint x, y, z, width or height
+     * property change: they are only marked dirty (see qan::EdgeItem::scheduleUpdateItem()). All dirty
+     * edges are then updated once in updatePolish(), just before the scene graph synchronization.
+     * Dragging a node with many adjacent edges thus cost a single geometry pass per edge per frame.
+     *
+     * \note Edge items geometry is generated in batch without calling qan::EdgeItem::updateItem(), except for
+     * items whose qan::EdgeItem::supportsConcurrentGeometry() return false, they are updated with a direct (but
+     * still coalesced) updateItem() call.
+     */
+    void                    scheduleEdgeUpdate(qan::EdgeItem* edgeItem);
+
+    /*! \brief Immediately update all edges scheduled with scheduleEdgeUpdate() (use before reading edge geometry synchronously).
+     *
+     * Dirty edges inputs are gathered on GUI thread with qan::EdgeItem::generateGeometryCache(), their geometry
+     * is then generated concurrently on an internal thread pool (for large batches only), and finally applied
+     * in a single pass with qan::EdgeItem::applyGeometryCache().
+     */
+    Q_INVOKABLE void        updateDirtyEdges();
+protected:
+    //! Flush edges scheduled with scheduleEdgeUpdate().
+    virtual void            updatePolish() override;
+private:
+    //! Edges scheduled for update before next frame (edge items might be destroyed before being updated).
+    std::vector<QPointer<qan::EdgeItem>>    _dirtyEdges;
+    //! Thread pool used to generate dirty edges geometry concurrently in updateDirtyEdges().
+    QThreadPool                             _edgesGeometryPool;
+
+public:
+    /*! \brief Route ortho edges around nodes, default to false.
+     *
+     * When enabled, ortho edges (qan::EdgeStyle::LineType::Ortho) between nodes are routed around other nodes
+     * with qan::OrthoRouter, edge polyline is then available in qan::EdgeItem::orthoPath. Graph maintains router
+     * obstacles (non group nodes) and routes: when a node is moved, resized, inserted or removed, only the edges
+     * whose route intersect the node old or new rectangle are re-routed.
+     *
+     * \note Edges connected to ports are not routed.
+     */
+    Q_PROPERTY(bool orthoRouting READ getOrthoRouting WRITE setOrthoRouting NOTIFY orthoRoutingChanged FINAL)
+    inline bool                     getOrthoRouting() const noexcept { return _orthoRouting; }
+    void                            setOrthoRouting(bool orthoRouting);
+    //! Router used when orthoRouting is true (obstacles and routes are maintained by graph).
+    inline qan::OrthoRouter&        getOrthoRouter() noexcept { return _orthoRouter; }
+    inline const qan::OrthoRouter&  getOrthoRouter() const noexcept { return _orthoRouter; }
+private:
+    //! Connect (or disconnect) \c nodeItem geometry changes to obstacles update.
+    void                            connectObstacle(qan::NodeItem* nodeItem, bool enable);
+    //! Schedule \c nodeItem obstacle update (or all \c nodeItem sub nodes obstacles update for a group).
+    void                            scheduleObstacleUpdate(qan::NodeItem* nodeItem);
+    void                            onObstacleGeometryChanged();
+    //! Update dirty obstacles in router and schedule the update of edges whose route intersect modified obstacles.
+    void                            updateObstacles();
+    //! Schedule update of edges with \c routes keys (see qan::OrthoRouter::setObstacle()).
+    void                            scheduleRoutesUpdate(const std::vector<qan::OrthoRouter::Key>& routes);
+
+    bool                                    _orthoRouting = false;
+    qan::OrthoRouter                        _orthoRouter;
+    //! Node items moved or resized since last updateDirtyEdges().
+    std::vector<QPointer<qan::NodeItem>>    _dirtyObstacles;
+signals:
+    void                            orthoRoutingChanged();
+
 public:
     //! Access the list of edges with an abstract item model interface.
     Q_PROPERTY( QAbstractItemModel* edges READ getEdgesModel CONSTANT FINAL )
@@ -576,12 +776,255 @@ signals:
      */
     void            edgeInserted(qan::Edge* edge);
 
+    /*! \brief Emitted _after_ a set of edges has been inserted with insertEdges().
+     */
+    void            edgesInserted(QList<qan::Edge*> edges);
+
     /*! \brief Emitted immediately _before_ an edge is removed.
      */
     void            onEdgeRemoved(qan::Edge* edge);
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Graph Virtualization *///----------------------------------------
+    //@{
+public:
+    /*! \brief Create node and edge items only when they are in view, default to false.
+     *
+     * When virtualized, nodes and edges are inserted in graph topology immediately, but their visual items
+     * are created only when they intersect \c viewportRect inflated by \c virtualizationMargin, and destroyed
+     * once they are more than two margins away from view (with a virtualized node, use qan::Node::setItemGeometry()
+     * to position node before its item exists). Items are realized and released in updatePolish(), before next frame,
+     * use nodeItemRealized() and edgeItemRealized() to configure items created on the fly. Node items z is stored
+     * when they are released and restored when they are realized again.
+     *
+     * Edge items are realized when the source to destination nodes rect intersect view, their source and destination
+     * node items are then realized too. Nodes geometry and edges rects are stored in a spatial index: realization
+     * only query primitives in view and release only check realized primitives, virtualization cost is proportional
+     * to the number of items in view.
+     *
+     * Groups, grouped nodes, nodes with ports, selected and dragged nodes and edges, and edges
+     * connected to ports, groups or edges are never virtualized.
+     *
+     * \note Disabling virtualization realize all virtualized items.
+     */
+    Q_PROPERTY(bool virtualized READ getVirtualized WRITE setVirtualized NOTIFY virtualizedChanged FINAL)
+    inline bool     getVirtualized() const noexcept { return _virtualized; }
+    void            setVirtualized(bool virtualized);
+private:
+    bool            _virtualized = false;
+signals:
+    void            virtualizedChanged();
+
+public:
+    /*! \brief Visible area in graph container item CS (updated by qan::GraphView on pan, zoom and resize).
+     *
+     * Empty by default: when virtualized, a graph without view realize no items.
+     */
+    Q_PROPERTY(QRectF viewportRect READ getViewportRect WRITE setViewportRect NOTIFY viewportRectChanged FINAL)
+    inline QRectF   getViewportRect() const noexcept { return _viewportRect; }
+    void            setViewportRect(const QRectF& viewportRect);
+private:
+    QRectF          _viewportRect;
+signals:
+    void            viewportRectChanged();
+
+public:
+    //! Distance around \c viewportRect where virtualized items are created, default to 200.
+    Q_PROPERTY(qreal virtualizationMargin READ getVirtualizationMargin WRITE setVirtualizationMargin NOTIFY virtualizationMarginChanged FINAL)
+    inline qreal    getVirtualizationMargin() const noexcept { return _virtualizationMargin; }
+    void            setVirtualizationMargin(qreal virtualizationMargin);
+private:
+    qreal           _virtualizationMargin = 200.;
+signals:
+    void            virtualizationMarginChanged();
+
+public:
+    //! Schedule items realization and release before next frame (called automatically on view and topology changes).
+    void            scheduleVirtualizationUpdate();
+    //! Schedule update of \c node and its adjacent edges rects in virtualization index (called automatically when \c node geometry change).
+    void            scheduleVirtualizationUpdate(qan::Node& node);
+    //! Immediately create or destroy virtualized items according to current \c viewportRect.
+    Q_INVOKABLE void    updateVirtualization();
+    //! Force creation of \c node item (and keep it until it is out of view).
+    Q_INVOKABLE qan::NodeItem*  realizeNode(qan::Node* node);
+signals:
+    //! Emitted when the item of an already inserted \c node has been created by virtualization or incubation.
+    void            nodeItemRealized(qan::Node* node);
+    //! Emitted when the item of an already inserted \c edge has been created by virtualization or incubation.
+    void            edgeItemRealized(qan::Edge* edge);
+
+private:
+    //! Return true if \c node item could be destroyed when out of view.
+    bool            isNodeVirtualizable(const qan::Node& node) const;
+    //! Return true if \c edge item could be destroyed when out of view.
+    bool            isEdgeVirtualizable(qan::Edge& edge) const;
+    qan::EdgeItem*  realizeEdge(qan::Edge& edge);
+    void            releaseNodeItem(qan::Node& node);
+    void            releaseEdgeItem(qan::Edge& edge);
+    bool            _virtualizationScheduled = false;
+
+private:
+    //! Return true if \c node geometry is stored in virtualization index (visual nodes that are neither groups nor grouped).
+    bool            isNodeIndexable(const qan::Node& node) const;
+    //! Return true if \c edge source to destination rect is stored in virtualization index (visual edges between indexable nodes).
+    bool            isEdgeIndexable(const qan::Edge& edge) const;
+    void            scheduleVirtualizationUpdate(qan::Edge& edge);
+    //! Update dirty nodes and edges rects in virtualization index, realize primitives that could not be virtualized.
+    void            updateVirtualizationIndex();
+    void            indexVirtualNode(qan::Node& node);
+    void            indexVirtualEdge(qan::Edge& edge);
+    void            clearVirtualizationIndex();
+    //! Indexable nodes stored geometry (qan::Node keys) and edges source to destination nodes rects (qan::Edge keys).
+    qan::SpatialIndex                   _virtualNodesIndex;
+    qan::SpatialIndex                   _virtualEdgesIndex;
+    //! Indexed nodes and edges with an item, checked for release in updateVirtualization().
+    std::unordered_set<qan::Node*>      _realizedNodes;
+    std::unordered_set<qan::Edge*>      _realizedEdges;
+    std::vector<QPointer<qan::Node>>    _dirtyVirtualNodes;
+    std::vector<QPointer<qan::Edge>>    _dirtyVirtualEdges;
+    //! Query buffer reused across updateVirtualization() calls.
+    std::vector<qan::SpatialIndex::Key> _virtualizationKeys;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Asynchronous Items Creation *///---------------------------
+    //@{
+public:
+    /*! \brief Create node and edge items asynchronously with QQmlIncubator, default to false.
+     *
+     * When asynchronous, nodes and edges are inserted in graph topology immediately, but their items are created
+     * incrementally over the next frames: opening a large graph does not freeze the UI. Incubations are started
+     * in updatePolish() within \c incubationBudget, they then progress under engine incubation controller
+     * (QQuickWindow default controller incubate during frames idle time). Ready items are installed in graph
+     * (parented, indexed and notified with nodeItemRealized() or edgeItemRealized()) during the next
+     * updatePolish() passes within the same budget. Edges items are created once both
+     * their source and destination nodes items exist. Use nodeItemRealized() and edgeItemRealized() to
+     * configure incubated items, and \c pendingItemCount and itemsIncubated() to monitor progress.
+     *
+     * With an asynchronous graph, use qan::Node::setItemGeometry() to position a node before its item exists.
+     *
+     * \note Asynchronous creation is ignored when graph is \c virtualized, disabling it complete pending items
+     * creation synchronously (see completePendingItems()). Incubation passes are run before frames: graph must be
+     * displayed in a window.
+     */
+    Q_PROPERTY(bool asynchronous READ getAsynchronous WRITE setAsynchronous NOTIFY asynchronousChanged FINAL)
+    inline bool     getAsynchronous() const noexcept { return _asynchronous; }
+    void            setAsynchronous(bool asynchronous);
+private:
+    bool            _asynchronous = false;
+signals:
+    void            asynchronousChanged();
+
+public:
+    //! Maximum time spent installing incubated items and starting items incubations per frame in ms, default to 8ms (half a 60Hz frame).
+    Q_PROPERTY(int incubationBudget READ getIncubationBudget WRITE setIncubationBudget NOTIFY incubationBudgetChanged FINAL)
+    inline int      getIncubationBudget() const noexcept { return _incubationBudget; }
+    void            setIncubationBudget(int incubationBudget);
+private:
+    int             _incubationBudget = 8;
+signals:
+    void            incubationBudgetChanged();
+
+public:
+    //! Number of node and edge items waiting for creation or still incubating.
+    Q_PROPERTY(int pendingItemCount READ getPendingItemCount NOTIFY pendingItemCountChanged FINAL)
+    int             getPendingItemCount() const noexcept;
+    //! Create all pending node and edge items synchronously.
+    Q_INVOKABLE void    completePendingItems();
+signals:
+    void            pendingItemCountChanged();
+    //! Emitted once all pending node and edge items have been created.
+    void            itemsIncubated();
+
+private:
+    //! Schedule a pending items incubation pass in updatePolish().
+    void            scheduleIncubation();
+    //! Install incubated items, then start pending items incubation within \c incubationBudget.
+    void            incubatePendingItems();
+    void            incubateNode(qan::Node& node, bool synchronous);
+    void            incubateEdge(qan::Edge& edge, bool synchronous);
+    //! Return true if \c component has pooled items (they are reused synchronously, see \c reuseItems).
+    bool            hasPooledItem(const QQmlComponent& component) const;
+    //! Bind incubated \c object to its node or edge before its creation is completed (called by qan::ItemIncubator).
+    void            initIncubatedItem(qan::ItemIncubator& incubator, QObject* object);
+    //! Queue a ready incubated item for installation in next incubation pass (called by qan::ItemIncubator).
+    void            onItemIncubated(qan::ItemIncubator& incubator);
+    //! Install \c incubator ready item in graph (item is discarded if its node or edge has been removed).
+    void            installIncubatedItem(qan::ItemIncubator& incubator);
+    void            notifyPendingItemCount();
+
+    std::deque<QPointer<qan::Node>>     _pendingNodes;
+    std::vector<QPointer<qan::Edge>>    _pendingEdges;
+    std::vector<std::unique_ptr<qan::ItemIncubator>>    _incubators;
+    //! Ready incubators (owned by _incubators) waiting for installIncubatedItem().
+    std::deque<qan::ItemIncubator*>     _incubatedItems;
+    //! True while completePendingItems() is running: incubated items are installed immediately.
+    bool            _completingItems = false;
+    bool            _incubationScheduled = false;
+    //! True while items are pending since last itemsIncubated() notification.
+    bool            _incubating = false;
+    int             _notifiedPendingItemCount = 0;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Level of Detail *///---------------------------------------
+    //@{
+public:
+    /*! \brief Nodes and groups items level of detail, default to Full (usually set by qan::GraphView from its zoom).
+     *
+     * Level of detail is applied to all existing and future nodes and groups items, see
+     * qan::NodeItem::levelOfDetail and qan::NodeBatchRenderer.
+     */
+    Q_PROPERTY(qan::NodeItem::LevelOfDetail levelOfDetail READ getLevelOfDetail WRITE setLevelOfDetail NOTIFY levelOfDetailChanged FINAL)
+    inline qan::NodeItem::LevelOfDetail getLevelOfDetail() const noexcept { return _levelOfDetail; }
+    void            setLevelOfDetail(qan::NodeItem::LevelOfDetail levelOfDetail);
+private:
+    qan::NodeItem::LevelOfDetail    _levelOfDetail = qan::NodeItem::LevelOfDetail::Full;
+signals:
+    void            levelOfDetailChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Spatial Index *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Return visible nodes, groups and edges items whose bounding rect overlap \c rect (in container item CS).
+     *
+     * Edges are reported from their bounding rect, not from their exact shape. Complexity is logarithmic
+     * in graph size (plus the number of returned items), see qan::SpatialIndex.
+     */
+    Q_INVOKABLE QList<QQuickItem*>  itemsIn(const QRectF& rect) const;
+    /*! \brief Return top-most (maximum global z) visible node, group or edge item containing \c point (in container item CS).
+     *
+     * Item shape is taken into account with QQuickItem::contains(), for example, an edge is returned
+     * only when \c point is on the edge line.
+     */
+    Q_INVOKABLE QQuickItem*         itemAt(const QPointF& point) const;
+    //! Return the \c k visible nodes, groups and edges items nearest to \c point (in container item CS), sorted by increasing bounding rect distance.
+    Q_INVOKABLE QList<QQuickItem*>  nearest(const QPointF& point, int k) const;
+
+    //! Spatial index of nodes, groups and edges items bounding rects in container item CS (maintained by graph).
+    const qan::SpatialIndex&        getSpatialIndex() const;
+private:
+    //! Register \c item in spatial index, connect its geometry changes to index update (or unregister and disconnect it when \c enable is false).
+    void                            indexItem(QQuickItem* item, bool enable);
+    //! Schedule \c item index update (and the update of all its sub nodes for a group).
+    void                            scheduleIndexUpdate(QQuickItem* item);
+    void                            onIndexedItemGeometryChanged();
+    //! Update index for items modified since last update (called lazily before index queries).
+    void                            updateSpatialIndex() const;
+    //! Return true if \c item is a visible node, group or edge item still bound to a graph primitive.
+    static bool                     isIndexedItemValid(const QQuickItem* item) noexcept;
+
+    mutable qan::SpatialIndex                   _spatialIndex;
+    //! Non collapsed groups items only, used for drop target detection in groupAt().
+    mutable qan::SpatialIndex                   _groupsIndex;
+    //! Nodes, groups and edges items moved, resized or reparented since last updateSpatialIndex().
+    mutable std::vector<QPointer<QQuickItem>>   _dirtyIndexItems;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Group Management *///--------------------------------------
     //@{
 public:
@@ -769,7 +1212,7 @@ public:
     bool                selectEdge(qan::Edge& edge, Qt::KeyboardModifiers modifiers = Qt::NoModifier);
     Q_INVOKABLE bool    selectEdge(qan::Edge* edge);
 
-    /*! \brief Add a node in the current selection.
+    /*! \brief Add a node in the current selection (locked primitives and primitives without item are not selected).
      */
     void            addToSelection(qan::Node& node);
     //! \copydoc addToSelection
@@ -782,8 +1225,32 @@ public:
     //! \copydoc removeFromSelection
     void            removeFromSelection(qan::Group& node);
     //! \copydoc removeFromSelection
+    void            removeFromSelection(qan::Edge& edge);
+    //! \copydoc removeFromSelection
     void            removeFromSelection(QQuickItem* item);
 
+    /*! \brief Select (or deselect) nodes, groups and edges \c items with a single selectionChanged() notification.
+     *
+     * Selection containers are updated in batch (with a single model rows insertion when selecting), prefer this
+     * method to multiple setNodeSelected() / setEdgeSelected() calls when a large number of items are modified at
+     * once (for example, in qan::GraphView rubber band selection). Selection policy is not taken into account and
+     * locked primitives are not selected.
+     *
+     * \note Selection containers order is not preserved when items are deselected.
+     */
+    void            setItemsSelected(const std::vector<QQuickItem*>& items, bool selected);
+private:
+    /*! \brief Select (or deselect) \c items primitives and update selection containers, return true if selection has been modified.
+     *
+     * Single selection implementation used by addToSelection(), setNodeSelected(), setEdgeSelected() and
+     * setItemsSelected(), selectionChanged() is not emitted.
+     */
+    bool            selectItems(const std::vector<QQuickItem*>& items, bool selected);
+    //! True while selectItems() update selection containers (removeFromSelection(QQuickItem*) is then ignored).
+    bool            _selectionBatchUpdate = false;
+
+public:
+
     //! Select all graph content (nodes, groups and edges).
     Q_INVOKABLE void    selectAll();
 
@@ -847,6 +1314,17 @@ signals:
     //! \copydoc _selectedEdges
     void                selectedEdgesChanged();
 
+public:
+    //! Selected primitive position in its selection container (selected primitives are found and removed in constant time).
+    using SelectionIndex = std::unordered_map<const QObject*, int>;
+private:
+    //! \copydoc SelectionIndex
+    SelectionIndex      _selectedNodesIndex;
+    //! \copydoc SelectionIndex
+    SelectionIndex      _selectedGroupsIndex;
+    //! \copydoc SelectionIndex
+    SelectionIndex      _selectedEdgesIndex;
+
 protected:
     //! \brief Return a vector of currently selected nodes/groups items.
     std::vector<QQuickItem*>    getSelectedItems() const;
@@ -1071,13 +1549,13 @@ public:
 public:
     /*! \brief Synchronously collect all graph nodes of \c node using DFS.
      *
-     * \warning this method is synchronous and recursive.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      */
     std::vector<QPointer<const qan::Node>>   collectRootNodes() const noexcept;
 
     /*! \brief Synchronously collect all sub-nodes of graph root nodes using DFS.
      *
-     * \warning this method is synchronous and recursive.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      */
     std::vector<const qan::Node*>   collectDfs(bool collectGroup = false) const noexcept;
 
@@ -1085,19 +1563,13 @@ public:
      *
      * \note \c node is automatically added to the result and returned as the first
      * node of the return set.
-     * \warning this method is synchronous and recursive.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      */
     std::vector<const qan::Node*>   collectDfs(const qan::Node& node, bool collectGroup = false) const noexcept;
 
     //! Collect all out nodes of \c nodes using DFS, return an unordered set of subnodes (nodes in node are _not_ in returned set).
     auto    collectSubNodes(const QVector<qan::Node*> nodes, bool collectGroup = false) const noexcept -> std::unordered_set<const qan::Node*>;
 
-private:
-    void    collectDfsRec(const qan::Node*,
-                          std::unordered_set<const qan::Node*>& marks,
-                          std::vector<const qan::Node*>& childs,
-                          bool collectGroup) const noexcept;
-
 public:
     //! Return a set of all edges strongly connected to a set of nodes (ie where source AND destination is in \c nodes).
     auto    collectInnerEdges(const std::vector<const qan::Node*>& nodes) const -> std::unordered_set<const qan::Edge*>;
@@ -1121,7 +1593,7 @@ public:
      * Neighbours of N1: [N1, N2, G1, G2, N3]  note presence of N3 in N1 parent group.
      * Neighbours of N4: [N4, N5, G3]
      *
-     * \warning this method is synchronous and recursive.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      */
     std::vector<const qan::Node*>   collectNeighbours(const qan::Node& node) const;
 
@@ -1133,25 +1605,111 @@ public:
      * \note All ancestors "neighbours" nodes are also added to set.
      * \note \c node is _not_ added to result.
      * \sa collectNeighbours()
-     * \warning this method is synchronous and recursive.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      */
     std::vector<const qan::Node*>   collectAncestors(const qan::Node& node) const;
 
     //! FIXME.
     std::vector<const qan::Node*>   collectChilds(const qan::Node& node) const;
 
+public:
+    /*! \brief Maintain an incremental reachability index to answer isAncestor() queries in near-constant time (default to false).
+     *
+     * Index cost O(V) memory and is updated on node/edge insertion, it is usefull when isAncestor() is called
+     * frequently on large graphs (for example to reject circuits in connectors), see gtpo::reachability_index.
+     */
+    Q_PROPERTY(bool reachabilityIndexed READ getReachabilityIndexed WRITE setReachabilityIndexed NOTIFY reachabilityIndexedChanged FINAL)
+    inline bool     getReachabilityIndexed() const noexcept { return is_reachability_indexed(); }
+    void            setReachabilityIndexed(bool reachabilityIndexed) noexcept;
+signals:
+    void            reachabilityIndexedChanged();
+
 public:
     //! \copydoc isAncestor()
     Q_INVOKABLE bool        isAncestor(qan::Node* node, qan::Node* candidate) const;
 
     /*! \brief Return true if \c candidate node is an ancestor of given \c node.
      *
-     * \warning this method is synchronous and recursive.
+     * \note Use reachability index when \c reachabilityIndexed is true.
+     * \note this method is synchronous, but non recursive (see gtpo::traversal).
      * \return true if \c candidate is an ancestor of \c node (ie \c node is an out
      * node of \c candidate at any degree).
      */
     bool                    isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept;
 
+public:
+    //! Immutable CSR topology snapshot, built with snapshot() (see gtpo::snapshot).
+    using Snapshot = super_t::snapshot_t;
+
+    /*! \brief Collect all sub-nodes of \c snapshot root nodes using iterative DFS on a topology snapshot.
+     *
+     * Same result than collectDfs(bool), but run on \c snapshot dense adjacency arrays with bitset marks.
+     */
+    std::vector<const qan::Node*>   collectDfs(const Snapshot& snapshot, bool collectGroup = false) const noexcept;
+
+    //! \copydoc collectDfs(const qan::Node&, bool), run on a topology \c snapshot.
+    std::vector<const qan::Node*>   collectDfs(const Snapshot& snapshot, const qan::Node& node, bool collectGroup = false) const noexcept;
+
+    //! Return a set of all edges where source AND destination are in \c nodes, run on a topology \c snapshot.
+    auto    collectInnerEdges(const Snapshot& snapshot, const std::vector<const qan::Node*>& nodes) const -> std::unordered_set<const qan::Edge*>;
+
+    //! \copydoc collectNeighbours(), run on a topology \c snapshot.
+    std::vector<const qan::Node*>   collectNeighbours(const Snapshot& snapshot, const qan::Node& node) const;
+
+    //! \copydoc collectAncestors(), run on a topology \c snapshot.
+    std::vector<const qan::Node*>   collectAncestors(const Snapshot& snapshot, const qan::Node& node) const;
+
+    //! \copydoc collectChilds(), run on a topology \c snapshot.
+    std::vector<const qan::Node*>   collectChilds(const Snapshot& snapshot, const qan::Node& node) const;
+
+    //! \copydoc isAncestor(const qan::Node&, const qan::Node&), run on a topology \c snapshot.
+    bool                    isAncestor(const Snapshot& snapshot, const qan::Node& node, const qan::Node& candidate) const noexcept;
+
+private:
+    //! Iterative DFS on \c snapshot starting from \c stack content, visited nodes are appended to \c nodes.
+    void    collectDfsIter(const Snapshot& snapshot, std::vector<Snapshot::node_id>& stack,
+                           gtpo::node_marks& marks, std::vector<const qan::Node*>& nodes,
+                           bool collectGroup) const noexcept;
+
+    //! Collect \c node ancestors (\c inNodes = true) or childs of \c node in \c snapshot.
+    std::vector<const qan::Node*>   collectRelatives(const Snapshot& snapshot, const qan::Node& node, bool inNodes) const;
+
+    //! Collect \c node ancestors (\c inNodes = true) or childs of \c node using graph traversal engine.
+    std::vector<const qan::Node*>   collectRelatives(const qan::Node& node, bool inNodes) const;
+
+public:
+    /*! \brief Return graph strongly connected components as a list of nodes lists (see gtpo::strongly_connected_components()).
+     *
+     * \note Components are sorted in reverse topological order of the components graph.
+     */
+    Q_INVOKABLE QVariantList        stronglyConnectedComponents() const;
+    std::vector<std::vector<const qan::Node*>>  collectStronglyConnectedComponents() const;
+
+    //! Return graph weakly connected components (edges direction is ignored) as a list of nodes lists (see gtpo::weakly_connected_components()).
+    Q_INVOKABLE QVariantList        connectedComponents() const;
+    std::vector<std::vector<const qan::Node*>>  collectConnectedComponents() const;
+
+    //! Return nodes reachable from \c source grouped by BFS distance (first layer contains only \c source).
+    Q_INVOKABLE QVariantList        bfsLayers(qan::Node* source) const;
+    std::vector<std::vector<const qan::Node*>>  collectBfsLayers(const qan::Node& source) const;
+
+    //! Return nodes on the shortest path from \c source to \c destination using edges \c weight (empty if \c destination is not reachable).
+    Q_INVOKABLE QVariantList        shortestPath(qan::Node* source, qan::Node* destination) const;
+
+    /*! \brief Return nodes on the shortest path from \c source to \c destination using Dijkstra algorithm (see gtpo::dijkstra_shortest_paths()).
+     *
+     * \arg weight edge weight callback, must return a positive value.
+     * \return path nodes from \c source to \c destination (empty if \c destination is not reachable).
+     */
+    std::vector<const qan::Node*>   collectShortestPath(const qan::Node& source, const qan::Node& destination,
+                                                        const std::function<qreal(const qan::Edge&)>& weight) const;
+
+private:
+    //! Map snapshot node ids lists to nodes lists.
+    static std::vector<std::vector<const qan::Node*>>   toNodes(const Snapshot& snapshot, const std::vector<std::vector<Snapshot::node_id>>& ids);
+    //! Convert a nodes lists to a QML friendly list of nodes lists.
+    static QVariantList     toVariantList(const std::vector<std::vector<const qan::Node*>>& nodes);
+
 public:
     /*! Collect all nodes and groups contained in given groups.
      *
@@ -57,40 +57,8 @@ Node_t*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeSty
         if (nodeStyle == nullptr)
             nodeStyle = Node_t::style(nullptr);
         _styleManager.setStyleComponent(nodeStyle, nodeComponent);      // nullptr nodeComponent is ok
-        qan::NodeItem* nodeItem = nodeComponent != nullptr ? static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                                                              *nodeStyle,
-                                                                                                              node)) :
-                                                             nullptr;
-
-        if (nodeItem != nullptr) {
-            nodeItem->setNode(node);
-            nodeItem->setGraph(this);
-            node->setItem(nodeItem);
-            auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeClicked,
-                    this,     notifyNodeClicked);
-
-            auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeRightClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeRightClicked,
-                    this,     notifyNodeRightClicked);
-
-            auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
-                    this,     notifyNodeDoubleClicked);
-            {   // Send item to front
-                _maxZ += 1;
-                nodeItem->setZ(_maxZ);
-            }
-        }
+        if (nodeComponent != nullptr)
+            configureNode(*node, *nodeComponent, *nodeStyle);
         insert_node(node);        // Insert visual or non visual node
     } catch (const qan::Error& e) {
         qWarning() << "qan::Graph::insertNode(): Error: " << e.getMsg();
@@ -159,8 +127,10 @@ qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent*
         qWarning() << "qan::Graph::insertEdge<>(): Error: Topology error.";
         // Note: edge is cleaned automatically if it has still not been inserted to graph
     }
-    if (configuredEdge != nullptr)
+    if (configuredEdge != nullptr) {
+        onEdgeInserted(*configuredEdge);
         emit edgeInserted(configuredEdge);
+    }
     return configuredEdge;
 }
 
@@ -32,6 +32,9 @@
 // \date	2016 08 15
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <vector>
+
 // Qt headers
 #include <QtNumeric>
 #include <QQuickItem>
@@ -48,6 +51,20 @@ GraphView::GraphView(QQuickItem* parent) :
     qan::Navigable{parent}
 {
     setFocus(true);
+
+    // Follow pan, zoom and resize to update graph viewport (used for items virtualization)
+    connect(this,   &qan::Navigable::containerItemModified,
+            this,   &qan::GraphView::updateGraphViewport);
+    connect(this,   &QQuickItem::widthChanged,
+            this,   &qan::GraphView::updateGraphViewport);
+    connect(this,   &QQuickItem::heightChanged,
+            this,   &qan::GraphView::updateGraphViewport);
+    const auto containerItem = getContainerItem();
+    if (containerItem != nullptr) {
+        for (const auto signal : {&QQuickItem::xChanged, &QQuickItem::yChanged, &QQuickItem::scaleChanged})
+            connect(containerItem,  signal,
+                    this,           &qan::GraphView::updateGraphViewport);
+    }
 }
 
 void    GraphView::setGraph(qan::Graph* graph)
@@ -92,9 +109,50 @@ void    GraphView::setGraph(qan::Graph* graph)
                 this,   &qan::GraphView::groupRightClicked);
         connect(_graph, &qan::Graph::groupDoubleClicked,
                 this,   &qan::GraphView::groupDoubleClicked);
+        updateGraphViewport();
         emit graphChanged();
     }
 }
+
+void    GraphView::updateGraphViewport()
+{
+    const auto containerItem = getContainerItem();
+    if (_graph &&
+        containerItem != nullptr)
+        _graph->setViewportRect(mapRectToItem(containerItem, QRectF{0., 0., width(), height()}));
+    updateLevelOfDetail();
+}
+//-----------------------------------------------------------------------------
+
+/* Level of Detail Management *///---------------------------------------------
+void    GraphView::setLodSimplifiedZoom(qreal lodSimplifiedZoom)
+{
+    if (qFuzzyCompare(1. + lodSimplifiedZoom, 1. + _lodSimplifiedZoom))
+        return;
+    _lodSimplifiedZoom = lodSimplifiedZoom;
+    updateLevelOfDetail();
+    emit lodSimplifiedZoomChanged();
+}
+
+void    GraphView::setLodFlatZoom(qreal lodFlatZoom)
+{
+    if (qFuzzyCompare(1. + lodFlatZoom, 1. + _lodFlatZoom))
+        return;
+    _lodFlatZoom = lodFlatZoom;
+    updateLevelOfDetail();
+    emit lodFlatZoomChanged();
+}
+
+void    GraphView::updateLevelOfDetail()
+{
+    if (!_graph)
+        return;
+    const qreal zoom = getZoom();
+    using LevelOfDetail = qan::NodeItem::LevelOfDetail;
+    _graph->setLevelOfDetail(zoom < _lodFlatZoom ? LevelOfDetail::Flat :
+                             zoom < _lodSimplifiedZoom ? LevelOfDetail::Simplified :
+                                                         LevelOfDetail::Full);
+}
 //-----------------------------------------------------------------------------
 
 
@@ -130,81 +188,75 @@ void    GraphView::selectionRectActivated(const QRectF& rect)
     if (rect.isEmpty())
         return;
     // Algorithm:
-    // 1. Iterate over all already selected items, remove one that are no longer inside selection rect
-    //    (for example, if selection rect has grown down...)
-    // 2. Iterate over all graph items, select items inside selection rect.
+    // 1. Query graph spatial index for items intersecting the difference between previous and current
+    //    selection rects: items entering or leaving selection rect necessarily intersect it.
+    // 2. Deselect candidates previously selected that are no longer inside selection rect, select top level
+    //    candidates that are now inside selection rect.
+    // 3. Apply selection changes in batch (a single qan::Graph::selectionChanged() per change).
+    const auto containerItem = _graph->getContainerItem();
 
     // 1.
-    QSetIterator<QQuickItem*> selectedItem(_selectedItems);
-    while (selectedItem.hasNext()) {
-        const auto item = selectedItem.next();
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-        if (nodeItem != nullptr &&
-            nodeItem->getNode() != nullptr ) {
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (!rect.contains(itemBr)) {
-                _graph->setNodeSelected(*nodeItem->getNode(), false);
-                _selectedItems.remove(item);
-            }
-        } else {
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                        item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (!rect.contains(itemBr)) {
-                    _graph->setEdgeSelected(edgeItem->getEdge(), false);
-                    _selectedItems.remove(item);
-                }
-            }
-        }
+    std::vector<QRectF> regions;
+    if (_selectionRect.isEmpty())
+        regions.push_back(rect);
+    else {
+        appendRectDifference(_selectionRect, rect, regions);
+        appendRectDifference(rect, _selectionRect, regions);
+    }
+    _selectionRect = rect;
+    QSet<QQuickItem*> candidates;
+    for (const auto& region : regions) {
+        const auto items = _graph->itemsIn(region);
+        for (const auto item : items)
+            candidates.insert(item);
     }
 
     // 2.
-    const auto items = _graph->getContainerItem()->childItems();
-    for (const auto item: items) {
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-        if (nodeItem != nullptr &&
-            nodeItem->isSelectable() &&
-            nodeItem->getNode() != nullptr) {
-            auto node = nodeItem->getNode();
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (rect.contains(itemBr)) {
-                _graph->setNodeSelected(*node, true);
-                // Note we assume that items are not deleted while the selection
-                // is in progress... (QPointer can't be trivially inserted in QSet)
-                _selectedItems.insert(nodeItem);
-            }
-        } else {
-            // 3. Edge selection...
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                  item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (rect.contains(itemBr)) {
-                    auto edge = edgeItem->getEdge();
-                    _graph->setEdgeSelected(edge, true);
-                    _selectedItems.insert(edgeItem);
-                }
+    const auto isInside = [&rect, containerItem](QQuickItem* item) -> bool {
+        auto itemBr = item->mapRectToItem(containerItem, item->boundingRect());
+        if (qobject_cast<qan::EdgeItem*>(item) != nullptr) {
+            if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
+                itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
+            if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
+                itemBr.setWidth(0.5);
+        }
+        return rect.contains(itemBr);
+    };
+    std::vector<QQuickItem*> selectedItems;
+    std::vector<QQuickItem*> deselectedItems;
+    for (const auto item : qAsConst(candidates)) {
+        if (_selectedItems.contains(item)) {
+            if (!isInside(item)) {
+                deselectedItems.push_back(item);
+                _selectedItems.remove(item);
             }
+            continue;
+        }
+        if (item->parentItem() != containerItem)    // Only top level items are selected (not grouped nodes)
+            continue;
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        if (nodeItem != nullptr &&
+            !nodeItem->isSelectable())
+            continue;
+        if (isInside(item)) {
+            selectedItems.push_back(item);
+            // Note we assume that items are not deleted while the selection
+            // is in progress... (QPointer can't be trivially inserted in QSet)
+            _selectedItems.insert(item);
         }
     }
+
+    // 3.
+    if (!deselectedItems.empty())
+        _graph->setItemsSelected(deselectedItems, false);
+    if (!selectedItems.empty())
+        _graph->setItemsSelected(selectedItems, true);
 }
 
 void    GraphView::selectionRectEnd()
 {
     _selectedItems.clear();  // Clear selection cache
+    _selectionRect = QRectF{};
 }
 
 void    GraphView::keyPressEvent(QKeyEvent *event)
@@ -72,6 +72,44 @@ private:
     QPointer<qan::Graph>    _graph = nullptr;
 signals:
     void                    graphChanged();
+
+private:
+    //! Update graph \c viewportRect from current view geometry, pan and zoom.
+    void                    updateGraphViewport();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Level of Detail Management *///----------------------------------
+    //@{
+public:
+    /*! \brief Below this zoom, graph nodes and groups are rendered with a Simplified level of detail (default to 0.5).
+     *
+     * \sa qan::NodeItem::levelOfDetail, set to 0. to always render nodes with full details.
+     */
+    Q_PROPERTY(qreal lodSimplifiedZoom READ getLodSimplifiedZoom WRITE setLodSimplifiedZoom NOTIFY lodSimplifiedZoomChanged FINAL)
+    inline qreal            getLodSimplifiedZoom() const noexcept { return _lodSimplifiedZoom; }
+    void                    setLodSimplifiedZoom(qreal lodSimplifiedZoom);
+private:
+    qreal                   _lodSimplifiedZoom = 0.5;
+signals:
+    void                    lodSimplifiedZoomChanged();
+
+public:
+    /*! \brief Below this zoom, graph nodes and groups are rendered with a Flat level of detail (default to 0.3).
+     *
+     * Flat nodes are drawn as flat rectangles when a qan::NodeBatchRenderer is attached to graph.
+     */
+    Q_PROPERTY(qreal lodFlatZoom READ getLodFlatZoom WRITE setLodFlatZoom NOTIFY lodFlatZoomChanged FINAL)
+    inline qreal            getLodFlatZoom() const noexcept { return _lodFlatZoom; }
+    void                    setLodFlatZoom(qreal lodFlatZoom);
+private:
+    qreal                   _lodFlatZoom = 0.3;
+signals:
+    void                    lodFlatZoomChanged();
+
+private:
+    //! Update graph \c levelOfDetail from current zoom.
+    void                    updateLevelOfDetail();
     //@}
     //-------------------------------------------------------------------------
 
@@ -118,7 +156,10 @@ protected:
     //! \copydoc qan::Navigable::selectionRectEnd()
     virtual void    selectionRectEnd() override;
 private:
+    //! Items selected since selection rectangle activation.
     QSet<QQuickItem*>   _selectedItems;
+    //! Selection rectangle at last selectionRectActivated() call (in container CS), null when no selection is in progress.
+    QRectF              _selectionRect;
 
 protected:
     virtual void    keyPressEvent(QKeyEvent *event) override;
@@ -146,7 +146,7 @@ void    GroupItem::groupMoved()
         for (auto edge : adjacentEdges) {
             if (edge != nullptr &&
                 edge->getItem() != nullptr)
-                edge->getItem()->updateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
+                edge->getItem()->updateItemSlot(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
         }
     }
 }
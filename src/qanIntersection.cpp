@@ -0,0 +1,510 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanIntersection.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanIntersection.h"
+
+// SIMD kernels configuration: SSE2 is part of x86-64 baseline and is selected at compile time,
+// AVX2 kernel is compiled with a per function target and selected at runtime.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define QAN_INTERSECTION_SSE2
+#       include <emmintrin.h>
+#   endif
+#   if defined(__GNUC__) || defined(__clang__)
+#       define QAN_INTERSECTION_AVX2
+#       define QAN_INTERSECTION_AVX2_TARGET __attribute__((target("avx2")))
+#       include <immintrin.h>
+#   elif defined(_MSC_VER)
+#       define QAN_INTERSECTION_AVX2
+#       define QAN_INTERSECTION_AVX2_TARGET
+#       include <immintrin.h>
+#       include <intrin.h>
+#   endif
+#endif
+
+namespace qan { // ::qan
+
+/* Segment/Polygon Intersection Kernels *///-----------------------------------
+// All kernels test segment [p1, p2] against polygon edges [v(e), v(e+1)] using QLineF::intersects()
+// formulation without division: with a = p2 - p1, b = v(e) - v(e+1) and c = p1 - v(e),
+// intersection is bounded if na = (b x c) / den and nb = (c x a) / den are both in [0, 1].
+
+int     segmentPolygonIntersectionScalar(float p1x, float p1y, float p2x, float p2y,
+                                         const float* xs, const float* ys, int edgeCount) noexcept
+{
+    const float ax = p2x - p1x;
+    const float ay = p2y - p1y;
+    for (int e = 0; e < edgeCount; e++) {
+        const float bx = xs[e] - xs[e + 1];
+        const float by = ys[e] - ys[e + 1];
+        const float cx = p1x - xs[e];
+        const float cy = p1y - ys[e];
+        const float den = ay * bx - ax * by;
+        const float na = by * cx - bx * cy;
+        const float nb = ax * cy - ay * cx;
+        const bool bounded = den > 0.f ? (na >= 0.f && na <= den && nb >= 0.f && nb <= den) :
+                                         (den < 0.f && na <= 0.f && na >= den && nb <= 0.f && nb >= den);
+        if (bounded)
+            return e;
+    }
+    return -1;
+}
+
+namespace { // ::qan::
+
+inline int  lowestBit(int bits) noexcept
+{
+    int lane = 0;
+    while ((bits & (1 << lane)) == 0)
+        ++lane;
+    return lane;
+}
+
+#if defined(QAN_INTERSECTION_SSE2)
+int     segmentPolygonIntersectionSse2(float p1x, float p1y, float p2x, float p2y,
+                                       const float* xs, const float* ys, int edgeCount) noexcept
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 vp1x = _mm_set1_ps(p1x);
+    const __m128 vp1y = _mm_set1_ps(p1y);
+    const __m128 ax = _mm_set1_ps(p2x - p1x);
+    const __m128 ay = _mm_set1_ps(p2y - p1y);
+    for (int e = 0; e < edgeCount; e += 4) {
+        const __m128 x0 = _mm_loadu_ps(xs + e);
+        const __m128 y0 = _mm_loadu_ps(ys + e);
+        const __m128 bx = _mm_sub_ps(x0, _mm_loadu_ps(xs + e + 1));
+        const __m128 by = _mm_sub_ps(y0, _mm_loadu_ps(ys + e + 1));
+        const __m128 cx = _mm_sub_ps(vp1x, x0);
+        const __m128 cy = _mm_sub_ps(vp1y, y0);
+        const __m128 den = _mm_sub_ps(_mm_mul_ps(ay, bx), _mm_mul_ps(ax, by));
+        const __m128 na = _mm_sub_ps(_mm_mul_ps(by, cx), _mm_mul_ps(bx, cy));
+        const __m128 nb = _mm_sub_ps(_mm_mul_ps(ax, cy), _mm_mul_ps(ay, cx));
+        const __m128 positive = _mm_and_ps(_mm_cmpgt_ps(den, zero),
+                                           _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(na, zero), _mm_cmple_ps(na, den)),
+                                                      _mm_and_ps(_mm_cmpge_ps(nb, zero), _mm_cmple_ps(nb, den))));
+        const __m128 negative = _mm_and_ps(_mm_cmplt_ps(den, zero),
+                                           _mm_and_ps(_mm_and_ps(_mm_cmple_ps(na, zero), _mm_cmpge_ps(na, den)),
+                                                      _mm_and_ps(_mm_cmple_ps(nb, zero), _mm_cmpge_ps(nb, den))));
+        const int bits = _mm_movemask_ps(_mm_or_ps(positive, negative));
+        if (bits != 0)      // Padding edges are degenerated and never intersect
+            return e + lowestBit(bits);
+    }
+    return -1;
+}
+#endif
+
+#if defined(QAN_INTERSECTION_AVX2)
+QAN_INTERSECTION_AVX2_TARGET
+int     segmentPolygonIntersectionAvx2(float p1x, float p1y, float p2x, float p2y,
+                                       const float* xs, const float* ys, int edgeCount) noexcept
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 vp1x = _mm256_set1_ps(p1x);
+    const __m256 vp1y = _mm256_set1_ps(p1y);
+    const __m256 ax = _mm256_set1_ps(p2x - p1x);
+    const __m256 ay = _mm256_set1_ps(p2y - p1y);
+    for (int e = 0; e < edgeCount; e += 8) {
+        const __m256 x0 = _mm256_loadu_ps(xs + e);
+        const __m256 y0 = _mm256_loadu_ps(ys + e);
+        const __m256 bx = _mm256_sub_ps(x0, _mm256_loadu_ps(xs + e + 1));
+        const __m256 by = _mm256_sub_ps(y0, _mm256_loadu_ps(ys + e + 1));
+        const __m256 cx = _mm256_sub_ps(vp1x, x0);
+        const __m256 cy = _mm256_sub_ps(vp1y, y0);
+        const __m256 den = _mm256_sub_ps(_mm256_mul_ps(ay, bx), _mm256_mul_ps(ax, by));
+        const __m256 na = _mm256_sub_ps(_mm256_mul_ps(by, cx), _mm256_mul_ps(bx, cy));
+        const __m256 nb = _mm256_sub_ps(_mm256_mul_ps(ax, cy), _mm256_mul_ps(ay, cx));
+        const __m256 positive = _mm256_and_ps(_mm256_cmp_ps(den, zero, _CMP_GT_OQ),
+                                              _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(na, zero, _CMP_GE_OQ), _mm256_cmp_ps(na, den, _CMP_LE_OQ)),
+                                                            _mm256_and_ps(_mm256_cmp_ps(nb, zero, _CMP_GE_OQ), _mm256_cmp_ps(nb, den, _CMP_LE_OQ))));
+        const __m256 negative = _mm256_and_ps(_mm256_cmp_ps(den, zero, _CMP_LT_OQ),
+                                              _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(na, zero, _CMP_LE_OQ), _mm256_cmp_ps(na, den, _CMP_GE_OQ)),
+                                                            _mm256_and_ps(_mm256_cmp_ps(nb, zero, _CMP_LE_OQ), _mm256_cmp_ps(nb, den, _CMP_GE_OQ))));
+        const int bits = _mm256_movemask_ps(_mm256_or_ps(positive, negative));
+        if (bits != 0)
+            return e + lowestBit(bits);
+    }
+    return -1;
+}
+
+bool    cpuHasAvx2() noexcept
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx ||
+        (_xgetbv(0) & 0x6) != 0x6)  // OS must save YMM registers
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+const std::vector<SegmentPolygonIntersectionKernel>&   availableKernels() noexcept
+{
+    static const std::vector<SegmentPolygonIntersectionKernel> kernels = []() {
+        std::vector<SegmentPolygonIntersectionKernel> k{SegmentPolygonIntersectionKernel{}};
+#if defined(QAN_INTERSECTION_SSE2)
+        k.push_back(SegmentPolygonIntersectionKernel{&segmentPolygonIntersectionSse2, "sse2"});
+#endif
+#if defined(QAN_INTERSECTION_AVX2)
+        if (cpuHasAvx2())
+            k.push_back(SegmentPolygonIntersectionKernel{&segmentPolygonIntersectionAvx2, "avx2"});
+#endif
+        return k;
+    }();
+    return kernels;
+}
+
+} // ::qan::
+
+int     segmentPolygonIntersection(float p1x, float p1y, float p2x, float p2y,
+                                   const float* xs, const float* ys, int edgeCount) noexcept
+{
+    static const auto kernel = availableKernels().back().function;
+    return kernel(p1x, p1y, p2x, p2y, xs, ys, edgeCount);
+}
+
+const char* segmentPolygonIntersectionKernel() noexcept { return availableKernels().back().name; }
+
+const std::vector<SegmentPolygonIntersectionKernel>&    segmentPolygonIntersectionKernels() noexcept { return availableKernels(); }
+//-----------------------------------------------------------------------------
+
+/* ClipPolygon *///-------------------------------------------------------------
+void    ClipPolygon::reset(const QPolygonF& polygon)
+{
+    _polygon = polygon;
+    const int vertexCount = static_cast<int>(polygon.size());
+    _edgeCount = vertexCount > 1 ? vertexCount - 1 : 0;
+
+    // Pad vertices up to a multiple of 8 edges (plus one vertex) with last vertex, padding edges
+    // are then degenerated and never intersect.
+    const std::size_t paddedCount = static_cast<std::size_t>(((_edgeCount + 7) / 8) * 8 + 1);
+    _xs.resize(paddedCount);
+    _ys.resize(paddedCount);
+    for (int v = 0; v < vertexCount; v++) {
+        _xs[v] = static_cast<float>(polygon[v].x());
+        _ys[v] = static_cast<float>(polygon[v].y());
+    }
+    const float lastX = vertexCount > 0 ? _xs[vertexCount - 1] : 0.f;
+    const float lastY = vertexCount > 0 ? _ys[vertexCount - 1] : 0.f;
+    std::fill(_xs.begin() + vertexCount, _xs.end(), lastX);
+    std::fill(_ys.begin() + vertexCount, _ys.end(), lastY);
+
+    // Detect (eventually rounded) axis aligned rectangles:
+        // 1. Every vertex is either on the bounding rect border, or in a corner square (rounded corners).
+        // 2. Every edge either lay on a single border side, or in a single corner square: polygon
+        //    border then exactly match its bounding rect outside of corner squares.
+        // 3. Every side is covered by edges outside of corner squares.
+    _rect = false;
+    _cornerSize = 0.;
+    _br = polygon.boundingRect();
+    if (_edgeCount < 4 ||
+        _br.width() <= 0. || _br.height() <= 0.)
+        return;
+    static constexpr qreal tolerance = 0.001;
+    const auto onBorder = [this](const QPointF& p) -> bool {
+        return std::min(p.x() - _br.left(), _br.right() - p.x()) <= tolerance ||
+               std::min(p.y() - _br.top(), _br.bottom() - p.y()) <= tolerance;
+    };
+    const auto cornerDistance = [this](const QPointF& p) -> qreal {
+        return std::max(std::min(p.x() - _br.left(), _br.right() - p.x()),
+                        std::min(p.y() - _br.top(), _br.bottom() - p.y()));
+    };
+    qreal cornerSize = 0.;
+    for (int e = 0; e < _edgeCount; e++) {          // 1.
+        const auto& a = polygon[e];
+        const auto& b = polygon[e + 1];
+        if (!onBorder(a) || !onBorder(b)) {     // Edge to or from a rounded corner vertex
+            cornerSize = std::max(cornerSize, cornerDistance(a));
+            cornerSize = std::max(cornerSize, cornerDistance(b));
+        }
+    }
+    if (2. * cornerSize >= std::min(_br.width(), _br.height()))
+        return;     // Not rect-like
+
+    const auto corner = [this](const QPointF& p) -> int {   // Index of p nearest corner
+        return (p.x() - _br.left() < _br.right() - p.x() ? 0 : 1) +
+               (p.y() - _br.top() < _br.bottom() - p.y() ? 0 : 2);
+    };
+    const auto inCorner = [this, cornerSize](const QPointF& p) -> bool {
+        return std::min(p.x() - _br.left(), _br.right() - p.x()) <= cornerSize + tolerance &&
+               std::min(p.y() - _br.top(), _br.bottom() - p.y()) <= cornerSize + tolerance;
+    };
+    qreal covered[4] = {0., 0., 0., 0.};    // Left, top, right, bottom
+    for (int e = 0; e < _edgeCount; e++) {          // 2.
+        const auto& a = polygon[e];
+        const auto& b = polygon[e + 1];
+        if (std::abs(a.x() - _br.left()) <= tolerance && std::abs(b.x() - _br.left()) <= tolerance)
+            covered[0] += std::abs(b.y() - a.y());
+        else if (std::abs(a.y() - _br.top()) <= tolerance && std::abs(b.y() - _br.top()) <= tolerance)
+            covered[1] += std::abs(b.x() - a.x());
+        else if (std::abs(a.x() - _br.right()) <= tolerance && std::abs(b.x() - _br.right()) <= tolerance)
+            covered[2] += std::abs(b.y() - a.y());
+        else if (std::abs(a.y() - _br.bottom()) <= tolerance && std::abs(b.y() - _br.bottom()) <= tolerance)
+            covered[3] += std::abs(b.x() - a.x());
+        else if (!(inCorner(a) && inCorner(b) && corner(a) == corner(b)))
+            return;     // Edge crossing bounding rect inside
+    }
+    const qreal height = _br.height() - 2. * cornerSize - tolerance;   // 3.
+    const qreal width = _br.width() - 2. * cornerSize - tolerance;
+    if (covered[0] < height || covered[2] < height ||
+        covered[1] < width || covered[3] < width)
+        return;
+    _cornerSize = cornerSize;
+    _rect = true;
+}
+
+bool    ClipPolygon::intersectRect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept
+{
+    // Fast path is valid only for a segment going from polygon "core" (bounding rect minus corner squares)
+    // to the outside of its bounding rect, such a segment can't cross a corner square inside bounding rect
+    // and cross polygon border exactly once on bounding rect border.
+    const QRectF core = _br.adjusted(_cornerSize, _cornerSize, -_cornerSize, -_cornerSize);
+    const auto inCore = [&core](const QPointF& p) {
+        return p.x() > core.left() && p.x() < core.right() &&
+               p.y() > core.top() && p.y() < core.bottom();
+    };
+    const auto outside = [this](const QPointF& p) {
+        return p.x() < _br.left() || p.x() > _br.right() ||
+               p.y() < _br.top() || p.y() > _br.bottom();
+    };
+    QPointF in, out;
+    if (inCore(p1) && outside(p2)) {
+        in = p1; out = p2;
+    } else if (inCore(p2) && outside(p1)) {
+        in = p2; out = p1;
+    } else
+        return false;
+
+    const qreal dx = out.x() - in.x();
+    const qreal dy = out.y() - in.y();
+    const qreal tx = dx > 0. ? (_br.right() - in.x()) / dx :
+                     dx < 0. ? (_br.left() - in.x()) / dx : std::numeric_limits<qreal>::max();
+    const qreal ty = dy > 0. ? (_br.bottom() - in.y()) / dy :
+                     dy < 0. ? (_br.top() - in.y()) / dy : std::numeric_limits<qreal>::max();
+    if (tx < ty) {          // Exit through left or right side
+        const qreal y = in.y() + tx * dy;
+        if (y <= core.top() || y >= core.bottom())
+            return false;   // Exit in a corner square, use generic kernel
+        intersection = QPointF{dx > 0. ? _br.right() : _br.left(), y};
+        return true;
+    } else if (ty < tx) {   // Exit through top or bottom side
+        const qreal x = in.x() + ty * dx;
+        if (x <= core.left() || x >= core.right())
+            return false;
+        intersection = QPointF{x, dy > 0. ? _br.bottom() : _br.top()};
+        return true;
+    }
+    return false;           // Exactly in a corner
+}
+
+bool    ClipPolygon::intersect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept
+{
+    if (_edgeCount == 0)
+        return false;
+    if (_rect &&
+        intersectRect(p1, p2, intersection))
+        return true;
+    const int edge = segmentPolygonIntersection(static_cast<float>(p1.x()), static_cast<float>(p1.y()),
+                                                static_cast<float>(p2.x()), static_cast<float>(p2.y()),
+                                                _xs.data(), _ys.data(), _edgeCount);
+    if (edge < 0)
+        return false;
+    // Kernel is float, generate final intersection point in double precision
+    QPointF point;
+    if (QLineF{p1, p2}.intersects(QLineF{_polygon[edge], _polygon[edge + 1]}, &point) == QLineF::NoIntersection)
+        return false;
+    intersection = point;
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* CurvePolyline *///-----------------------------------------------------------
+void    CurvePolyline::reset(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                             qreal flatness)
+{
+    _p1 = p1; _c1 = c1; _c2 = c2; _p2 = p2;
+    _flatness = std::max(0.001, flatness);
+    _points.clear();
+    _ts.clear();
+    _points.push_back(p1);
+    _ts.push_back(0.);
+    flatten(p1, c1, c2, p2, 0., 1., 0);
+
+    qreal left = p1.x(), right = p1.x(), top = p1.y(), bottom = p1.y();
+    for (const auto& p : _points) {
+        left = std::min(left, p.x());   right = std::max(right, p.x());
+        top = std::min(top, p.y());     bottom = std::max(bottom, p.y());
+    }
+    _br = QRectF{left, top, right - left, bottom - top};
+}
+
+void    CurvePolyline::clear() noexcept
+{
+    _points.clear();
+    _ts.clear();
+    _br = QRectF{};
+}
+
+void    CurvePolyline::flatten(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                               qreal t1, qreal t2, int depth)
+{
+    // Flatness criterion (Roger Willcocks): curve is at most flatness away from its (p1, p2) chord when
+    // max(ux², vx²) + max(uy², vy²) <= 16 * flatness², with u = 3c1 - 2p1 - p2 and v = 3c2 - p1 - 2p2.
+    const QPointF u = c1 * 3. - p1 * 2. - p2;
+    const QPointF v = c2 * 3. - p1 - p2 * 2.;
+    const qreal criterion = std::max(u.x() * u.x(), v.x() * v.x()) + std::max(u.y() * u.y(), v.y() * v.y());
+    static constexpr int maxDepth = 16;
+    if (depth >= maxDepth ||
+        criterion <= 16. * _flatness * _flatness) {
+        _points.push_back(p2);
+        _ts.push_back(t2);
+        return;
+    }
+    // De Casteljau subdivision at t=0.5
+    const QPointF p12 = (p1 + c1) / 2.;
+    const QPointF c12 = (c1 + c2) / 2.;
+    const QPointF p22 = (c2 + p2) / 2.;
+    const QPointF l2 = (p12 + c12) / 2.;
+    const QPointF r1 = (c12 + p22) / 2.;
+    const QPointF m = (l2 + r1) / 2.;
+    const qreal tm = (t1 + t2) / 2.;
+    flatten(p1, p12, l2, m, t1, tm, depth + 1);
+    flatten(m, r1, p22, p2, tm, t2, depth + 1);
+}
+
+int     CurvePolyline::closestSegment(const QPointF& point, qreal& distance, qreal& t) const noexcept
+{
+    int segment = -1;
+    qreal bestD2 = std::numeric_limits<qreal>::max();
+    for (std::size_t s = 0; s + 1 < _points.size(); s++) {
+        const QPointF a = _points[s];
+        const QPointF ab = _points[s + 1] - a;
+        const QPointF ap = point - a;
+        const qreal length2 = ab.x() * ab.x() + ab.y() * ab.y();
+        qreal u = length2 > 0. ? (ap.x() * ab.x() + ap.y() * ab.y()) / length2 : 0.;
+        u = std::min(1., std::max(0., u));
+        const QPointF d = ap - ab * u;
+        const qreal d2 = d.x() * d.x() + d.y() * d.y();
+        if (d2 < bestD2) {
+            bestD2 = d2;
+            segment = static_cast<int>(s);
+            t = _ts[s] + u * (_ts[s + 1] - _ts[s]);
+        }
+    }
+    distance = std::sqrt(bestD2);
+    return segment;
+}
+
+qreal   CurvePolyline::refine(const QPointF& point, qreal t) const noexcept
+{
+    // Newton iterations on f(t) = (B(t) - P).B'(t), f'(t) = B'(t).B'(t) + (B(t) - P).B''(t)
+    const auto value = [this](qreal t) -> QPointF {
+        const qreal mt = 1. - t;
+        return _p1 * (mt * mt * mt) + _c1 * (3. * mt * mt * t) + _c2 * (3. * mt * t * t) + _p2 * (t * t * t);
+    };
+    const auto derivative = [this](qreal t) -> QPointF {
+        const qreal mt = 1. - t;
+        return (_c1 - _p1) * (3. * mt * mt) + (_c2 - _c1) * (6. * mt * t) + (_p2 - _c2) * (3. * t * t);
+    };
+    const auto secondDerivative = [this](qreal t) -> QPointF {
+        return (_c2 - _c1 * 2. + _p1) * (6. * (1. - t)) + (_p2 - _c2 * 2. + _c1) * (6. * t);
+    };
+    const auto dot = [](const QPointF& a, const QPointF& b) { return a.x() * b.x() + a.y() * b.y(); };
+
+    const QPointF initial = value(t) - point;
+    qreal best = dot(initial, initial);
+    for (int i = 0; i < 8; i++) {
+        const QPointF d = value(t) - point;
+        const QPointF d1 = derivative(t);
+        const qreal f = dot(d, d1);
+        const qreal df = dot(d1, d1) + dot(d, secondDerivative(t));
+        if (std::abs(df) < std::numeric_limits<qreal>::epsilon())
+            break;
+        const qreal next = std::min(1., std::max(0., t - f / df));
+        const QPointF nd = value(next) - point;
+        best = std::min(best, dot(nd, nd));
+        if (std::abs(next - t) < 1e-9)
+            break;
+        t = next;
+    }
+    return std::sqrt(best);
+}
+
+bool    CurvePolyline::contains(const QPointF& point, qreal tolerance) const noexcept
+{
+    if (_points.size() < 2)
+        return false;
+    const qreal margin = tolerance + _flatness;     // 1. Tight bounding rect culling
+    if (point.x() < _br.left() - margin || point.x() > _br.right() + margin ||
+        point.y() < _br.top() - margin || point.y() > _br.bottom() + margin)
+        return false;
+    qreal distance = 0., t = 0.;                    // 2. Polyline distance
+    if (closestSegment(point, distance, t) < 0)
+        return false;
+    if (distance <= tolerance - _flatness)          // Polyline is at most flatness away from the curve
+        return true;
+    if (distance > tolerance + _flatness)
+        return false;
+    return refine(point, t) <= tolerance;           // 3. Ambiguous, refine on the curve
+}
+
+qreal   CurvePolyline::distance(const QPointF& point) const noexcept
+{
+    qreal distance = 0., t = 0.;
+    if (closestSegment(point, distance, t) < 0)
+        return -1.;
+    return refine(point, t);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,180 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanIntersection.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QPointF>
+#include <QRectF>
+#include <QPolygonF>
+
+namespace qan { // ::qan
+
+/*! \brief Polygon bounding shape stored as a structure of arrays for fast segment intersection.
+ *
+ * Polygon vertices are stored in two padded float arrays (\c xs and \c ys) that are processed
+ * 4 or 8 edges at a time by segmentPolygonIntersection(). Like qan::EdgeItem::getLineIntersection(),
+ * only edges between consecutive vertices are considered (polygon is not implicitly closed).
+ *
+ * Rectangular and rounded rectangular shapes (such as qan::NodeItem::generateDefaultBoundingShape()
+ * rounded rectangles) are detected in reset(): intersection of a segment starting from the shape
+ * "core" then use a constant time fast path.
+ */
+class ClipPolygon
+{
+public:
+    ClipPolygon() = default;
+    explicit ClipPolygon(const QPolygonF& polygon) { reset(polygon); }
+    ~ClipPolygon() = default;
+    ClipPolygon(const ClipPolygon&) = default;
+    ClipPolygon& operator=(const ClipPolygon&) = default;
+    ClipPolygon(ClipPolygon&&) = default;
+    ClipPolygon& operator=(ClipPolygon&&) = default;
+
+public:
+    //! Initialize this clip polygon from \c polygon vertices.
+    void            reset(const QPolygonF& polygon);
+
+    //! Return polygon edges count (ie vertices count - 1, or 0 for an empty polygon).
+    inline int      getEdgeCount() const noexcept { return _edgeCount; }
+
+    //! Return true if polygon has been detected as an (eventually rounded) axis aligned rectangle.
+    inline bool     isRect() const noexcept { return _rect; }
+
+    /*! \brief Intersect segment [\c p1, \c p2] with this polygon.
+     *
+     * Same semantic than qan::EdgeItem::getLineIntersection(): \c intersection is set to the intersection
+     * with the first polygon edge (in polygon order) that intersect [\c p1, \c p2].
+     *
+     * \return true if an intersection has been found, false otherwise (\c intersection is then unmodified).
+     */
+    bool            intersect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept;
+
+private:
+    //! Rounded rectangle fast path, return false if the result must be computed with the generic kernel.
+    bool            intersectRect(const QPointF& p1, const QPointF& p2, QPointF& intersection) const noexcept;
+
+    std::vector<float>  _xs;
+    std::vector<float>  _ys;
+    QPolygonF           _polygon;       // Original double precision vertices, used to compute final intersection point
+    int                 _edgeCount = 0;
+
+    bool                _rect = false;
+    QRectF              _br;
+    qreal               _cornerSize = 0.;   // Rounded corners maximum extent (0. for a regular rectangle)
+};
+
+/*! \brief Cubic bezier curve flattened to a polyline, with a tight bounding rect, for fast and exact hit testing.
+ *
+ * Curve is flattened with an adaptive subdivision: polyline is at most \c flatness away from the curve. Hit
+ * testing then reject points outside of polyline bounding rect, and compute point distance to the polyline: only
+ * points whose polyline distance is ambiguous (within \c flatness of \c tolerance) are refined with a
+ * Newton nearest point solver on the curve itself.
+ */
+class CurvePolyline
+{
+public:
+    CurvePolyline() = default;
+    ~CurvePolyline() = default;
+    CurvePolyline(const CurvePolyline&) = default;
+    CurvePolyline& operator=(const CurvePolyline&) = default;
+
+public:
+    //! Flatten cubic curve from \c p1 to \c p2 with control points \c c1 and \c c2.
+    void            reset(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                          qreal flatness = 0.25);
+    //! Clear polyline (contains() then always return false).
+    void            clear() noexcept;
+
+    //! Flattened curve points (first point is curve start, last point is curve end).
+    inline const std::vector<QPointF>&  getPoints() const noexcept { return _points; }
+    //! Polyline bounding rect (curve tight bounding rect is included in this rect inflated by flatness).
+    inline const QRectF&    getBoundingRect() const noexcept { return _br; }
+
+    //! Return true if \c point distance to the curve is less or equal to \c tolerance.
+    bool            contains(const QPointF& point, qreal tolerance) const noexcept;
+    //! Return \c point distance to the curve (or a negative value if polyline is empty).
+    qreal           distance(const QPointF& point) const noexcept;
+
+private:
+    void            flatten(const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2,
+                            qreal t1, qreal t2, int depth);
+    //! Return closest polyline segment index for \c point and set \c distance and \c t (curve parameter).
+    int             closestSegment(const QPointF& point, qreal& distance, qreal& t) const noexcept;
+    //! Refine nearest point curve parameter from an initial \c t guess, return distance.
+    qreal           refine(const QPointF& point, qreal t) const noexcept;
+
+    QPointF             _p1, _c1, _c2, _p2;
+    qreal               _flatness = 0.25;
+    std::vector<QPointF> _points;
+    std::vector<qreal>  _ts;            // Curve parameter of each polyline point
+    QRectF              _br;
+};
+
+/*! \brief Return the index of the first edge of SoA polygon (\c xs, \c ys) intersecting segment [p1, p2], -1 if there is none.
+ *
+ * \c xs and \c ys must contain at least \c edgeCount + 1 vertices and must be readable up to
+ * \c edgeCount rounded up to 8 plus one vertex (ClipPolygon pad its vertices with its last vertex, generating
+ * degenerated edges that never intersect).
+ *
+ * Kernel is selected at runtime: AVX2 (8 edges per iteration), SSE2 (4 edges per iteration) or
+ * a portable scalar fallback.
+ */
+int             segmentPolygonIntersection(float p1x, float p1y, float p2x, float p2y,
+                                           const float* xs, const float* ys, int edgeCount) noexcept;
+
+//! Scalar implementation of segmentPolygonIntersection() (reference implementation, always available).
+int             segmentPolygonIntersectionScalar(float p1x, float p1y, float p2x, float p2y,
+                                                 const float* xs, const float* ys, int edgeCount) noexcept;
+
+//! Return the name of the kernel used by segmentPolygonIntersection() on this CPU ("avx2", "sse2" or "scalar").
+const char*     segmentPolygonIntersectionKernel() noexcept;
+
+//! Segment/polygon intersection kernel with segmentPolygonIntersection() signature.
+struct SegmentPolygonIntersectionKernel {
+    using Function = int (*)(float, float, float, float, const float*, const float*, int);
+    Function        function = &segmentPolygonIntersectionScalar;
+    const char*     name = "scalar";
+};
+
+/*! \brief Return all kernels compiled in and supported by this CPU.
+ *
+ * Scalar kernel is always first, the last kernel is the one used by segmentPolygonIntersection().
+ */
+const std::vector<SegmentPolygonIntersectionKernel>&    segmentPolygonIntersectionKernels() noexcept;
+
+} // ::qan
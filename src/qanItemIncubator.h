@@ -0,0 +1,92 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanItemIncubator.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QPointer>
+#include <QQmlIncubator>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+class Style;
+
+/*! \brief Asynchronously create a node or edge delegate item for qan::Graph (see qan::Graph::asynchronous).
+ *
+ * Item is configured with its node or edge, graph and style before its bindings are evaluated, it is then
+ * installed in graph by qan::Graph once incubation is ready. Node, edge and style might be destroyed
+ * during incubation: incubated item is then discarded.
+ *
+ * \warning Incubators are owned by qan::Graph, they must not be used directly.
+ */
+class ItemIncubator : public QQmlIncubator
+{
+    /*! \name ItemIncubator Object Management *///-----------------------------
+    //@{
+public:
+    explicit ItemIncubator(qan::Graph& graph, qan::Style& style,
+                           qan::Node* node, qan::Edge* edge);
+    virtual ~ItemIncubator() override;
+    ItemIncubator(const ItemIncubator&) = delete;
+
+public:
+    //! Incubated item node, nullptr for an edge item or if node has been destroyed.
+    qan::Node*      getNode() const noexcept;
+    //! Incubated item edge, nullptr for a node item or if edge has been destroyed.
+    qan::Edge*      getEdge() const noexcept;
+    qan::Style*     getStyle() const noexcept;
+
+    //! True once incubated item has been installed in graph (or discarded), see qan::Graph::installIncubatedItem().
+    inline bool     isInstalled() const noexcept { return _installed; }
+    inline void     setInstalled() noexcept { _installed = true; }
+
+protected:
+    virtual void    setInitialState(QObject* object) override;
+    virtual void    statusChanged(QQmlIncubator::Status status) override;
+
+private:
+    QPointer<qan::Graph>    _graph;
+    QPointer<qan::Style>    _style;
+    QPointer<qan::Node>     _node;
+    QPointer<qan::Edge>     _edge;
+    bool                    _installed = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
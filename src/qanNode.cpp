@@ -82,13 +82,73 @@ const qan::NodeItem*    Node::getItem() const noexcept { return _item.data(); }
 void    Node::setItem(qan::NodeItem* nodeItem) noexcept
 {
     if (nodeItem != nullptr) {
+        const bool itemModified = nodeItem != _item;
         _item = nodeItem;
         if (nodeItem->getNode() != this)
             nodeItem->setNode(this);
+        if (itemModified)
+            emit itemChanged();
     }
 }
 //-----------------------------------------------------------------------------
 
+/* Node Virtualization *///----------------------------------------------------
+QRectF  Node::getItemGeometry() const noexcept
+{
+    return _item ? QRectF{_item->x(), _item->y(), _item->width(), _item->height()} :
+                   _itemGeometry;
+}
+
+void    Node::setItemGeometry(const QRectF& itemGeometry) noexcept
+{
+    if (_item) {
+        _item->setPosition(itemGeometry.topLeft());
+        _item->setSize(itemGeometry.size());
+    } else {
+        _itemGeometry = itemGeometry;
+        auto graph = getGraph();
+        if (graph != nullptr)   // Node might now be in view
+            graph->scheduleVirtualizationUpdate(*this);
+    }
+}
+
+void    Node::setItemDelegate(QQmlComponent* component, qan::NodeStyle* style) noexcept
+{
+    _itemComponent = component;
+    _itemStyle = style;
+}
+
+void    Node::releaseItem() noexcept
+{
+    const auto item = detachItem();
+    if (item != nullptr) {
+        item->setVisible(false);
+        item->setParentItem(nullptr);
+        item->deleteLater();
+    }
+}
+
+qan::NodeItem*  Node::detachItem() noexcept
+{
+    if (!_item)
+        return nullptr;
+    _itemGeometry = getItemGeometry();
+    _itemZ = _item->z();
+    _itemZStored = true;
+    const auto item = _item.data();
+    _item = nullptr;
+    emit itemChanged();
+    return item;
+}
+
+bool    Node::getStoredItemZ(qreal& z) const noexcept
+{
+    if (_itemZStored)
+        z = _itemZ;
+    return _itemZStored;
+}
+//-----------------------------------------------------------------------------
+
 /* Node Static Factories *///--------------------------------------------------
 QQmlComponent*  Node::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
@@ -38,6 +38,7 @@
 #include <QQuickItem>
 #include <QPointF>
 #include <QPolygonF>
+#include <QQmlComponent>
 
 // QuickQanava headers
 #include "./gtpo/node.h"
@@ -93,12 +94,48 @@ public:
     bool    operator==(const qan::Node& right) const;
 
 public:
-    Q_PROPERTY(qan::NodeItem* item READ getItem CONSTANT)
+    //! Node visual item, might be nullptr for non visual nodes or nodes virtualized out of view (see qan::Graph::virtualized).
+    Q_PROPERTY(qan::NodeItem* item READ getItem NOTIFY itemChanged)
     qan::NodeItem*          getItem() noexcept;
     const qan::NodeItem*    getItem() const noexcept;
     virtual void            setItem(qan::NodeItem* nodeItem) noexcept;
 protected:
     QPointer<qan::NodeItem> _item;
+signals:
+    void                    itemChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Node Virtualization *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Node item geometry (position and size in item parent CS).
+     *
+     * Return node item geometry, or node stored geometry when node has no item (for example
+     * when node has been virtualized out of view, see qan::Graph::virtualized). Setting geometry
+     * on a node without item store it until node item is created.
+     */
+    Q_INVOKABLE QRectF      getItemGeometry() const noexcept;
+    //! \copydoc getItemGeometry()
+    Q_INVOKABLE void        setItemGeometry(const QRectF& itemGeometry) noexcept;
+
+    //! Delegate component and style used to create node item (set by qan::Graph, used to create item again once released).
+    void                    setItemDelegate(QQmlComponent* component, qan::NodeStyle* style) noexcept;
+    inline QQmlComponent*   getItemComponent() const noexcept { return _itemComponent.data(); }
+    inline qan::NodeStyle*  getItemStyle() const noexcept { return _itemStyle.data(); }
+
+    //! Store item geometry and destroy node item (used by qan::Graph to virtualize node out of view).
+    void                    releaseItem() noexcept;
+    //! Store item geometry and z and return node item without destroying it, node no longer reference item (used by qan::Graph to pool items).
+    qan::NodeItem*          detachItem() noexcept;
+    //! Item z stored when node item has been released (restored by qan::Graph when item is created again), false if item has never been released.
+    bool                    getStoredItemZ(qreal& z) const noexcept;
+private:
+    QRectF                  _itemGeometry;
+    qreal                   _itemZ = 0.;
+    bool                    _itemZStored = false;
+    QPointer<QQmlComponent> _itemComponent;
+    QPointer<qan::NodeStyle> _itemStyle;
     //@}
     //-------------------------------------------------------------------------
 
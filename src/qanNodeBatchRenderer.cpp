@@ -0,0 +1,305 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+// Qt headers
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// QuickQanava headers
+#include "./qanNodeBatchRenderer.h"
+#include "./qanNodeItem.h"
+#include "./qanGroup.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* NodeBatchRenderer Object Management *///------------------------------------
+NodeBatchRenderer::NodeBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+NodeBatchRenderer::~NodeBatchRenderer()
+{
+    clear();
+}
+
+void    NodeBatchRenderer::setGraph(qan::Graph* graph)
+{
+    if (graph == _graph)
+        return;
+    if (_graph)
+        disconnect(_graph, nullptr, this, nullptr);
+    clear();
+    _graph = graph;
+    if (_graph) {
+        connect(_graph, &qan::Graph::levelOfDetailChanged,  this, &NodeBatchRenderer::onLevelOfDetailChanged);
+        connect(_graph, &qan::Graph::nodeInserted,          this, &NodeBatchRenderer::onNodeInserted);
+        connect(_graph, &qan::Graph::nodesInserted,         this, &NodeBatchRenderer::onNodesInserted);
+        connect(_graph, &qan::Graph::nodeRemoved,           this, &NodeBatchRenderer::onNodeRemoved);
+        connect(_graph, &qan::Graph::nodeItemRealized,      this, &NodeBatchRenderer::onNodeInserted);  // Virtualized and incubated nodes
+        onLevelOfDetailChanged();
+    }
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Batched Nodes Management *///-----------------------------------------------
+void    NodeBatchRenderer::addNodeItem(qan::NodeItem* nodeItem)
+{
+    if (nodeItem == nullptr ||
+        _nodeItems.find(nodeItem) != _nodeItems.end())
+        return;
+    _nodeItems.emplace(nodeItem, nodeItem);
+
+    connect(nodeItem, &QObject::destroyed,
+            this,     &NodeBatchRenderer::onNodeItemDestroyed);
+    for (const auto signal : {&QQuickItem::xChanged, &QQuickItem::yChanged,
+                              &QQuickItem::widthChanged, &QQuickItem::heightChanged,
+                              &QQuickItem::visibleChanged})     // Note: visibleChanged is emitted for effective visibility changes
+        connect(nodeItem, signal, this, &NodeBatchRenderer::setDirty);
+    const auto connectStyle = [this, nodeItem]() {
+        const auto style = nodeItem->getStyle();
+        if (style != nullptr &&
+            _styles.insert(style).second) {
+            connect(style, &qan::NodeStyle::backColorChanged,   this, &NodeBatchRenderer::setDirty);
+            connect(style, &qan::NodeStyle::backOpacityChanged, this, &NodeBatchRenderer::setDirty);
+            connect(style, &qan::NodeStyle::borderColorChanged, this, &NodeBatchRenderer::setDirty);
+            connect(style, &qan::NodeStyle::borderWidthChanged, this, &NodeBatchRenderer::setDirty);
+        }
+        setDirty();
+    };
+    connect(nodeItem, &qan::NodeItem::styleChanged, this, connectStyle);
+    connect(nodeItem, &qan::NodeItem::pooled,       this, [this, nodeItem]() { removeNodeItem(nodeItem); });
+    connectStyle();
+    nodeItem->setBatchRenderer(this);
+    emit nodeCountChanged();
+}
+
+void    NodeBatchRenderer::removeNodeItem(qan::NodeItem* nodeItem)
+{
+    if (nodeItem == nullptr)
+        return;
+    const auto batched = _nodeItems.find(nodeItem);
+    if (batched == _nodeItems.end())
+        return;
+    disconnect(nodeItem, nullptr, this, nullptr);
+    nodeItem->setBatchRenderer(nullptr);
+    onNodeItemDestroyed(nodeItem);
+}
+
+void    NodeBatchRenderer::onNodeItemDestroyed(QObject* nodeItem)
+{
+    // Note: nodeItem is not dereferenced, it might be partially destroyed.
+    if (_nodeItems.erase(nodeItem) == 0)
+        return;
+    setDirty();
+    emit nodeCountChanged();
+}
+
+void    NodeBatchRenderer::onLevelOfDetailChanged()
+{
+    // Nodes are batched only at flat level of detail, full delegates are restored otherwise.
+    const bool flat = _graph &&
+                      _graph->getLevelOfDetail() == qan::NodeItem::LevelOfDetail::Flat;
+    if (!flat)
+        clear();
+    else {
+        for (const auto node : _graph->get_nodes())
+            onNodeInserted(node);
+    }
+    setDirty();
+}
+
+void    NodeBatchRenderer::onNodeInserted(qan::Node* node)
+{
+    if (node != nullptr &&
+        _graph &&
+        _graph->getLevelOfDetail() == qan::NodeItem::LevelOfDetail::Flat)
+        addNodeItem(node->getItem());
+}
+
+void    NodeBatchRenderer::onNodesInserted(QList<qan::Node*> nodes)
+{
+    for (const auto node : nodes)
+        onNodeInserted(node);
+}
+
+void    NodeBatchRenderer::onNodeRemoved(qan::Node* node)
+{
+    if (node != nullptr)
+        removeNodeItem(node->getItem());
+}
+
+void    NodeBatchRenderer::clear()
+{
+    const bool empty = _nodeItems.empty();
+    for (const auto& nodeItem : _nodeItems) {
+        if (nodeItem.second) {
+            disconnect(nodeItem.second.data(), nullptr, this, nullptr);
+            nodeItem.second->setBatchRenderer(nullptr);
+        }
+    }
+    for (const auto style : _styles)
+        disconnect(style, nullptr, this, nullptr);
+    _styles.clear();
+    _nodeItems.clear();
+    if (!empty)
+        emit nodeCountChanged();
+}
+
+void    NodeBatchRenderer::setDirty()
+{
+    if (_dirty)
+        return;
+    _dirty = true;
+    polish();   // Vertices are generated once per frame in updatePolish()
+}
+
+void    NodeBatchRenderer::generateVertices()
+{
+    _vertices.clear();
+
+    // Groups are drawn first (outer groups first), then nodes
+    std::vector<std::pair<int, const qan::NodeItem*>> nodeItems;
+    nodeItems.reserve(_nodeItems.size());
+    for (const auto& batched : _nodeItems) {
+        const auto nodeItem = batched.second.data();
+        if (nodeItem == nullptr ||
+            !nodeItem->isVisible())
+            continue;
+        const auto node = nodeItem->getNode();
+        int order = std::numeric_limits<int>::max();
+        if (node != nullptr &&
+            node->isGroup()) {
+            order = 0;
+            for (auto group = node->getGroup(); group != nullptr; group = group->getGroup())
+                ++order;
+        }
+        nodeItems.emplace_back(order, nodeItem);
+    }
+    std::stable_sort(nodeItems.begin(), nodeItems.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    const auto rectangle = [this](const QRectF& r, const QColor& color) {
+        if (r.isEmpty() ||
+            color.alpha() == 0)
+            return;
+        // Note: QSGVertexColorMaterial expect premultiplied colors
+        const int alpha = color.alpha();
+        const auto red = static_cast<uchar>(color.red() * alpha / 255);
+        const auto green = static_cast<uchar>(color.green() * alpha / 255);
+        const auto blue = static_cast<uchar>(color.blue() * alpha / 255);
+        const auto a = static_cast<uchar>(alpha);
+        const auto vertex = [this, red, green, blue, a](qreal x, qreal y) {
+            Vertex v;
+            v.set(static_cast<float>(x), static_cast<float>(y), red, green, blue, a);
+            _vertices.push_back(v);
+        };
+        vertex(r.left(), r.top());
+        vertex(r.right(), r.top());
+        vertex(r.left(), r.bottom());
+        vertex(r.left(), r.bottom());
+        vertex(r.right(), r.top());
+        vertex(r.right(), r.bottom());
+    };
+    for (const auto& nodeItem : nodeItems) {
+        const auto item = nodeItem.second;
+        const auto style = item->getStyle();
+        QColor backColor = style != nullptr ? style->getBackColor() : QColor{Qt::white};
+        if (style != nullptr)
+            backColor.setAlphaF(backColor.alphaF() * qBound(0., style->getBackOpacity(), 1.));
+        const QColor borderColor = style != nullptr ? style->getBorderColor() : QColor{Qt::black};
+        const qreal borderWidth = style != nullptr ? style->getBorderWidth() : 1.;
+
+        const QRectF r = item->mapRectToItem(this, QRectF{0., 0., item->width(), item->height()});
+        rectangle(r, backColor);
+        if (borderWidth > 0.) {
+            const qreal w = std::min({borderWidth, r.width() / 2., r.height() / 2.});
+            rectangle(QRectF{r.left(), r.top(), r.width(), w}, borderColor);
+            rectangle(QRectF{r.left(), r.bottom() - w, r.width(), w}, borderColor);
+            rectangle(QRectF{r.left(), r.top() + w, w, r.height() - 2. * w}, borderColor);
+            rectangle(QRectF{r.right() - w, r.top() + w, w, r.height() - 2. * w}, borderColor);
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Management *///-------------------------------------------------
+void    NodeBatchRenderer::updatePolish()
+{
+    QQuickItem::updatePolish();
+    if (!_dirty)
+        return;
+    _dirty = false;
+    generateVertices();
+    update();
+}
+
+QSGNode*    NodeBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_vertices.empty()) {
+        delete node;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::StaticPattern);     // Modified only when nodes are modified
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+    auto geometry = node->geometry();
+    if (geometry->vertexCount() != static_cast<int>(_vertices.size()))
+        geometry->allocate(static_cast<int>(_vertices.size()));
+    std::copy(_vertices.cbegin(), _vertices.cend(), geometry->vertexDataAsColoredPoint2D());
+    geometry->markVertexDataDirty();
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,155 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// Qt headers
+#include <QtQml>
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class NodeItem;
+class NodeStyle;
+
+/*! \brief Draw graph nodes and groups as flat rectangles from a single scene graph geometry node at low zoom.
+ *
+ * When graph \c levelOfDetail is qan::NodeItem::LevelOfDetail::Flat (see qan::GraphView::lodFlatZoom), all
+ * visible nodes and groups items are drawn as flat rectangles filled with their style \c backColor and
+ * bordered with \c borderColor. Batched node items \c batched property is then true: default node and group
+ * delegates unload their background, effects, labels and docks. Full delegates are restored when zooming back in.
+ *
+ * Vertices are regenerated once per frame when a batched item geometry, visibility or style change (flat level
+ * is used for zoomed out overviews, where nodes are rarely modified).
+ *
+ * \code
+ *  Qan.GraphView {
+ *    graph: Qan.Graph { id: graph }
+ *  }
+ *  Qan.NodeBatchRenderer {
+ *    parent: graph.containerItem
+ *    graph: graph
+ *  }
+ * \endcode
+ *
+ * \note Renderer must be a child of graph \c containerItem (it is drawn in graph CS), groups are drawn
+ * before nodes, node \c backRadius and gradient fill are not supported.
+ *
+ * \nosubgrouping
+ */
+class NodeBatchRenderer : public QQuickItem
+{
+    /*! \name NodeBatchRenderer Object Management *///-------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit NodeBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~NodeBatchRenderer() override;
+    NodeBatchRenderer(const NodeBatchRenderer&) = delete;
+
+public:
+    //! Graph whose nodes and groups are drawn by this renderer at flat level of detail.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    void                setGraph(qan::Graph* graph);
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Nodes Management *///------------------------------------
+    //@{
+public:
+    //! Draw \c nodeItem with this renderer (automatically called for \c graph nodes at flat level of detail).
+    void            addNodeItem(qan::NodeItem* nodeItem);
+    //! Stop drawing \c nodeItem with this renderer.
+    void            removeNodeItem(qan::NodeItem* nodeItem);
+
+    //! Number of nodes and groups items actually batched in this renderer.
+    Q_PROPERTY(int nodeCount READ getNodeCount NOTIFY nodeCountChanged FINAL)
+    inline int      getNodeCount() const noexcept { return static_cast<int>(_nodeItems.size()); }
+signals:
+    void            nodeCountChanged();
+
+private:
+    void            onLevelOfDetailChanged();
+    void            onNodeInserted(qan::Node* node);
+    void            onNodesInserted(QList<qan::Node*> nodes);
+    void            onNodeRemoved(qan::Node* node);
+    void            onNodeItemDestroyed(QObject* nodeItem);
+    void            clear();
+    //! Schedule vertices generation in updatePolish().
+    void            setDirty();
+
+private:
+    using Vertex = QSGGeometry::ColoredPoint2D;
+
+    //! Batched items (key is not dereferenced, items might be partially destroyed).
+    std::unordered_map<const QObject*, QPointer<qan::NodeItem>>  _nodeItems;
+    //! Node styles already connected to setDirty().
+    std::unordered_set<const qan::NodeStyle*>   _styles;
+
+    //! Generate all batched items rectangles in _vertices (groups first, then nodes).
+    void            generateVertices();
+
+    std::vector<Vertex>     _vertices;
+    bool                    _dirty = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Management *///--------------------------------------
+    //@{
+protected:
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::NodeBatchRenderer);
@@ -45,6 +45,7 @@
 #include "./qanNodeItem.h"
 #include "./qanGraph.h"
 #include "./qanDraggableCtrl.h"
+#include "./qanNodeBatchRenderer.h"
 
 namespace qan { // ::qan
 
@@ -68,10 +69,15 @@ NodeItem::NodeItem(QQuickItem* parent) :
             this,   &qan::NodeItem::onWidthChanged);
     connect(this,   &qan::NodeItem::heightChanged,
             this,   &qan::NodeItem::onHeightChanged);
+    _globalZConnection = connect(this,   &qan::NodeItem::zChanged,
+                                 this,   &qan::NodeItem::invalidateGlobalZ);
 }
 
 NodeItem::~NodeItem()
 {
+    // Note: ~QQuickItem() might modify item z or parent, NodeItem is then already destroyed
+    QObject::disconnect(_globalZConnection);
+
     // Delete all dock items
     for (auto& dockItem : _dockItems) {
         if (dockItem)
@@ -88,6 +94,58 @@ NodeItem::~NodeItem()
 qan::AbstractDraggableCtrl& NodeItem::draggableCtrl() { Q_ASSERT(_draggableCtrl!=nullptr); return *_draggableCtrl; }
 //-----------------------------------------------------------------------------
 
+/* Global Z Management *///----------------------------------------------------
+qreal   NodeItem::getGlobalZ() const noexcept
+{
+    if (_globalZValid)
+        return _globalZ;
+    // Sum parent items z up to the first node item ancestor, then use its (cached) global z
+    qreal globalZ = z();
+    for (auto parent = parentItem(); parent != nullptr; parent = parent->parentItem()) {
+        const auto parentNodeItem = qobject_cast<const qan::NodeItem*>(parent);
+        if (parentNodeItem != nullptr) {
+            globalZ += parentNodeItem->getGlobalZ();
+            break;
+        }
+        globalZ += parent->z();
+    }
+    _globalZ = globalZ;
+    _globalZValid = true;
+    return _globalZ;
+}
+
+void    NodeItem::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData& data)
+{
+    if (change == QQuickItem::ItemParentHasChanged)
+        invalidateGlobalZ();
+    QQuickItem::itemChange(change, data);
+}
+
+void    NodeItem::invalidateGlobalZ() noexcept
+{
+    if (!_globalZValid)     // Sub tree node items are necessarily already invalid (see _globalZValid)
+        return;
+    _globalZValid = false;
+
+    // Propagate to node items in this item sub tree (stopping at first node item level, they
+    // propagate to their own sub tree).
+    std::vector<QQuickItem*> items;
+    const auto children = childItems();
+    items.insert(items.end(), children.cbegin(), children.cend());
+    while (!items.empty()) {
+        auto item = items.back();
+        items.pop_back();
+        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        if (nodeItem != nullptr)
+            nodeItem->invalidateGlobalZ();
+        else if (item != nullptr) {
+            const auto itemChildren = item->childItems();
+            items.insert(items.end(), itemChildren.cbegin(), itemChildren.cend());
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
 /* Topology Management *///----------------------------------------------------
 auto    NodeItem::getNode() noexcept -> qan::Node* { return _node.data(); }
 auto    NodeItem::getNode() const noexcept -> const qan::Node* { return _node.data(); }
@@ -96,9 +154,28 @@ auto    NodeItem::setNode(qan::Node* node) noexcept -> void {
         _node = node;
         const auto nodeDraggableCtrl = static_cast<DraggableCtrl*>(_draggableCtrl.get());
         nodeDraggableCtrl->setTarget(node);
+        emit nodeChanged();
     }
 }
 
+void    NodeItem::saveDelegateState() noexcept
+{
+    if (_delegateState)
+        return;
+    _delegateState = DelegateState{getDraggable(), getResizable(),
+                                   getSelectable(), getMinimumSize()};
+}
+
+void    NodeItem::restoreDelegateState() noexcept
+{
+    if (!_delegateState)
+        return;
+    setDraggable(_delegateState->draggable);
+    setResizable(_delegateState->resizable);
+    setSelectable(_delegateState->selectable);
+    setMinimumSize(_delegateState->minimumSize);
+}
+
 auto    NodeItem::setGraph(qan::Graph* graph) -> void
 {
     _graph = graph;
@@ -212,9 +289,9 @@ void    NodeItem::collapseChilds(bool collapsed)
 //-----------------------------------------------------------------------------
 
 /* Selection Management *///---------------------------------------------------
-void    NodeItem::onWidthChanged() { configureSelectionItem(); }
+void    NodeItem::onWidthChanged() { _clipPolygon.reset(); configureSelectionItem(); }
 
-void    NodeItem::onHeightChanged() { configureSelectionItem(); }
+void    NodeItem::onHeightChanged() { _clipPolygon.reset(); configureSelectionItem(); }
 //-----------------------------------------------------------------------------
 
 /* Node Configuration *///-----------------------------------------------------
@@ -394,6 +471,24 @@ void    NodeItem::styleDestroyed(QObject* style)
 }
 //-----------------------------------------------------------------------------
 
+/* Level of Detail Management *///---------------------------------------------
+void    NodeItem::setLevelOfDetail(LevelOfDetail levelOfDetail) noexcept
+{
+    if (levelOfDetail != _levelOfDetail) {
+        _levelOfDetail = levelOfDetail;
+        emit levelOfDetailChanged();
+    }
+}
+
+void    NodeItem::setBatchRenderer(qan::NodeBatchRenderer* batchRenderer) noexcept
+{
+    if (batchRenderer != _batchRenderer) {
+        _batchRenderer = batchRenderer;
+        emit batchedChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
 
 /* Intersection Shape Management *///------------------------------------------
 QPolygonF   NodeItem::getBoundingShape()
@@ -406,9 +501,18 @@ QPolygonF   NodeItem::getBoundingShape()
 void    NodeItem::setBoundingShape(const QPolygonF& boundingShape)
 {
     _boundingShape = boundingShape;
+    _clipPolygon.reset();
     emit boundingShapeChanged();
 }
 
+std::shared_ptr<const qan::ClipPolygon> NodeItem::getClipPolygon()
+{
+    // Note: A new polygon is allocated on invalidation, edges geometry caches might still share the previous one
+    if (!_clipPolygon)
+        _clipPolygon = std::make_shared<const qan::ClipPolygon>(getBoundingShape());
+    return _clipPolygon;
+}
+
 void    NodeItem::setDefaultBoundingShape()
 {
     setBoundingShape(generateDefaultBoundingShape());
@@ -430,6 +534,7 @@ void    NodeItem::setBoundingShape(QVariantList boundingShape)
     for (const auto& vp : boundingShape)
         shape[p++] = vp.toPointF();
     _boundingShape = (!shape.isEmpty( ) ? shape : generateDefaultBoundingShape());
+    _clipPolygon.reset();
     emit boundingShapeChanged();
 }
 
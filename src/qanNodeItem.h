@@ -37,6 +37,8 @@
 // Std headers
 #include <cstddef>  // std::size_t
 #include <array>
+#include <memory>
+#include <optional>
 
 // Qt headers
 #include <QQuickItem>
@@ -47,6 +49,7 @@
 
 // QuickQanava headers
 #include "./qanStyle.h"
+#include "./qanIntersection.h"
 #include "./qanNode.h"
 #include "./qanSelectable.h"
 #include "./qanDraggable.h"
@@ -56,6 +59,7 @@ namespace qan { // ::qan
 
 class Node;
 class Graph;
+class NodeBatchRenderer;
 
 /*! \brief Base class for modelling nodes with attributes and an in/out edges list in a qan::Graph graph.
  *
@@ -97,16 +101,72 @@ public:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Global Z Management *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Return item global z, ie the sum of this item z and all its parent items z.
+     *
+     * Global z is cached: it is computed only for the first call following a z or parent change
+     * of this item or of one of its node items ancestors (usually parent groups). Same result than
+     * qan::getItemGlobalZ_rec(), without walking the whole parent chain on every call.
+     */
+    qreal           getGlobalZ() const noexcept;
+
+    /*! \brief Invalidate this item global z cache, and all node items (group content, ports) global z in this item sub tree.
+     *
+     * \note Automatically called on z or parent change, call manually if the z of a non node item in
+     * this item parent chain is modified.
+     */
+    void            invalidateGlobalZ() noexcept;
+protected:
+    //! Invalidate global z on parent change (virtual dispatch is safe during ~QQuickItem(), unlike a parentChanged() connection).
+    virtual void    itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData& data) override;
+private:
+    //! Connection of zChanged() to invalidateGlobalZ(), disconnected in ~NodeItem().
+    QMetaObject::Connection _globalZConnection;
+    mutable qreal   _globalZ = 0.;
+    //! Invariant: if global z is valid for an item, it is valid for all its node items ancestors.
+    mutable bool    _globalZValid = false;
+    //@}
+    //-------------------------------------------------------------------------
+
 
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY(qan::Node* node READ getNode CONSTANT FINAL)
+    Q_PROPERTY(qan::Node* node READ getNode NOTIFY nodeChanged FINAL)
     auto        getNode() noexcept -> qan::Node*;
     auto        getNode() const noexcept -> const qan::Node*;
     auto        setNode(qan::Node* node) noexcept -> void;
 private:
     QPointer<qan::Node> _node{nullptr};
+signals:
+    //! Emitted when item is bound to another node (see qan::Graph::reuseItems).
+    void        nodeChanged();
+    /*! \brief Emitted when item is stored in its graph items pool, item is hidden and no longer bound to a node (see qan::Graph::reuseItems).
+     *
+     * Delegates with an internal state (for example a running animation) should reset it here.
+     */
+    void        pooled();
+    //! Emitted when a pooled item is bound to a new node, just before it is shown again.
+    void        reused();
+
+public:
+    /*! \brief Save item \c draggable, \c resizable, \c selectable and \c minimumSize as set by its delegate (see qan::Graph::reuseItems).
+     *
+     * Only the first call save state, it is made by qan::Graph when the item is initialized for the first time.
+     */
+    void        saveDelegateState() noexcept;
+    //! Restore the state saved by saveDelegateState(), no-op if no state has been saved.
+    void        restoreDelegateState() noexcept;
+private:
+    struct DelegateState {
+        bool    draggable = true;
+        bool    resizable = true;
+        bool    selectable = true;
+        QSizeF  minimumSize{100., 45.};
+    };
+    std::optional<DelegateState>    _delegateState;
 
 public:
     //! Secure shortcut to getNode().getGraph().
@@ -343,6 +403,50 @@ private slots:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Level of Detail Management *///----------------------------------
+    //@{
+public:
+    //! Node item rendering fidelity, usually set from view zoom (see qan::GraphView::lodSimplifiedZoom).
+    enum class LevelOfDetail : unsigned int {
+        //! Full delegate content with effects, labels, docks and ports.
+        Full        = 0,
+        //! Background only: no effects, labels, docks and ports.
+        Simplified  = 1,
+        //! Flat rectangle, drawn by a qan::NodeBatchRenderer when one is attached to graph (Simplified otherwise).
+        Flat        = 2
+    };
+    Q_ENUM(LevelOfDetail)
+
+    /*! \brief Current node item level of detail, default to Full (set by qan::Graph for all nodes and groups items).
+     *
+     * Default delegates (RectNodeTemplate.qml, RectGroupTemplate.qml and docks) hide their labels, effects,
+     * docks and ports below Full, custom delegates should bind their costly content on \c levelOfDetail too.
+     */
+    Q_PROPERTY(LevelOfDetail levelOfDetail READ getLevelOfDetail WRITE setLevelOfDetail NOTIFY levelOfDetailChanged FINAL)
+    inline LevelOfDetail    getLevelOfDetail() const noexcept { return _levelOfDetail; }
+    void                    setLevelOfDetail(LevelOfDetail levelOfDetail) noexcept;
+private:
+    LevelOfDetail           _levelOfDetail = LevelOfDetail::Full;
+signals:
+    void                    levelOfDetailChanged();
+
+public:
+    /*! \brief True when this node background is drawn as a flat rectangle by a qan::NodeBatchRenderer.
+     *
+     * Default node and group delegates hide their background when batched, node item is still used for
+     * hit testing and selection.
+     */
+    Q_PROPERTY(bool batched READ getBatched NOTIFY batchedChanged FINAL)
+    inline bool getBatched() const noexcept { return !_batchRenderer.isNull(); }
+    //! Set the batch renderer drawing this node (called from qan::NodeBatchRenderer, \c nullptr to disable batching).
+    void        setBatchRenderer(qan::NodeBatchRenderer* batchRenderer) noexcept;
+signals:
+    void        batchedChanged();
+private:
+    QPointer<qan::NodeBatchRenderer>    _batchRenderer;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Intersection Shape Management *///-------------------------------
     //@{
 signals:
@@ -376,6 +480,16 @@ public:
     QPolygonF           generateDefaultBoundingShape() const;
 private:
     QPolygonF           _boundingShape;
+
+public:
+    /*! \brief Return this item bounding shape prepared for fast edge clipping (in item local CS).
+     *
+     * Clip polygon is cached until bounding shape or item size change, it is shared (read only) by
+     * all edges geometry caches connected to this item.
+     */
+    std::shared_ptr<const qan::ClipPolygon> getClipPolygon();
+private:
+    std::shared_ptr<const qan::ClipPolygon> _clipPolygon;
 protected:
     /*! \brief Invoke this method from a concrete node component in QML for non rectangular nodes.
      * \code
@@ -506,3 +620,4 @@ private:
 QML_DECLARE_TYPE(qan::NodeItem)
 Q_DECLARE_METATYPE(qan::NodeItem::Connectable)
 Q_DECLARE_METATYPE(qan::NodeItem::Dock)
+Q_DECLARE_METATYPE(qan::NodeItem::LevelOfDetail)
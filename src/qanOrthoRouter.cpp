@@ -0,0 +1,449 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanOrthoRouter.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+// QuickQanava headers
+#include "./qanOrthoRouter.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Return true if \c a and \c b overlap, or touch (unlike QRectF::intersects(), works with zero width or height rects).
+inline bool overlaps(const QRectF& a, const QRectF& b) noexcept
+{
+    return a.left() <= b.right() && a.right() >= b.left() &&
+           a.top() <= b.bottom() && a.bottom() >= b.top();
+}
+
+//! Return true if \c p is strictly inside \c r.
+inline bool strictlyContains(const QRectF& r, const QPointF& p) noexcept
+{
+    return p.x() > r.left() && p.x() < r.right() &&
+           p.y() > r.top() && p.y() < r.bottom();
+}
+
+//! Return the point where axis aligned segment [\c inside, \c outside] cross \c r border.
+inline QPointF  borderPoint(const QRectF& r, const QPointF& inside, const QPointF& outside) noexcept
+{
+    if (qFuzzyCompare(1. + inside.y(), 1. + outside.y()))   // Horizontal segment
+        return QPointF{outside.x() > inside.x() ? r.right() : r.left(), inside.y()};
+    return QPointF{inside.x(), outside.y() > inside.y() ? r.bottom() : r.top()};
+}
+
+//! Remove duplicated consecutive points and middle points of consecutive collinear segments.
+void    simplify(std::vector<QPointF>& polyline)
+{
+    std::vector<QPointF> simplified;
+    simplified.reserve(polyline.size());
+    for (const auto& p : polyline) {
+        if (!simplified.empty() &&
+            simplified.back() == p)
+            continue;
+        if (simplified.size() >= 2) {
+            const QPointF& a = simplified[simplified.size() - 2];
+            const QPointF& b = simplified.back();
+            const bool horizontal = qFuzzyCompare(1. + a.y(), 1. + b.y()) && qFuzzyCompare(1. + b.y(), 1. + p.y());
+            const bool vertical = qFuzzyCompare(1. + a.x(), 1. + b.x()) && qFuzzyCompare(1. + b.x(), 1. + p.x());
+            if (horizontal || vertical)
+                simplified.back() = p;
+            else
+                simplified.push_back(p);
+        } else
+            simplified.push_back(p);
+    }
+    polyline.swap(simplified);
+}
+
+} // ::qan::anonymous
+
+void    OrthoRouter::clear()
+{
+    _obstacles.clear();
+    _obstaclesGrid.clear();
+    _routes.clear();
+    _routesGrid.clear();
+}
+
+template <class F>
+void    OrthoRouter::forEachCell(const QRectF& rect, F f)
+{
+    const int left = static_cast<int>(std::floor(rect.left() / cellSize));
+    const int right = static_cast<int>(std::floor(rect.right() / cellSize));
+    const int top = static_cast<int>(std::floor(rect.top() / cellSize));
+    const int bottom = static_cast<int>(std::floor(rect.bottom() / cellSize));
+    for (int y = top; y <= bottom; y++)
+        for (int x = left; x <= right; x++)
+            f(x, y);
+}
+//-----------------------------------------------------------------------------
+
+/* Obstacles Management *///---------------------------------------------------
+bool    OrthoRouter::setObstacle(Key key, const QRectF& rect, std::vector<Key>& affectedRoutes)
+{
+    const auto obstacle = _obstacles.find(key);
+    if (obstacle != _obstacles.end()) {
+        if (obstacle->second == rect)
+            return false;
+        const QRectF oldRect = obstacle->second;
+        getRoutesIntersecting(oldRect.adjusted(-_margin, -_margin, _margin, _margin), affectedRoutes);
+        indexObstacle(key, oldRect, false);
+        obstacle->second = rect;
+    } else
+        _obstacles.emplace(key, rect);
+    indexObstacle(key, rect, true);
+    getRoutesIntersecting(rect.adjusted(-_margin, -_margin, _margin, _margin), affectedRoutes);
+    return true;
+}
+
+void    OrthoRouter::removeObstacle(Key key, std::vector<Key>& affectedRoutes)
+{
+    const auto obstacle = _obstacles.find(key);
+    if (obstacle == _obstacles.end())
+        return;
+    getRoutesIntersecting(obstacle->second.adjusted(-_margin, -_margin, _margin, _margin), affectedRoutes);
+    indexObstacle(key, obstacle->second, false);
+    _obstacles.erase(obstacle);
+}
+
+bool    OrthoRouter::getObstacle(Key key, QRectF& rect) const
+{
+    const auto obstacle = _obstacles.find(key);
+    if (obstacle == _obstacles.end())
+        return false;
+    rect = obstacle->second;
+    return true;
+}
+
+void    OrthoRouter::indexObstacle(Key key, const QRectF& rect, bool insert)
+{
+    forEachCell(rect, [this, key, insert](int x, int y) {
+        if (insert)
+            _obstaclesGrid[cellKey(x, y)].push_back(key);
+        else {
+            const auto cell = _obstaclesGrid.find(cellKey(x, y));
+            if (cell == _obstaclesGrid.end())
+                return;
+            auto& keys = cell->second;
+            const auto k = std::find(keys.begin(), keys.end(), key);
+            if (k != keys.end()) {
+                *k = keys.back();
+                keys.pop_back();
+            }
+            if (keys.empty())
+                _obstaclesGrid.erase(cell);
+        }
+    });
+}
+
+void    OrthoRouter::getObstaclesIntersecting(const QRectF& rect, std::vector<QRectF>& obstacles,
+                                              Key srcKey, Key dstKey) const
+{
+    forEachCell(rect, [this, &rect, &obstacles, srcKey, dstKey](int x, int y) {
+        const auto cell = _obstaclesGrid.find(cellKey(x, y));
+        if (cell == _obstaclesGrid.end())
+            return;
+        for (const auto key : cell->second) {
+            if (key == srcKey || key == dstKey)
+                continue;
+            const QRectF& obstacle = _obstacles.at(key);
+            if (!overlaps(obstacle, rect))
+                continue;
+            // Report an obstacle only from the cell containing its intersection with rect top left corner,
+            // so that obstacles spanning multiple cells are reported once.
+            const int refX = static_cast<int>(std::floor(std::max(obstacle.left(), rect.left()) / cellSize));
+            const int refY = static_cast<int>(std::floor(std::max(obstacle.top(), rect.top()) / cellSize));
+            if (refX == x && refY == y)
+                obstacles.push_back(obstacle);
+        }
+    });
+}
+//-----------------------------------------------------------------------------
+
+/* Routes Management *///------------------------------------------------------
+void    OrthoRouter::setRoute(Key key, const std::vector<QPointF>& route)
+{
+    removeRoute(key);
+    std::vector<QRectF> segments;
+    segments.reserve(route.size());
+    for (std::size_t p = 0; p + 1 < route.size(); p++)
+        segments.emplace_back(QPointF{std::min(route[p].x(), route[p + 1].x()), std::min(route[p].y(), route[p + 1].y())},
+                              QPointF{std::max(route[p].x(), route[p + 1].x()), std::max(route[p].y(), route[p + 1].y())});
+    if (segments.empty())
+        return;
+    indexRoute(key, segments, true);
+    _routes.emplace(key, std::move(segments));
+}
+
+void    OrthoRouter::removeRoute(Key key)
+{
+    const auto route = _routes.find(key);
+    if (route == _routes.end())
+        return;
+    indexRoute(key, route->second, false);
+    _routes.erase(route);
+}
+
+void    OrthoRouter::indexRoute(Key key, const std::vector<QRectF>& segments, bool insert)
+{
+    for (const auto& segment : segments) {
+        forEachCell(segment, [this, key, insert](int x, int y) {
+            auto& keys = _routesGrid[cellKey(x, y)];
+            if (insert) {
+                if (keys.empty() || keys.back() != key)     // Consecutive segments often share cells
+                    keys.push_back(key);
+            } else {
+                keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+                if (keys.empty())
+                    _routesGrid.erase(cellKey(x, y));
+            }
+        });
+    }
+}
+
+void    OrthoRouter::getRoutesIntersecting(const QRectF& rect, std::vector<Key>& routes) const
+{
+    std::vector<Key> candidates;
+    forEachCell(rect, [this, &candidates](int x, int y) {
+        const auto cell = _routesGrid.find(cellKey(x, y));
+        if (cell != _routesGrid.end())
+            candidates.insert(candidates.end(), cell->second.cbegin(), cell->second.cend());
+    });
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    for (const auto key : candidates) {
+        const auto& segments = _routes.at(key);
+        if (std::any_of(segments.cbegin(), segments.cend(),
+                        [&rect](const QRectF& segment) { return overlaps(segment, rect); }))
+            routes.push_back(key);
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Routing *///----------------------------------------------------------------
+std::vector<QPointF>    OrthoRouter::route(const QRectF& srcRect, const QRectF& dstRect,
+                                           Key srcKey, Key dstKey) const
+{
+    // Algorithm:
+        // 1. Collect obstacles (inflated by margin) around source and destination.
+        // 2. Build a sparse orthogonal visibility grid from source and destination centers and
+        //    inflated obstacles borders, a grid segment is blocked if it is inside an obstacle.
+        // 3. Run A* from source center to destination center with a bend penalty.
+        // 4. Clip resulting polyline on source and destination borders.
+        // When no route is found, widen search area around blocking obstacles and retry.
+    if (srcRect.isEmpty() || dstRect.isEmpty() ||
+        overlaps(srcRect, dstRect))
+        return {};
+    static constexpr std::size_t maxObstacles = 512;   // Give up (user should fall back to an unrouted edge) in very dense areas
+    static constexpr qreal eps = 1e-6;
+    const QPointF s = srcRect.center();
+    const QPointF d = dstRect.center();
+    const qreal m = _margin;
+    QRectF area = srcRect.united(dstRect).adjusted(-4. * m, -4. * m, 4. * m, 4. * m);
+
+    std::vector<QRectF> obstacles;
+    std::vector<qreal>  xs, ys;
+    std::vector<char>   hBlocked, vBlocked;
+    // Only a small corridor of the visibility grid is usually explored, store A* states costs and parents sparsely
+    std::unordered_map<int, std::pair<double, int>> states;
+    for (int attempt = 0; attempt < 3; attempt++) {
+        // 1.
+        obstacles.clear();
+        getObstaclesIntersecting(area, obstacles, srcKey, dstKey);
+        if (obstacles.size() > maxObstacles)
+            return {};
+        for (auto& obstacle : obstacles) {
+            const QRectF inflated = obstacle.adjusted(-m, -m, m, m);
+            if (strictlyContains(obstacle, s) || strictlyContains(obstacle, d))
+                obstacle = QRectF{};    // Overlapping source or destination: ignore obstacle
+            else if (!strictlyContains(inflated, s) && !strictlyContains(inflated, d))
+                obstacle = inflated;
+        }
+        obstacles.erase(std::remove_if(obstacles.begin(), obstacles.end(),
+                                       [](const QRectF& r) { return r.isNull(); }), obstacles.end());
+
+        // 2.
+        xs = {area.left(), area.right(), s.x(), d.x()};
+        ys = {area.top(), area.bottom(), s.y(), d.y()};
+        for (const auto& obstacle : obstacles) {
+            for (const auto x : {obstacle.left(), obstacle.right()})
+                if (x > area.left() && x < area.right())
+                    xs.push_back(x);
+            for (const auto y : {obstacle.top(), obstacle.bottom()})
+                if (y > area.top() && y < area.bottom())
+                    ys.push_back(y);
+        }
+        std::sort(xs.begin(), xs.end());
+        xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+        std::sort(ys.begin(), ys.end());
+        ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+        const int nx = static_cast<int>(xs.size());
+        const int ny = static_cast<int>(ys.size());
+        // hBlocked[j * (nx - 1) + i]: segment (xs[i], ys[j]) -> (xs[i + 1], ys[j])
+        // vBlocked[i * (ny - 1) + j]: segment (xs[i], ys[j]) -> (xs[i], ys[j + 1])
+        hBlocked.assign(static_cast<std::size_t>((nx - 1) * ny), 0);
+        vBlocked.assign(static_cast<std::size_t>(nx * (ny - 1)), 0);
+        for (const auto& obstacle : obstacles) {
+            const int i0 = static_cast<int>(std::lower_bound(xs.cbegin(), xs.cend(), obstacle.left() - eps) - xs.cbegin());
+            const int i1 = static_cast<int>(std::upper_bound(xs.cbegin(), xs.cend(), obstacle.right() + eps) - xs.cbegin());   // First x after obstacle
+            const int j0 = static_cast<int>(std::lower_bound(ys.cbegin(), ys.cend(), obstacle.top() - eps) - ys.cbegin());
+            const int j1 = static_cast<int>(std::upper_bound(ys.cbegin(), ys.cend(), obstacle.bottom() + eps) - ys.cbegin());
+            for (int j = j0; j < j1; j++) {
+                if (ys[j] <= obstacle.top() + eps || ys[j] >= obstacle.bottom() - eps)
+                    continue;                           // Grid line on obstacle border
+                for (int i = i0; i + 1 < i1; i++)
+                    hBlocked[static_cast<std::size_t>(j * (nx - 1) + i)] = 1;
+            }
+            for (int i = i0; i < i1; i++) {
+                if (xs[i] <= obstacle.left() + eps || xs[i] >= obstacle.right() - eps)
+                    continue;
+                for (int j = j0; j + 1 < j1; j++)
+                    vBlocked[static_cast<std::size_t>(i * (ny - 1) + j)] = 1;
+            }
+        }
+
+        // 3. States are (grid node, incoming direction): 0: +x, 1: -x, 2: +y, 3: -y
+        const int si = static_cast<int>(std::lower_bound(xs.cbegin(), xs.cend(), s.x()) - xs.cbegin());
+        const int sj = static_cast<int>(std::lower_bound(ys.cbegin(), ys.cend(), s.y()) - ys.cbegin());
+        const int di = static_cast<int>(std::lower_bound(xs.cbegin(), xs.cend(), d.x()) - xs.cbegin());
+        const int dj = static_cast<int>(std::lower_bound(ys.cbegin(), ys.cend(), d.y()) - ys.cbegin());
+        states.clear();
+        const auto parent = [&states](int state) { return states.at(state).second; };
+        // Note: Manhattan distance heuristic is slightly inflated (weighted A*): with dense obstacles, exact A*
+        // explore most of the grid, a 1.1 weight generate routes less than 1% longer while exploring only
+        // a narrow corridor.
+        static constexpr double heuristicWeight = 1.1;
+        const auto heuristic = [&xs, &ys, di, dj](int i, int j) {
+            return heuristicWeight * (std::fabs(xs[i] - xs[di]) + std::fabs(ys[j] - ys[dj]));
+        };
+        // Open states ordered by (f, h, state): ties on f are broken toward the goal, which avoid exploring
+        // all equivalent "staircase" paths of the grid.
+        using Entry = std::tuple<double, double, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        for (int dir = 0; dir < 4; dir++) {
+            const int state = (sj * nx + si) * 4 + dir;
+            states[state] = {0., -1};
+            open.emplace(heuristic(si, sj), heuristic(si, sj), state);
+        }
+        int goal = -1;
+        while (!open.empty()) {
+            const auto entry = open.top();
+            open.pop();
+            const int state = std::get<2>(entry);
+            const int dir = state % 4;
+            const int node = state / 4;
+            const int i = node % nx;
+            const int j = node / nx;
+            const double cost = states.at(state).first;
+            if (std::get<0>(entry) > cost + heuristic(i, j) + eps)
+                continue;                               // Outdated entry
+            if (i == di && j == dj) {
+                goal = state;
+                break;
+            }
+            static constexpr int dis[4] = {1, -1, 0, 0};
+            static constexpr int djs[4] = {0, 0, 1, -1};
+            static constexpr int opposite[4] = {1, 0, 3, 2};
+            for (int next = 0; next < 4; next++) {
+                if (next == opposite[dir] && parent(state) >= 0)
+                    continue;
+                const int ni = i + dis[next];
+                const int nj = j + djs[next];
+                if (ni < 0 || ni >= nx || nj < 0 || nj >= ny)
+                    continue;
+                const bool blocked = next < 2 ? hBlocked[static_cast<std::size_t>(j * (nx - 1) + std::min(i, ni))] != 0 :
+                                                vBlocked[static_cast<std::size_t>(i * (ny - 1) + std::min(j, nj))] != 0;
+                if (blocked)
+                    continue;
+                const bool bend = next != dir && parent(state) >= 0;
+                const double nextCost = cost + std::fabs(xs[ni] - xs[i]) + std::fabs(ys[nj] - ys[j]) +
+                                        (bend ? _bendPenalty : 0.);
+                const int nextState = (nj * nx + ni) * 4 + next;
+                const auto visited = states.find(nextState);
+                if (visited == states.end() ||
+                    nextCost < visited->second.first) {
+                    states[nextState] = {nextCost, state};
+                    open.emplace(nextCost + heuristic(ni, nj), heuristic(ni, nj), nextState);
+                }
+            }
+        }
+        if (goal < 0) {     // Widen search area to go around blocking obstacles
+            for (const auto& obstacle : obstacles)
+                area = area.united(obstacle);
+            area = area.adjusted(-4. * m, -4. * m, 4. * m, 4. * m);
+            continue;
+        }
+
+        std::vector<QPointF> path;
+        for (int state = goal; state >= 0; state = parent(state)) {
+            const int node = state / 4;
+            path.emplace_back(xs[node % nx], ys[node / nx]);
+        }
+        std::reverse(path.begin(), path.end());
+        simplify(path);
+        if (path.size() < 2)
+            return {};
+
+        // 4. Path start in source and end in destination, keep only the part between source exit and destination entry
+        std::size_t first = 1;
+        while (first < path.size() && strictlyContains(srcRect, path[first]))
+            first++;
+        std::size_t last = path.size() - 2;
+        while (last > 0 && strictlyContains(dstRect, path[last]))
+            last--;
+        if (first >= path.size())
+            return {};
+        std::vector<QPointF> polyline;
+        polyline.reserve(path.size());
+        polyline.push_back(borderPoint(srcRect, path[first - 1], path[first]));
+        if (first <= last) {
+            polyline.insert(polyline.end(), path.cbegin() + static_cast<std::ptrdiff_t>(first),
+                            path.cbegin() + static_cast<std::ptrdiff_t>(last) + 1);
+            polyline.push_back(borderPoint(dstRect, path[last + 1], path[last]));
+        } else     // Source exit and destination entry on the same segment
+            polyline.push_back(borderPoint(dstRect, path[first], path[first - 1]));
+        simplify(polyline);
+        return polyline.size() >= 2 ? polyline : std::vector<QPointF>{};
+    }
+    return {};
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
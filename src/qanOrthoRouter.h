@@ -0,0 +1,140 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanOrthoRouter.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QPointF>
+#include <QRectF>
+
+namespace qan { // ::qan
+
+/*! \brief Obstacle avoiding orthogonal edge router.
+ *
+ * Router maintains a set of rectangular obstacles (usually graph nodes) and a set of routes (edges
+ * polylines), both indexed in a uniform grid for fast local queries:
+ *  - route() generate an orthogonal polyline between two rectangles with A* on a sparse
+ *    orthogonal visibility grid built from the obstacles around source and destination only.
+ *  - setObstacle() / removeObstacle() return the routes whose corridor intersect the obstacle old or
+ *    new rectangle: only those routes need to be re-routed when an obstacle move.
+ *
+ * Obstacles and routes must be modified from a single thread, const methods (including route())
+ * can be called concurrently.
+ *
+ * \note Routes keep at least getMargin() distance from obstacles, when no route exists, route()
+ * return an empty polyline.
+ */
+class OrthoRouter
+{
+public:
+    OrthoRouter() = default;
+    ~OrthoRouter() = default;
+    OrthoRouter(const OrthoRouter&) = delete;
+
+public:
+    //! Obstacles and routes keys (for example qan::NodeItem or qan::EdgeItem pointers).
+    using Key = const void*;
+
+    //! Minimum distance between routes and obstacles (default to 10.).
+    inline qreal    getMargin() const noexcept { return _margin; }
+    inline void     setMargin(qreal margin) noexcept { _margin = margin; }
+
+    //! Cost of a bend expressed as an equivalent route length (default to 20.).
+    inline qreal    getBendPenalty() const noexcept { return _bendPenalty; }
+    inline void     setBendPenalty(qreal bendPenalty) noexcept { _bendPenalty = bendPenalty; }
+
+    //! Remove all obstacles and routes.
+    void            clear();
+
+public:
+    /*! \brief Insert or move obstacle \c key to \c rect, keys of routes intersecting obstacle old or new rect are appended to \c affectedRoutes.
+     *
+     * \return false if obstacle was already registered with \c rect (\c affectedRoutes is not modified).
+     */
+    bool            setObstacle(Key key, const QRectF& rect, std::vector<Key>& affectedRoutes);
+    //! Remove obstacle \c key, keys of routes intersecting obstacle rect are appended to \c affectedRoutes.
+    void            removeObstacle(Key key, std::vector<Key>& affectedRoutes);
+    //! Return true if \c key is a registered obstacle, and set its current \c rect.
+    bool            getObstacle(Key key, QRectF& rect) const;
+    inline int      getObstacleCount() const noexcept { return static_cast<int>(_obstacles.size()); }
+
+public:
+    /*! \brief Route an orthogonal polyline from \c srcRect to \c dstRect avoiding all obstacles except \c srcKey and \c dstKey.
+     *
+     * Route start on \c srcRect border and end on \c dstRect border, going out of source and destination
+     * centers horizontally or vertically. Polyline has no consecutive collinear segments.
+     *
+     * \return routed polyline or an empty polyline if no route is found (for example, when source and destination overlap).
+     */
+    std::vector<QPointF>    route(const QRectF& srcRect, const QRectF& dstRect,
+                                  Key srcKey = nullptr, Key dstKey = nullptr) const;
+
+    //! Register \c route as route \c key corridor (any previous corridor for \c key is replaced).
+    void            setRoute(Key key, const std::vector<QPointF>& route);
+    //! Remove route \c key corridor.
+    void            removeRoute(Key key);
+    inline int      getRouteCount() const noexcept { return static_cast<int>(_routes.size()); }
+    //! Append keys of routes with a segment intersecting \c rect to \c routes (each key is appended once).
+    void            getRoutesIntersecting(const QRectF& rect, std::vector<Key>& routes) const;
+
+private:
+    using Cell = long long;
+    //! Grid cell size used to index obstacles and routes.
+    static constexpr qreal  cellSize = 256.;
+    static inline Cell      cellKey(int x, int y) noexcept {
+        return (static_cast<Cell>(x) << 32) ^ static_cast<Cell>(static_cast<unsigned int>(y));
+    }
+    template <class F>
+    static void             forEachCell(const QRectF& rect, F f);
+
+    void            indexObstacle(Key key, const QRectF& rect, bool insert);
+    void            indexRoute(Key key, const std::vector<QRectF>& segments, bool insert);
+    void            getObstaclesIntersecting(const QRectF& rect, std::vector<QRectF>& obstacles,
+                                             Key srcKey, Key dstKey) const;
+
+    qreal           _margin = 10.;
+    qreal           _bendPenalty = 20.;
+
+    std::unordered_map<Key, QRectF>                 _obstacles;
+    std::unordered_map<Cell, std::vector<Key>>      _obstaclesGrid;
+    //! Routes segments bounding rects.
+    std::unordered_map<Key, std::vector<QRectF>>    _routes;
+    std::unordered_map<Cell, std::vector<Key>>      _routesGrid;
+};
+
+} // ::qan
@@ -123,10 +123,10 @@ void    PortItem::updateEdges()
 {
     for (auto inEdgeItem: _inEdgeItems)
         if (inEdgeItem != nullptr)
-            inEdgeItem->updateItem();
+            inEdgeItem->updateItemSlot();
     for (auto outEdgeItem: _outEdgeItems)
         if (outEdgeItem != nullptr)
-            outEdgeItem->updateItem();
+            outEdgeItem->updateItemSlot();
 }
 //-----------------------------------------------------------------------------
 
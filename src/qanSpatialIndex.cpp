@@ -0,0 +1,269 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+// QuickQanava headers
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Return true if \c a and \c b overlap, or touch (unlike QRectF::intersects(), works with zero width or height rects).
+inline bool overlaps(const QRectF& a, const QRectF& b) noexcept
+{
+    return a.left() <= b.right() && a.right() >= b.left() &&
+           a.top() <= b.bottom() && a.bottom() >= b.top();
+}
+
+//! Return squared distance from \c p to \c r (0. when \c p is inside \c r).
+inline qreal squaredDistance(const QRectF& r, const QPointF& p) noexcept
+{
+    const qreal dx = std::max({r.left() - p.x(), 0., p.x() - r.right()});
+    const qreal dy = std::max({r.top() - p.y(), 0., p.y() - r.bottom()});
+    return dx * dx + dy * dy;
+}
+
+inline bool isFinite(const QRectF& r) noexcept
+{
+    return std::isfinite(r.left()) && std::isfinite(r.top()) &&
+           std::isfinite(r.width()) && std::isfinite(r.height());
+}
+
+} // ::qan::anonymous
+
+SpatialIndex::SpatialIndex() = default;
+SpatialIndex::~SpatialIndex() = default;
+
+void    SpatialIndex::clear()
+{
+    _items.clear();
+    _root.reset();
+}
+
+/* SpatialIndex Cells Management *///------------------------------------------
+std::unique_ptr<SpatialIndex::Cell> SpatialIndex::makeCell(const QRectF& bounds, int depth, Cell* parent)
+{
+    auto cell = std::make_unique<Cell>();
+    cell->bounds = bounds;
+    const qreal m = bounds.width() / 2.;
+    cell->looseBounds = bounds.adjusted(-m, -m, m, m);
+    cell->depth = depth;
+    cell->parent = parent;
+    return cell;
+}
+
+bool    SpatialIndex::fitsIn(const Cell& cell, const QRectF& rect, bool deepest) noexcept
+{
+    const QPointF c = rect.center();
+    if (c.x() < cell.bounds.left() || c.x() > cell.bounds.right() ||
+        c.y() < cell.bounds.top() || c.y() > cell.bounds.bottom())
+        return false;
+    const qreal extent = std::max(rect.width(), rect.height());
+    const qreal size = cell.bounds.width();
+    if (extent > size)
+        return false;
+    return !deepest || cell.depth >= maxDepth || extent > size / 2.;
+}
+
+void    SpatialIndex::growRoot(const QRectF& rect)
+{
+    QRectF br = rect;
+    for (const auto& item : _items)
+        br = br.united(item.second.rect);
+    qreal size = _root ? _root->bounds.width() * 2. : minRootSize;
+    while (size < std::max(br.width(), br.height()))
+        size *= 2.;
+    const QPointF c = br.center();
+    _root = makeCell(QRectF{c.x() - size / 2., c.y() - size / 2., size, size}, 0, nullptr);
+    for (auto& item : _items)   // Re-insert all rectangles in the new root
+        item.second.cell = insert(item.first, item.second.rect);
+}
+
+SpatialIndex::Cell* SpatialIndex::insert(Key key, const QRectF& rect)
+{
+    if (!_root || !fitsIn(*_root, rect, false))
+        growRoot(rect);     // Note: growRoot() re-insert all _items, key must not be in _items
+    const QPointF c = rect.center();
+    const qreal extent = std::max(rect.width(), rect.height());
+    Cell* cell = _root.get();
+    while (cell->depth < maxDepth &&
+           extent <= cell->bounds.width() / 2.) {
+        const QPointF m = cell->bounds.center();
+        const int q = (c.x() >= m.x() ? 1 : 0) | (c.y() >= m.y() ? 2 : 0);
+        if (!cell->children[q]) {
+            const qreal s = cell->bounds.width() / 2.;
+            const QRectF bounds{q & 1 ? m.x() : cell->bounds.left(),
+                                q & 2 ? m.y() : cell->bounds.top(), s, s};
+            cell->children[q] = makeCell(bounds, cell->depth + 1, cell);
+        }
+        cell = cell->children[q].get();
+    }
+    cell->keys.push_back(key);
+    return cell;
+}
+
+void    SpatialIndex::detach(Key key, Cell* cell)
+{
+    auto& keys = cell->keys;
+    const auto k = std::find(keys.begin(), keys.end(), key);
+    if (k != keys.end()) {
+        *k = keys.back();
+        keys.pop_back();
+    }
+    // Delete empty leaf cells up to root
+    while (cell != nullptr &&
+           cell->parent != nullptr &&
+           cell->keys.empty() &&
+           std::none_of(std::begin(cell->children), std::end(cell->children),
+                        [](const auto& child) { return child != nullptr; })) {
+        Cell* parent = cell->parent;
+        for (auto& child : parent->children)
+            if (child.get() == cell)
+                child.reset();
+        cell = parent;
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* SpatialIndex Rectangles Management *///-------------------------------------
+bool    SpatialIndex::setRect(Key key, const QRectF& rect)
+{
+    if (key == nullptr)
+        return false;
+    if (!isFinite(rect))
+        return remove(key);
+    const auto item = _items.find(key);
+    if (item != _items.end()) {
+        if (item->second.rect == rect)
+            return false;
+        if (fitsIn(*item->second.cell, rect, true)) {   // Fast path: rect stay in the same cell
+            item->second.rect = rect;
+            return true;
+        }
+        detach(key, item->second.cell);
+        _items.erase(item);
+    }
+    Cell* cell = insert(key, rect);
+    _items.emplace(key, Item{rect, cell});
+    return true;
+}
+
+bool    SpatialIndex::remove(Key key)
+{
+    const auto item = _items.find(key);
+    if (item == _items.end())
+        return false;
+    detach(key, item->second.cell);
+    _items.erase(item);
+    return true;
+}
+
+bool    SpatialIndex::getRect(Key key, QRectF& rect) const
+{
+    const auto item = _items.find(key);
+    if (item == _items.end())
+        return false;
+    rect = item->second.rect;
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* SpatialIndex Queries *///---------------------------------------------------
+void    SpatialIndex::itemsIn(const QRectF& rect, std::vector<Key>& keys) const
+{
+    if (!_root)
+        return;
+    const QRectF r = rect.normalized();
+    std::vector<const Cell*> cells{_root.get()};
+    while (!cells.empty()) {
+        const Cell* cell = cells.back();
+        cells.pop_back();
+        for (const auto key : cell->keys) {
+            const auto item = _items.find(key);
+            if (item != _items.end() &&
+                overlaps(item->second.rect, r))
+                keys.push_back(key);
+        }
+        for (const auto& child : cell->children)
+            if (child && overlaps(child->looseBounds, r))
+                cells.push_back(child.get());
+    }
+}
+
+void    SpatialIndex::itemsAt(const QPointF& point, std::vector<Key>& keys) const
+{
+    itemsIn(QRectF{point.x(), point.y(), 0., 0.}, keys);
+}
+
+void    SpatialIndex::nearest(const QPointF& point, int k, std::vector<Key>& keys) const
+{
+    if (!_root || k <= 0)
+        return;
+    // Best first traversal: cells are expanded by increasing loose bounds distance, a
+    // rectangle is reported once no cell or rectangle closer to point remains.
+    struct Entry {
+        qreal       distance;
+        const Cell* cell;
+        Key         key;
+        bool operator>(const Entry& other) const noexcept { return distance > other.distance; }
+    };
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> entries;
+    entries.push(Entry{squaredDistance(_root->looseBounds, point), _root.get(), nullptr});
+    int found = 0;
+    while (!entries.empty() && found < k) {
+        const Entry entry = entries.top();
+        entries.pop();
+        if (entry.cell == nullptr) {
+            keys.push_back(entry.key);
+            ++found;
+            continue;
+        }
+        for (const auto key : entry.cell->keys) {
+            const auto item = _items.find(key);
+            if (item != _items.end())
+                entries.push(Entry{squaredDistance(item->second.rect, point), nullptr, key});
+        }
+        for (const auto& child : entry.cell->children)
+            if (child)
+                entries.push(Entry{squaredDistance(child->looseBounds, point), child.get(), nullptr});
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QPointF>
+#include <QRectF>
+
+namespace qan { // ::qan
+
+/*! \brief Loose quadtree spatial index of rectangles (usually graph nodes, groups and edges bounding rects).
+ *
+ * Each rectangle is stored in the deepest cell whose loose bounds (cell bounds inflated by half
+ * the cell size on each side) fully contain it, choosing child cell from rectangle center: a rectangle
+ * is stored exactly once and moving it only requires moving its key between cells. Root cell is
+ * automatically enlarged when a rectangle is set outside of it.
+ *
+ * Overlap tests are inclusive (rectangles touching a query rect are reported), zero width or height
+ * rectangles (for example horizontal or vertical edges bounding rects) are supported.
+ *
+ * Index must be modified from a single thread, const methods can be called concurrently.
+ *
+ * \code
+ * qan::SpatialIndex index;
+ * index.setRect(nodeItem, nodeItem->mapRectToItem(containerItem, nodeItem->boundingRect()));
+ * std::vector<qan::SpatialIndex::Key> keys;
+ * index.itemsIn(QRectF{0., 0., 100., 100.}, keys);
+ * \endcode
+ */
+class SpatialIndex
+{
+public:
+    SpatialIndex();
+    ~SpatialIndex();
+    SpatialIndex(const SpatialIndex&) = delete;
+
+public:
+    //! Indexed rectangles keys (for example qan::NodeItem or qan::EdgeItem pointers).
+    using Key = const void*;
+
+    //! Remove all rectangles.
+    void            clear();
+
+    /*! \brief Insert or move rectangle \c key to \c rect.
+     *
+     * \return false if \c key was already registered with \c rect.
+     */
+    bool            setRect(Key key, const QRectF& rect);
+    //! Remove rectangle \c key, return false if \c key was not registered.
+    bool            remove(Key key);
+    //! Return true if \c key is registered in this index.
+    inline bool     contains(Key key) const { return _items.find(key) != _items.end(); }
+    //! Return true if \c key is registered and set its current \c rect.
+    bool            getRect(Key key, QRectF& rect) const;
+    inline int      size() const noexcept { return static_cast<int>(_items.size()); }
+
+public:
+    //! Append keys of rectangles overlapping or touching \c rect to \c keys (in unspecified order).
+    void            itemsIn(const QRectF& rect, std::vector<Key>& keys) const;
+    //! Append keys of rectangles containing \c point (borders included) to \c keys (in unspecified order).
+    void            itemsAt(const QPointF& point, std::vector<Key>& keys) const;
+    //! Append keys of the \c k rectangles nearest to \c point to \c keys, sorted by increasing distance (0. for rectangles containing \c point).
+    void            nearest(const QPointF& point, int k, std::vector<Key>& keys) const;
+
+private:
+    struct Cell {
+        //! Cell tight bounds (loose bounds are tight bounds inflated by half cell size on each side).
+        QRectF                  bounds;
+        QRectF                  looseBounds;
+        int                     depth = 0;
+        Cell*                   parent = nullptr;
+        std::unique_ptr<Cell>   children[4];
+        std::vector<Key>        keys;
+    };
+    struct Item {
+        QRectF  rect;
+        Cell*   cell = nullptr;
+    };
+
+    //! Minimum root cell size.
+    static constexpr qreal  minRootSize = 1024.;
+    //! Maximum cell depth, deepest cells are 2^maxDepth smaller than root cell.
+    static constexpr int    maxDepth = 16;
+
+    static std::unique_ptr<Cell>    makeCell(const QRectF& bounds, int depth, Cell* parent);
+    //! Return true if \c rect can be stored in \c cell (without going deeper when \c deepest is true).
+    static bool     fitsIn(const Cell& cell, const QRectF& rect, bool deepest) noexcept;
+
+    //! Rebuild root cell so that it contains all registered rectangles and \c rect.
+    void            growRoot(const QRectF& rect);
+    Cell*           insert(Key key, const QRectF& rect);
+    //! Remove \c key from \c cell and delete the empty cells up to root.
+    void            detach(Key key, Cell* cell);
+
+    std::unique_ptr<Cell>           _root;
+    std::unordered_map<Key, Item>   _items;
+};
+
+} // ::qan
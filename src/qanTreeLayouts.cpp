@@ -49,6 +49,22 @@
 
 namespace qan { // ::qan
 
+namespace { // ::qan::
+
+/*! \brief Move \c node to \c position.
+ *
+ * Layouts use node item geometry (see qan::Node::getItemGeometry()): nodes without item (virtualized
+ * out of view or not yet incubated) are positioned using their stored geometry.
+ */
+void    setNodePosition(qan::Node& node, QPointF position) noexcept
+{
+    auto geometry = node.getItemGeometry();
+    geometry.moveTopLeft(position);
+    node.setItemGeometry(geometry);
+}
+
+} // ::qan::
+
 /* NaiveTreeLayout Object Management *///--------------------------------------
 NaiveTreeLayout::NaiveTreeLayout(QObject* parent) noexcept :
     QObject{parent}
@@ -125,9 +141,8 @@ void    NaiveTreeLayout::layout(qan::Node& root) noexcept
         // 2.2
         double x = 0.;
         for (const auto node: nodes) {
-            node->getItem()->setX(x);
-            node->getItem()->setY(y);
-            x += node->getItem()->getBoundingShape().boundingRect().width() + xSpacing;
+            setNodePosition(*node, QPointF{x, y});
+            x += node->getItemGeometry().width() + xSpacing;
         }
     }
 
@@ -164,11 +179,9 @@ void    RandomLayout::layout(qan::Node& root) noexcept
     const auto graph = root.getGraph();
     if (graph == nullptr)
         return;
-    if (root.getItem() == nullptr)
-        return;
 
     // Generate a 1000x1000 layout rect centered on root if the user has not specified one
-    const auto rootPosition = root.getItem()->position();
+    const auto rootPosition = root.getItemGeometry().topLeft();
     const auto layoutRect = _layoutRect.isEmpty() ? QRectF{rootPosition.x() - 500, rootPosition.y() - 500, 1000., 1000.} :
                                                     _layoutRect;
 
@@ -176,13 +189,11 @@ void    RandomLayout::layout(qan::Node& root) noexcept
     outNodes.insert(&root);
     for (auto n : outNodes) {
         auto node = const_cast<qan::Node*>(n);
-        if (node->getItem() == nullptr)
-            continue;
-        const auto nodeBr = node->getItem()->boundingRect();
+        const auto nodeBr = node->getItemGeometry();
         qreal maxX = layoutRect.width() - nodeBr.width();       // Generate and set random x and y positions
         qreal maxY = layoutRect.height() - nodeBr.height();     // within available layoutRect area
-        node->getItem()->setX(QRandomGenerator::global()->bounded(maxX) + layoutRect.left());
-        node->getItem()->setY(QRandomGenerator::global()->bounded(maxY) + layoutRect.top());
+        setNodePosition(*node, QPointF{QRandomGenerator::global()->bounded(maxX) + layoutRect.left(),
+                                       QRandomGenerator::global()->bounded(maxY) + layoutRect.top()});
     }
 }
 
@@ -227,10 +238,9 @@ void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) n
     auto layoutVert_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
         const auto x = br.right() + xSpacing;
         for (auto child: childNodes) {
-            child->getItem()->setX(x);
-            child->getItem()->setY(br.bottom() + ySpacing);
+            setNodePosition(*child, QPointF{x, br.bottom() + ySpacing});
             // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
+            br = br.united(child->getItemGeometry());
             const auto childBr = self(self, child->get_out_nodes(), br);
             br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
         }
@@ -240,10 +250,9 @@ void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) n
     auto layoutHoriz_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
         const auto y = br.bottom() + ySpacing;
         for (auto child: childNodes) {
-            child->getItem()->setX(br.right() + xSpacing);
-            child->getItem()->setY(y);
+            setNodePosition(*child, QPointF{br.right() + xSpacing, y});
             // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
+            br = br.united(child->getItemGeometry());
             const auto childBr = self(self, child->get_out_nodes(), br);
             br.setRight(childBr.right()); // Note: Do not take full child BR into account to avoid x drifting
         }
@@ -262,10 +271,9 @@ void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) n
         else {
             const auto x = br.right() + xSpacing;
             for (auto child: childNodes) {
-                child->getItem()->setX(x);
-                child->getItem()->setY(br.bottom() + ySpacing);
+                setNodePosition(*child, QPointF{x, br.bottom() + ySpacing});
                 // Take into account this level maximum width
-                br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
+                br = br.united(child->getItemGeometry());
                 const auto childBr = self(self, child->get_out_nodes(), br);
                 br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
             }
@@ -273,20 +281,21 @@ void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) n
         return br;
     };
 
-    // Note: QQuickItem boundingRect() is in item local CS, translate to "scene" CS.
+    // Note: Node item geometry is in item parent CS (ie graph "scene" CS for ungrouped nodes), nodes
+    // without item (virtualized or incubating) are laid out using their stored geometry.
     switch (getLayoutOrientation()) {
     case LayoutOrientation::Undefined: return;
     case LayoutOrientation::Vertical:
         layoutVert_rec(layoutVert_rec, root.get_out_nodes(),
-                       root.getItem()->boundingRect().translated(root.getItem()->position()));
+                       root.getItemGeometry());
         break;
     case LayoutOrientation::Horizontal:
         layoutHoriz_rec(layoutHoriz_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
+                        root.getItemGeometry());
         break;
     case LayoutOrientation::Mixed:
         layoutMixed_rec(layoutMixed_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
+                        root.getItemGeometry());
         break;
     }
 }
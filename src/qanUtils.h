@@ -39,12 +39,15 @@
 #include <sstream>
 #include <random>
 #include <exception>
+#include <iterator>     // std::next
+#include <vector>
 
 // Qt headers
 #include <QString>
 #include <QQmlComponent>
 #include <QQmlEngine>
 #include <QQuickItem>
+#include <QRectF>
 
 namespace std
 {
@@ -85,6 +88,7 @@ private:
 };
 
 
+//! Return \c item global z (sum of item and parents z), prefer qan::NodeItem::getGlobalZ() cached version for node and group items.
 static inline auto getItemGlobalZ_rec(const QQuickItem* item) -> qreal {
     const auto impl = [](const QQuickItem* item, const auto& self) -> qreal {
         if (item == nullptr)
@@ -94,5 +98,59 @@ static inline auto getItemGlobalZ_rec(const QQuickItem* item) -> qreal {
     return impl(item, impl);
 };
 
+/*! \brief Return true if item \c a is painted after (on top of) item \c b, used to break global z ties in stacking order.
+ *
+ * Items are compared at their closest common ancestor level: a descendant is painted after its ancestor, and
+ * siblings are painted by increasing z, then in their parent childItems() order. Return false if \c a and \c b
+ * are the same item or do not share an ancestor.
+ */
+static inline bool  isItemStackedAbove(const QQuickItem* a, const QQuickItem* b) {
+    if (a == nullptr || b == nullptr || a == b)
+        return false;
+    std::vector<const QQuickItem*> aChain;  // a ancestors (including a) from a to root
+    std::vector<const QQuickItem*> bChain;
+    for (auto item = a; item != nullptr; item = item->parentItem())
+        aChain.push_back(item);
+    for (auto item = b; item != nullptr; item = item->parentItem())
+        bChain.push_back(item);
+    auto ai = aChain.crbegin();
+    auto bi = bChain.crbegin();
+    if (*ai != *bi)
+        return false;
+    while (std::next(ai) != aChain.crend() &&   // Find closest common ancestor
+           std::next(bi) != bChain.crend() &&
+           *std::next(ai) == *std::next(bi)) {
+        ++ai;
+        ++bi;
+    }
+    const auto an = std::next(ai);
+    const auto bn = std::next(bi);
+    if (an == aChain.crend())   // a is an ancestor of b
+        return false;
+    if (bn == bChain.crend())   // b is an ancestor of a
+        return true;
+    if ((*an)->z() != (*bn)->z())
+        return (*an)->z() > (*bn)->z();
+    const auto siblings = (*ai)->childItems();
+    return siblings.indexOf(const_cast<QQuickItem*>(*an)) > siblings.indexOf(const_cast<QQuickItem*>(*bn));
+}
+
+//! Append \c a minus \c b to \c rects as at most 4 rectangles (sharing their borders with \c b), used for incremental rubber band selection.
+static inline void  appendRectDifference(const QRectF& a, const QRectF& b, std::vector<QRectF>& rects) {
+    const QRectF i = a.intersected(b);
+    if (i.isEmpty()) {
+        rects.push_back(a);
+        return;
+    }
+    if (i.top() > a.top())
+        rects.emplace_back(QPointF{a.left(), a.top()}, QPointF{a.right(), i.top()});
+    if (i.bottom() < a.bottom())
+        rects.emplace_back(QPointF{a.left(), i.bottom()}, QPointF{a.right(), a.bottom()});
+    if (i.left() > a.left())
+        rects.emplace_back(QPointF{a.left(), i.top()}, QPointF{i.left(), i.bottom()});
+    if (i.right() < a.right())
+        rects.emplace_back(QPointF{i.right(), i.top()}, QPointF{a.right(), i.bottom()});
+}
+
 
 } // ::qan
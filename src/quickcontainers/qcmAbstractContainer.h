@@ -72,6 +72,7 @@ public:
     inline void    fwdEndRemoveRows() noexcept { if (_model) _model->fwdEndRemoveRows(); }
     inline void    fwdBeginResetModel() noexcept { if (_model) _model->fwdBeginResetModel(); }
     inline void    fwdEndResetModel() noexcept { if (_model) _model->fwdEndResetModel(); }
+    inline void    fwdEmitDataChanged(int row) noexcept { if (_model) _model->fwdEmitDataChanged(row); }
 
 public:
     Q_PROPERTY(ContainerModel*  model READ getModel CONSTANT FINAL)
@@ -47,6 +47,7 @@
 #include <memory>       // shared_ptr, weak_ptr
 #include <type_traits>  // integral_constant
 #include <utility>      // std::declval
+#include <algorithm>    // std::count_if
 
 QT_BEGIN_NAMESPACE
 
@@ -270,6 +271,34 @@ public:
         }
     }
 
+    /*! \brief Append items in range [\c first, \c last) with a single model rows insertion.
+     *
+     * Container storage is reserved once and model is notified with a single beginInsertRows()/endInsertRows(),
+     * null items are ignored.
+     */
+    template <class InputIt>
+    void        append(InputIt first, InputIt last) {
+        const auto count = std::count_if(first, last, [this](const T& item) {
+            return !isNullPtr(item, typename ItemDispatcher<T>::type{});
+        });
+        if (count <= 0)
+            return;
+        const auto size = static_cast<int>(_container.size());
+        reserve(static_cast<std::size_t>(size + count));
+        if (_model)
+            fwdBeginInsertRows(QModelIndex{}, size, size + static_cast<int>(count) - 1);
+        for (auto it = first; it != last; ++it) {
+            if (isNullPtr(*it, typename ItemDispatcher<T>::type{}))
+                continue;
+            qcm::adapter<C, T>::append(_container, *it);
+            appendImpl(*it, typename ItemDispatcher<T>::type{});
+        }
+        if (_model) {
+            fwdEndInsertRows();
+            fwdEmitLengthChanged();
+        }
+    }
+
     //! Shortcut to Container<T>::insert().
     void        insert( const T& item, int i ) {
         if ( i < 0 ||           // i == 0      === prepend
@@ -340,6 +369,37 @@ public:
         }
     }
 
+    /*! \brief Remove item at index \c i in O(1) by moving the container last item to \c i (container order is not preserved).
+     *
+     * Model is notified with a dataChanged() on row \c i (when an item has been moved) and a single
+     * last row removal, no rows are shifted.
+     *
+     * \return the item that has been moved to index \c i, or a null item if \c i was the last item (or on error).
+     */
+    auto        swapAndPop(int i) -> T {
+        const auto last = static_cast<int>(_container.size()) - 1;
+        if (i < 0 || i > last)
+            return getNullT(typename ItemDispatcher<T>::type{});
+        const T item = _container[i];
+        const T moved = i != last ? _container[last] : getNullT(typename ItemDispatcher<T>::type{});
+        if (_model) {
+            removeImpl(item, typename ItemDispatcher<T>::type{});
+            if (i != last) {
+                _container[i] = moved;
+                fwdEmitDataChanged(i);
+            }
+            fwdBeginRemoveRows(QModelIndex{}, last, last);
+            qcm::adapter<C,T>::remove(_container, static_cast<std::size_t>(last));
+            fwdEndRemoveRows();
+            fwdEmitLengthChanged();
+        } else {
+            if (i != last)
+                _container[i] = moved;
+            qcm::adapter<C,T>::remove(_container, static_cast<std::size_t>(last));
+        }
+        return moved;
+    }
+
 private:
     inline auto removeImpl( const T&, ItemDispatcherBase::unsupported_type )               -> void {}
     inline auto removeImpl( const T&, ItemDispatcherBase::non_ptr_type )                   -> void {}
@@ -229,6 +229,8 @@ protected:
 
     inline void    fwdBeginResetModel() noexcept { beginResetModel(); }
     inline void    fwdEndResetModel() noexcept { endResetModel(); }
+
+    inline void    fwdEmitDataChanged(int row) noexcept { const auto rowIndex = index(row); emit dataChanged(rowIndex, rowIndex); }
     //-------------------------------------------------------------------------
 
     /*! \name QML Container Interface *///-------------------------------------
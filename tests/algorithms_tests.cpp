@@ -0,0 +1,184 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software.
+//
+// \file	algorithms_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <memory>
+#include <random>
+
+// GTpo headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// QuickQanava tests headers
+#include "./benchmark.h"
+
+//-----------------------------------------------------------------------------
+// GTpo algorithms tests
+//-----------------------------------------------------------------------------
+
+TEST(gtpo_algorithms, strongly_connected_components)
+{
+    qan::Graph g;
+    // g = n1 -> n2 -> n3 -> n1    n3 -> n4    n5
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4, n5});
+    g.insert_edges(std::vector<std::pair<qan::Node*, qan::Node*>>{{n1, n2}, {n2, n3}, {n3, n1}, {n3, n4}});
+
+    const auto snapshot = g.snapshot();
+    const auto sccs = gtpo::strongly_connected_components(snapshot);
+    EXPECT_EQ(sccs.count, 3);
+    const auto c1 = sccs.component[snapshot.get_id(n1)];
+    EXPECT_EQ(c1, sccs.component[snapshot.get_id(n2)]);
+    EXPECT_EQ(c1, sccs.component[snapshot.get_id(n3)]);
+    EXPECT_NE(c1, sccs.component[snapshot.get_id(n4)]);
+    EXPECT_LT(sccs.component[snapshot.get_id(n4)], c1);   // Reverse topological order
+
+    EXPECT_EQ(g.collectStronglyConnectedComponents().size(), 3);
+    EXPECT_EQ(g.stronglyConnectedComponents().size(), 3);
+}
+
+TEST(gtpo_algorithms, weakly_connected_components)
+{
+    qan::Graph g;
+    // g = n1 -> n2 <- n3    n4 -> n5
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4, n5});
+    g.insert_edges(std::vector<std::pair<qan::Node*, qan::Node*>>{{n1, n2}, {n3, n2}, {n4, n5}});
+
+    const auto components = g.collectConnectedComponents();
+    ASSERT_EQ(components.size(), 2);
+    EXPECT_EQ(components[0].size(), 3);
+    EXPECT_EQ(components[1].size(), 2);
+}
+
+TEST(gtpo_algorithms, bfs_layers)
+{
+    qan::Graph g;
+    // g = n1 -> n2 -> n4
+    //      +--> n3 ---^
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4});
+    g.insert_edges(std::vector<std::pair<qan::Node*, qan::Node*>>{{n1, n2}, {n1, n3}, {n2, n4}, {n3, n4}});
+
+    const auto layers = g.collectBfsLayers(*n1);
+    ASSERT_EQ(layers.size(), 3);
+    EXPECT_EQ(layers[0], std::vector<const qan::Node*>{n1});
+    EXPECT_EQ(layers[1].size(), 2);
+    EXPECT_EQ(layers[2], std::vector<const qan::Node*>{n4});
+    EXPECT_EQ(g.collectBfsLayers(*n4).size(), 1);
+}
+
+TEST(gtpo_algorithms, dijkstra_shortest_paths)
+{
+    qan::Graph g;
+    // g = n1 -(1)-> n2 -(1)-> n4
+    //      +--(5)-> n3 -(1)---^
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4, n5});
+    const auto edges = g.insert_edges(std::vector<std::pair<qan::Node*, qan::Node*>>{{n1, n2}, {n1, n3}, {n2, n4}, {n3, n4}});
+    ASSERT_EQ(edges.size(), 4);
+    edges[1]->setWeight(5.);
+
+    const auto weight = [](const qan::Edge& edge) { return edge.getWeight(); };
+    const auto path = g.collectShortestPath(*n1, *n4, weight);
+    EXPECT_EQ(path, (std::vector<const qan::Node*>{n1, n2, n4}));
+    EXPECT_TRUE(g.collectShortestPath(*n1, *n5, weight).empty());
+    EXPECT_EQ(g.shortestPath(n1, n4).size(), 3);
+
+    const auto snapshot = g.snapshot();
+    const auto paths = gtpo::dijkstra_shortest_paths(snapshot, snapshot.get_id(n1), weight);
+    EXPECT_DOUBLE_EQ(paths.distances[snapshot.get_id(n4)], 2.);
+    EXPECT_DOUBLE_EQ(paths.distances[snapshot.get_id(n3)], 5.);
+}
+
+//-----------------------------------------------------------------------------
+// GTpo algorithms benchmarks (run with --gtest_also_run_disabled_tests)
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+//! Generate a random graph with \c nodeCount nodes and \c edgeCount edges.
+void    generateRandomGraph(qan::Graph& g, int nodeCount, int edgeCount)
+{
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(nodeCount);
+    for (int n = 0; n < nodeCount; n++)
+        nodes.push_back(g.create_node());
+    g.insert_nodes(nodes);
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, nodeCount - 1};
+    std::vector<std::pair<qan::Node*, qan::Node*>> edges;
+    edges.reserve(edgeCount);
+    for (int e = 0; e < edgeCount; e++)
+        edges.emplace_back(nodes[distribution(generator)], nodes[distribution(generator)]);
+    g.insert_edges(edges);
+}
+
+} // ::
+
+TEST(gtpo_algorithms, DISABLED_benchmarks)
+{
+    qan::Graph g;
+    generateRandomGraph(g, 100000, 400000);
+
+    gtpo::snapshot<qan::Node, qan::Edge> snapshot;
+    qan::test::benchmark("snapshot", 1, [&](int) { snapshot = g.snapshot(); });
+    ASSERT_EQ(snapshot.get_node_count(), 100000);
+    qan::test::benchmark("strongly_connected_components", 1, [&](int) { gtpo::strongly_connected_components(snapshot); });
+    qan::test::benchmark("weakly_connected_components", 1, [&](int) { gtpo::weakly_connected_components(snapshot); });
+    qan::test::benchmark("bfs_layers", 1, [&](int) { gtpo::bfs_layers(snapshot, 0); });
+    qan::test::benchmark("dijkstra_shortest_paths", 1, [&](int) {
+        gtpo::dijkstra_shortest_paths(snapshot, 0, [](const qan::Edge& edge) { return edge.getWeight(); });
+    });
+    qan::test::benchmark("collectDfs (pointers)", 1, [&](int) { g.collectDfs(); });
+    qan::test::benchmark("collectDfs (snapshot)", 1, [&](int) { g.collectDfs(snapshot); });
+}
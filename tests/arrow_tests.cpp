@@ -0,0 +1,75 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software.
+//
+// \file	arrow_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QPointF>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+TEST(qan_ArrowItem, arrow_triangles_cache)
+{
+    // Arrow triangles are shared for identical arrows, cache is cleared when it grows too large
+    using ArrowEnd = qan::ArrowItem::ArrowEnd;
+    using ArrowShape = qan::EdgeStyle::ArrowShape;
+    const QPointF a1{0., -4.}, a2{8., 0.}, a3{0., 4.};
+    EXPECT_EQ(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::None, a1, a2, a3, 2.), nullptr);
+
+    // Hit: same end, shape, points and line width return the same geometry
+    const auto triangles = qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 2.);
+    ASSERT_NE(triangles, nullptr);
+    EXPECT_FALSE(triangles->empty());
+    EXPECT_EQ(triangles->size() % 3, 0u);
+    EXPECT_EQ(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 2.), triangles);
+
+    // Miss: any key difference generate another geometry
+    EXPECT_NE(qan::ArrowItem::getArrowTriangles(ArrowEnd::Source, ArrowShape::Arrow, a1, a2, a3, 2.), triangles);
+    EXPECT_NE(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::ArrowOpen, a1, a2, a3, 2.), triangles);
+    EXPECT_NE(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2 * 2., a3, 2.), triangles);
+    EXPECT_NE(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 3.), triangles);
+    EXPECT_EQ(qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 2.), triangles);
+
+    // Eviction: inserting many different arrows (animated arrows for example) clear the cache, evicted
+    // geometry is regenerated (geometry still referenced by users is not modified)
+    for (int w = 0; w < 300; w++)
+        qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 10. + w);
+    const auto regenerated = qan::ArrowItem::getArrowTriangles(ArrowEnd::Destination, ArrowShape::Arrow, a1, a2, a3, 2.);
+    ASSERT_NE(regenerated, nullptr);
+    EXPECT_NE(regenerated, triangles);
+    EXPECT_EQ(*regenerated, *triangles);
+}
@@ -0,0 +1,157 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software.
+//
+// \file	batch_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <memory>
+#include <utility>
+#include <vector>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// GTpo observers batch tests
+//-----------------------------------------------------------------------------
+
+class BatchGraphObserverMock : public gtpo::graph_observer<QQuickItem, qan::Node, qan::Edge, qan::Group>
+{
+public:
+    explicit BatchGraphObserverMock(bool batchAware) { set_batch_aware(batchAware); }
+    virtual ~BatchGraphObserverMock() { }
+
+protected:
+    virtual void    on_node_inserted(qan::Node&) noexcept override { mockNodeInserted(); }
+    virtual void    on_edge_inserted(qan::Edge&) noexcept override { mockEdgeInserted(); }
+    virtual void    on_edge_removed(qan::Edge&) noexcept override { mockEdgeRemoved(); }
+    virtual void    on_batch(const gtpo::graph_changeset<qan::Node, qan::Edge, qan::Group>& changeset) noexcept override {
+        mockBatch(changeset.inserted_nodes.size(), changeset.inserted_edges.size(), changeset.removed_edges.size());
+    }
+
+public:
+    MOCK_METHOD0(mockNodeInserted, void(void));
+    MOCK_METHOD0(mockEdgeInserted, void(void));
+    MOCK_METHOD0(mockEdgeRemoved, void(void));
+    MOCK_METHOD3(mockBatch, void(std::size_t, std::size_t, std::size_t));
+};
+
+TEST(gtpo_graph_observer, batch)
+{
+    qan::Graph g;
+    g.add_observer(std::make_unique<BatchGraphObserverMock>(true));
+    g.add_observer(std::make_unique<BatchGraphObserverMock>(false));
+    auto batchObserver = static_cast<BatchGraphObserverMock*>(g.getObservers().at(0).get());
+    auto mockObserver = static_cast<BatchGraphObserverMock*>(g.getObservers().at(1).get());
+
+    // Batch aware observer is notified once with a coalesced changeset, other observers are notified synchronously
+    EXPECT_CALL(*batchObserver, mockNodeInserted()).Times(0);
+    EXPECT_CALL(*batchObserver, mockEdgeInserted()).Times(0);
+    EXPECT_CALL(*batchObserver, mockEdgeRemoved()).Times(0);
+    EXPECT_CALL(*batchObserver, mockBatch(3u, 1u, 0u)).Times(1);
+    EXPECT_CALL(*mockObserver, mockNodeInserted()).Times(3);
+    EXPECT_CALL(*mockObserver, mockEdgeInserted()).Times(2);
+    EXPECT_CALL(*mockObserver, mockEdgeRemoved()).Times(1);
+    EXPECT_CALL(*mockObserver, mockBatch(testing::_, testing::_, testing::_)).Times(0);
+    {
+        gtpo::scoped_batch<qan::Graph> batch{g};
+        auto n1 = new qan::Node{};
+        auto n2 = new qan::Node{};
+        auto n3 = new qan::Node{};
+        g.insert_node(n1);
+        g.begin_batch();        // Nested batch, notifications are flushed by outermost batch
+        g.insert_node(n2);
+        g.insert_node(n3);
+        g.end_batch();
+        EXPECT_TRUE(g.in_batch());
+        g.insert_edge(n1, n2);
+        auto e = g.insert_edge(n2, n3);
+        g.remove_edge(e);       // Edge inserted and removed in the same batch: not reported
+    }
+    EXPECT_FALSE(g.in_batch());
+    testing::Mock::VerifyAndClearExpectations(batchObserver);
+    testing::Mock::VerifyAndClearExpectations(mockObserver);
+
+    // Outside of a batch, batch aware observers are notified synchronously
+    EXPECT_CALL(*batchObserver, mockNodeInserted()).Times(1);
+    EXPECT_CALL(*batchObserver, mockBatch(testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(*mockObserver, mockNodeInserted()).Times(1);
+    g.insert_node(new qan::Node{});
+    testing::Mock::VerifyAndClearExpectations(batchObserver);
+    testing::Mock::VerifyAndClearExpectations(mockObserver);
+    g.clear();
+}
+
+class BatchNodeObserverMock : public gtpo::node_observer<qan::Node, qan::Edge>
+{
+public:
+    BatchNodeObserverMock() { set_batch_aware(true); }
+    virtual ~BatchNodeObserverMock() { }
+
+protected:
+    virtual void    on_in_node_inserted(qan::Node&, qan::Node&, const qan::Edge&) noexcept override { mockInNodeInserted(); }
+    virtual void    on_out_node_inserted(qan::Node&, qan::Node&, const qan::Edge&) noexcept override { mockOutNodeInserted(); }
+    virtual void    on_batch(qan::Node&, const gtpo::node_changeset<qan::Edge>& changeset) noexcept override {
+        mockBatch(changeset.inserted_in_edges.size(), changeset.inserted_out_edges.size());
+    }
+
+public:
+    MOCK_METHOD0(mockInNodeInserted, void(void));
+    MOCK_METHOD0(mockOutNodeInserted, void(void));
+    MOCK_METHOD2(mockBatch, void(std::size_t, std::size_t));
+};
+
+TEST(gtpo_node_observer, batch)
+{
+    qan::Graph g;
+    auto n = new qan::Node{};
+    auto n2 = new qan::Node{};
+    auto n3 = new qan::Node{};
+    EXPECT_EQ(g.insert_nodes({n, n2, n3}), 3u);
+    n->add_observer(std::make_unique<BatchNodeObserverMock>());
+    auto mockObserver = static_cast<BatchNodeObserverMock*>(n->getObservers().at(0).get());
+
+    // insert_edges() open a graph batch: n observer is notified once
+    EXPECT_CALL(*mockObserver, mockInNodeInserted()).Times(0);
+    EXPECT_CALL(*mockObserver, mockOutNodeInserted()).Times(0);
+    EXPECT_CALL(*mockObserver, mockBatch(2u, 1u)).Times(1);
+    const auto edges = g.insert_edges(std::vector<std::pair<qan::Node*, qan::Node*>>{{n2, n}, {n3, n}, {n, n3}});
+    EXPECT_EQ(edges.size(), 3u);
+    EXPECT_FALSE(n->in_batch());
+    testing::Mock::VerifyAndClearExpectations(mockObserver);
+    g.clear();
+}
+
@@ -0,0 +1,275 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software.
+//
+// \file	intersection_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+// Qt headers
+#include <QLineF>
+#include <QPainterPath>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// QuickQanava tests headers
+#include "./benchmark.h"
+
+namespace { // ::
+
+//! Reference segment/polygon intersection (original qan::EdgeItem::getLineIntersection() implementation).
+bool    referenceIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon, QPointF& intersection)
+{
+    const QLineF line{p1, p2};
+    for (auto p = 0; p < polygon.length() - 1 ; ++p) {
+        const QLineF polyLine(polygon[p], polygon[p + 1]);
+        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection)
+            return true;
+    }
+    return false;
+}
+
+//! Same shape than qan::NodeItem::generateDefaultBoundingShape().
+QPolygonF   defaultBoundingShape(qreal width, qreal height)
+{
+    QPainterPath path;
+    path.addRoundedRect(QRectF{ 0., 0., width, height }, 5., 5.);
+    return path.toFillPolygon(QTransform{});
+}
+
+QPolygonF   starShape(int branches, qreal radius)
+{
+    QPolygonF star;
+    for (int b = 0; b <= 2 * branches; b++) {
+        const qreal angle = b * 3.14159265358979 / branches;
+        const qreal r = (b % 2 == 0 ? radius : radius / 3.);
+        star << QPointF{radius + r * std::cos(angle), radius + r * std::sin(angle)};
+    }
+    return star;
+}
+
+} // ::
+
+TEST(qan_intersection, default_bounding_shape_is_rect)
+{
+    const qan::ClipPolygon clip{defaultBoundingShape(100., 50.)};
+    EXPECT_TRUE(clip.isRect());
+    EXPECT_TRUE(qan::ClipPolygon{QPolygonF{QRectF{0., 0., 20., 10.}}}.isRect());
+    EXPECT_FALSE(qan::ClipPolygon{starShape(5, 50.)}.isRect());
+    EXPECT_FALSE(qan::ClipPolygon{QPolygonF{}}.isRect());
+}
+
+TEST(qan_intersection, kernels_match_reference)
+{
+    const std::vector<QPolygonF> polygons{defaultBoundingShape(100., 50.),
+                                          QPolygonF{QRectF{0., 0., 20., 10.}},
+                                          starShape(5, 50.),
+                                          defaultBoundingShape(7., 3.)};
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> distribution{-200., 200.};
+    for (const auto& polygon : polygons) {
+        const qan::ClipPolygon clip{polygon};
+        const auto center = polygon.boundingRect().center();
+        for (int i = 0; i < 10000; i++) {
+            // Mostly center to outside segments (edges use case), but also random segments
+            QPointF p1 = i % 5 == 0 ? QPointF{distribution(generator), distribution(generator)} : center;
+            QPointF p2{distribution(generator), distribution(generator)};
+            if (i % 2 == 0)
+                std::swap(p1, p2);
+
+            QPointF expected, intersection;
+            const bool expectedFound = referenceIntersection(p1, p2, polygon, expected);
+            ASSERT_EQ(expectedFound, clip.intersect(p1, p2, intersection));
+            if (expectedFound) {
+                EXPECT_NEAR(expected.x(), intersection.x(), 0.0001);
+                EXPECT_NEAR(expected.y(), intersection.y(), 0.0001);
+            }
+        }
+    }
+}
+
+TEST(qan_intersection, kernels_match_scalar_kernel)
+{
+    const auto& kernels = qan::segmentPolygonIntersectionKernels();
+    ASSERT_FALSE(kernels.empty());
+    EXPECT_STREQ("scalar", kernels.front().name);
+    EXPECT_STREQ(qan::segmentPolygonIntersectionKernel(), kernels.back().name);
+    RecordProperty("dispatched_kernel", qan::segmentPolygonIntersectionKernel());
+    const auto star = starShape(7, 50.);
+    std::vector<float> xs(17, static_cast<float>(star.last().x()));   // 14 edges padded to 16 edges + 1
+    std::vector<float> ys(17, static_cast<float>(star.last().y()));
+    for (int v = 0; v < star.size(); v++) {
+        xs[v] = static_cast<float>(star[v].x());
+        ys[v] = static_cast<float>(star[v].y());
+    }
+    for (const auto& kernel : kernels) {   // Every compiled (and supported) kernel is tested, not only the dispatched one
+        SCOPED_TRACE(kernel.name);
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{-100.f, 200.f};
+        int intersections = 0;
+        for (int i = 0; i < 10000; i++) {
+            const float p1x = distribution(generator), p1y = distribution(generator);
+            const float p2x = distribution(generator), p2y = distribution(generator);
+            const int expected = qan::segmentPolygonIntersectionScalar(p1x, p1y, p2x, p2y, xs.data(), ys.data(), star.size() - 1);
+            ASSERT_EQ(expected, kernel.function(p1x, p1y, p2x, p2y, xs.data(), ys.data(), star.size() - 1));
+            intersections += expected >= 0 ? 1 : 0;
+        }
+        EXPECT_GT(intersections, 0);
+    }
+}
+
+TEST(qan_intersection, node_item_clip_polygon_cache)
+{
+    // Node item clip polygon is shared until its bounding shape or size change
+    qan::NodeItem nodeItem;
+    nodeItem.setSize(QSizeF{100., 50.});
+    const auto clip = nodeItem.getClipPolygon();
+    ASSERT_NE(clip, nullptr);
+    EXPECT_TRUE(clip->isRect());
+    EXPECT_EQ(nodeItem.getClipPolygon(), clip);
+
+    nodeItem.setBoundingShape(starShape(5, 50.));
+    const auto starClip = nodeItem.getClipPolygon();
+    EXPECT_NE(starClip, clip);
+    EXPECT_FALSE(starClip->isRect());
+    EXPECT_TRUE(clip->isRect());        // Previous polygon is still valid for its owners
+
+    nodeItem.setWidth(200.);
+    EXPECT_NE(nodeItem.getClipPolygon(), starClip);
+}
+
+TEST(qan_intersection, curve_polyline_contains)
+{
+    const QPointF p1{0., 0.}, c1{40., 120.}, c2{160., -80.}, p2{200., 50.};
+    qan::CurvePolyline curve;
+    EXPECT_FALSE(curve.contains(p1, 6.));
+    curve.reset(p1, c1, c2, p2);
+    ASSERT_GE(curve.getPoints().size(), 2u);
+    EXPECT_TRUE(curve.contains(p1, 6.));
+    EXPECT_TRUE(curve.contains(p2, 6.));
+    EXPECT_FALSE(curve.contains(QPointF{100., 300.}, 6.));     // Culled by bounding rect
+
+    const auto valueAt = [&](qreal t) {
+        const qreal mt = 1. - t;
+        return p1 * (mt * mt * mt) + c1 * (3. * mt * mt * t) + c2 * (3. * mt * t * t) + p2 * (t * t * t);
+    };
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> position{0., 1.};
+    std::uniform_real_distribution<qreal> offset{-10., 10.};
+    for (int i = 0; i < 1000; i++) {
+        const QPointF point = valueAt(position(generator)) + QPointF{offset(generator), offset(generator)};
+        qreal expected = std::numeric_limits<qreal>::max();     // Brute force distance by dense sampling
+        for (int s = 0; s <= 10000; s++)
+            expected = std::min(expected, QLineF{point, valueAt(s / 10000.)}.length());
+        EXPECT_NEAR(expected, curve.distance(point), 0.001);
+        if (std::abs(expected - 6.) > 0.001)
+            EXPECT_EQ(expected <= 6., curve.contains(point, 6.));
+    }
+}
+
+TEST(qan_intersection, DISABLED_benchmarks)
+{
+    constexpr int iterations = 1000000;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> distribution{-500., 500.};
+    std::vector<QPointF> points(1024);
+    for (auto& point : points)
+        point = QPointF{distribution(generator), distribution(generator)};
+
+    for (const auto& polygon : {defaultBoundingShape(100., 50.), starShape(16, 50.)}) {
+        std::cerr << "Polygon with " << polygon.size() << " vertices:" << std::endl;
+        const auto center = polygon.boundingRect().center();
+        const qan::ClipPolygon clip{polygon};
+        QPointF result;
+        qreal checksum = 0.;
+        qan::test::benchmark("  reference QLineF loop", iterations, [&](int i) {
+            if (referenceIntersection(center, points[i % points.size()], polygon, result))
+                checksum += result.x();
+        });
+        qan::test::benchmark("  qan::ClipPolygon::intersect()", iterations, [&](int i) {
+            if (clip.intersect(center, points[i % points.size()], result))
+                checksum -= result.x();
+        });
+        qan::test::benchmark("  qan::ClipPolygon construction", iterations / 100, [&](int) {
+            const qan::ClipPolygon c{polygon};
+            checksum += c.getEdgeCount();
+        });
+        // Full edge update path: clip polygon rebuilt for every update vs shared node item clip polygon
+        qan::ClipPolygon rebuilt;
+        qan::test::benchmark("  qan::ClipPolygon::reset() + intersect()", iterations, [&](int i) {
+            rebuilt.reset(polygon);
+            if (rebuilt.intersect(center, points[i % points.size()], result))
+                checksum += result.x();
+        });
+        qan::NodeItem nodeItem;
+        nodeItem.setBoundingShape(polygon);
+        qan::test::benchmark("  qan::NodeItem::getClipPolygon() + intersect()", iterations, [&](int i) {
+            const auto nodeClip = nodeItem.getClipPolygon();
+            if (nodeClip->intersect(center, points[i % points.size()], result))
+                checksum -= result.x();
+        });
+        std::cerr << "  (checksum " << checksum << ")" << std::endl;
+    }
+
+    // Curved edge hit testing: original 25 samples approach vs qan::CurvePolyline
+    std::cerr << "Curve hit testing:" << std::endl;
+    const QPointF p1{0., 0.}, c1{40., 120.}, c2{160., -80.}, p2{200., 50.};
+    const auto valueAt = [&](qreal t) {
+        const qreal mt = 1. - t;
+        return p1 * (mt * mt * mt) + c1 * (3. * mt * mt * t) + c2 * (3. * mt * t * t) + p2 * (t * t * t);
+    };
+    int hits = 0;
+    qan::test::benchmark("  25 samples", iterations, [&](int i) {
+        const auto& point = points[i % points.size()];
+        for (int step = 0; step < 25; step++) {
+            if (QLineF{point, valueAt(step / 25.)}.length() < 6.001) {
+                ++hits;
+                break;
+            }
+        }
+    });
+    qan::CurvePolyline curve;
+    curve.reset(p1, c1, c2, p2);
+    qan::test::benchmark("  qan::CurvePolyline::contains()", iterations, [&](int i) {
+        if (curve.contains(points[i % points.size()], 6.001))
+            --hits;
+    });
+    std::cerr << "  (checksum " << hits << ")" << std::endl;
+}
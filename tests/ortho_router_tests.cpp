@@ -0,0 +1,160 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software.
+//
+// \file	ortho_router_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <random>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// QuickQanava tests headers
+#include "./benchmark.h"
+
+namespace { // ::
+
+int     bendCount(const std::vector<QPointF>& route) { return route.size() > 2 ? static_cast<int>(route.size()) - 2 : 0; }
+
+//! Return true if all \c route segments are horizontal or vertical and do not cross any \c obstacles.
+bool    isValidRoute(const std::vector<QPointF>& route, const std::vector<QRectF>& obstacles)
+{
+    for (std::size_t s = 1; s < route.size(); s++) {
+        const QPointF& a = route[s - 1];
+        const QPointF& b = route[s];
+        if (a.x() != b.x() && a.y() != b.y())     // Route points are copied from the routing grid, exact comparison is fine
+            return false;
+        const QRectF segment = QRectF{a, b}.normalized().adjusted(-0.01, -0.01, 0.01, 0.01);
+        for (const auto& obstacle : obstacles)
+            if (obstacle.intersects(segment))
+                return false;
+    }
+    return true;
+}
+
+} // ::
+
+TEST(qan_ortho_router, straight_route)
+{
+    qan::OrthoRouter router;
+    const QRectF src{0., 0., 50., 50.};
+    const QRectF dst{200., 0., 50., 50.};
+    std::vector<qan::OrthoRouter::Key> affected;
+    router.setObstacle(&src, src, affected);
+    router.setObstacle(&dst, dst, affected);
+    const auto route = router.route(src, dst, &src, &dst);
+    ASSERT_EQ(2u, route.size());
+    EXPECT_EQ(QPointF(50., 25.), route.front());
+    EXPECT_EQ(QPointF(200., 25.), route.back());
+    EXPECT_TRUE(router.route(src, src.adjusted(10., 10., 10., 10.)).empty());  // Overlapping src/dst
+}
+
+TEST(qan_ortho_router, avoid_obstacle)
+{
+    qan::OrthoRouter router;
+    const QRectF src{0., 0., 50., 50.};
+    const QRectF dst{400., 0., 50., 50.};
+    const QRectF obstacle{150., -100., 100., 250.};
+    std::vector<qan::OrthoRouter::Key> affected;
+    router.setObstacle(&src, src, affected);
+    router.setObstacle(&dst, dst, affected);
+    router.setObstacle(&obstacle, obstacle, affected);
+    EXPECT_EQ(3, router.getObstacleCount());
+
+    const auto route = router.route(src, dst, &src, &dst);
+    ASSERT_GE(route.size(), 4u);
+    const qreal m = router.getMargin() - 1.;           // Routes might follow obstacle margin border
+    EXPECT_TRUE(isValidRoute(route, {obstacle.adjusted(-m, -m, m, m)}));
+    EXPECT_LE(bendCount(route), 4);
+
+    // Obstacle is not an obstacle when it is source
+    EXPECT_EQ(2u, router.route(obstacle, QRectF{400., 0., 50., 50.}, &obstacle, &dst).size());
+}
+
+TEST(qan_ortho_router, affected_routes)
+{
+    qan::OrthoRouter router;
+    const QRectF src{0., 0., 50., 50.};
+    const QRectF dst{300., 0., 50., 50.};
+    std::vector<qan::OrthoRouter::Key> affected;
+    router.setObstacle(&src, src, affected);
+    router.setObstacle(&dst, dst, affected);
+    int edge = 0;
+    router.setRoute(&edge, router.route(src, dst, &src, &dst));
+    EXPECT_EQ(1, router.getRouteCount());
+
+    const QRectF obstacle{1000., 1000., 50., 50.};     // Far from route: no route affected
+    affected.clear();
+    EXPECT_TRUE(router.setObstacle(&obstacle, obstacle, affected));
+    EXPECT_TRUE(affected.empty());
+    EXPECT_FALSE(router.setObstacle(&obstacle, obstacle, affected));   // Unchanged obstacle
+
+    affected.clear();                                   // Moved on route
+    EXPECT_TRUE(router.setObstacle(&obstacle, QRectF{150., 0., 50., 50.}, affected));
+    ASSERT_EQ(1u, affected.size());
+    EXPECT_EQ(&edge, affected.front());
+
+    affected.clear();                                   // Removed from route
+    router.removeObstacle(&obstacle, affected);
+    EXPECT_EQ(1u, affected.size());
+
+    router.removeRoute(&edge);
+    affected.clear();
+    router.getRoutesIntersecting(QRectF{0., 0., 400., 400.}, affected);
+    EXPECT_TRUE(affected.empty());
+}
+
+TEST(qan_ortho_router, DISABLED_benchmark)
+{
+    qan::OrthoRouter router;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> position{0., 5000.};
+    std::vector<QRectF> obstacles;
+    for (int o = 0; o < 1000; o++)
+        obstacles.emplace_back(position(generator), position(generator), 60., 40.);
+    std::vector<qan::OrthoRouter::Key> affected;
+    for (const auto& obstacle : obstacles)
+        router.setObstacle(&obstacle, obstacle, affected);
+
+    std::uniform_int_distribution<std::size_t> index{0, obstacles.size() - 1};
+    int routed = 0;
+    qan::test::benchmark("1000 routes", 1000, [&](int) {
+        const auto& src = obstacles[index(generator)];
+        const auto& dst = obstacles[index(generator)];
+        routed += router.route(src, dst, &src, &dst).empty() ? 0 : 1;
+    });
+    EXPECT_GT(routed, 0);
+}
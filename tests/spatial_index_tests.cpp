@@ -0,0 +1,233 @@
+/*
+ Copyright (c) 2008-2023, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software.
+//
+// \file	spatial_index_tests.cpp
+// \author	benoit@qanava.org
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <algorithm>
+#include <random>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// QuickQanava tests headers
+#include "./benchmark.h"
+
+namespace { // ::
+
+//! Return sorted copy of \c keys.
+std::vector<qan::SpatialIndex::Key> sorted(std::vector<qan::SpatialIndex::Key> keys)
+{
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+} // ::
+
+TEST(qan_spatial_index, items_in)
+{
+    qan::SpatialIndex index;
+    const QRectF a{0., 0., 50., 50.};
+    const QRectF b{200., 0., 50., 50.};
+    const QRectF edge{50., 25., 150., 0.};    // Horizontal edge bounding rect
+    EXPECT_TRUE(index.setRect(&a, a));
+    EXPECT_TRUE(index.setRect(&b, b));
+    EXPECT_TRUE(index.setRect(&edge, edge));
+    EXPECT_FALSE(index.setRect(&a, a));       // Unchanged rect
+    EXPECT_EQ(3, index.size());
+
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.itemsIn(QRectF{-10., -10., 500., 500.}, keys);
+    EXPECT_EQ(3u, keys.size());
+
+    keys.clear();
+    index.itemsIn(QRectF{100., 0., 10., 50.}, keys);
+    ASSERT_EQ(1u, keys.size());
+    EXPECT_EQ(&edge, keys.front());
+
+    keys.clear();
+    index.itemsAt(QPointF{225., 25.}, keys);
+    ASSERT_EQ(1u, keys.size());
+    EXPECT_EQ(&b, keys.front());
+
+    keys.clear();
+    index.itemsAt(QPointF{1000., 1000.}, keys);
+    EXPECT_TRUE(keys.empty());
+}
+
+TEST(qan_spatial_index, move_and_remove)
+{
+    qan::SpatialIndex index;
+    const QRectF a{0., 0., 50., 50.};
+    index.setRect(&a, a);
+
+    std::vector<qan::SpatialIndex::Key> keys;
+    EXPECT_TRUE(index.setRect(&a, QRectF{10000., -20000., 50., 50.}));   // Outside of root cell
+    index.itemsAt(QPointF{25., 25.}, keys);
+    EXPECT_TRUE(keys.empty());
+    index.itemsAt(QPointF{10025., -19975.}, keys);
+    ASSERT_EQ(1u, keys.size());
+    QRectF r;
+    EXPECT_TRUE(index.getRect(&a, r));
+    EXPECT_EQ(QRectF(10000., -20000., 50., 50.), r);
+
+    EXPECT_TRUE(index.remove(&a));
+    EXPECT_FALSE(index.remove(&a));
+    EXPECT_FALSE(index.contains(&a));
+    keys.clear();
+    index.itemsAt(QPointF{10025., -19975.}, keys);
+    EXPECT_TRUE(keys.empty());
+
+    index.setRect(&a, a);
+    index.clear();
+    EXPECT_EQ(0, index.size());
+}
+
+TEST(qan_spatial_index, nearest)
+{
+    qan::SpatialIndex index;
+    const QRectF a{0., 0., 10., 10.};
+    const QRectF b{100., 0., 10., 10.};
+    const QRectF c{300., 0., 10., 10.};
+    index.setRect(&a, a);
+    index.setRect(&b, b);
+    index.setRect(&c, c);
+
+    std::vector<qan::SpatialIndex::Key> keys;
+    index.nearest(QPointF{90., 5.}, 2, keys);
+    ASSERT_EQ(2u, keys.size());
+    EXPECT_EQ(&b, keys[0]);
+    EXPECT_EQ(&a, keys[1]);
+
+    keys.clear();
+    index.nearest(QPointF{5., 5.}, 10, keys);
+    ASSERT_EQ(3u, keys.size());
+    EXPECT_EQ(&a, keys[0]);
+    EXPECT_EQ(&c, keys[2]);
+}
+
+TEST(qan_spatial_index, brute_force)
+{
+    qan::SpatialIndex index;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> position{-3000., 3000.};
+    std::uniform_real_distribution<qreal> size{0., 200.};
+    std::vector<QRectF> rects;
+    for (int r = 0; r < 500; r++)
+        rects.emplace_back(position(generator), position(generator), size(generator), size(generator));
+    for (const auto& rect : rects)
+        index.setRect(&rect, rect);
+    for (std::size_t r = 0; r < rects.size(); r += 3) {      // Move one third of rects
+        rects[r] = QRectF{position(generator), position(generator), size(generator), size(generator)};
+        index.setRect(&rects[r], rects[r]);
+    }
+    for (std::size_t r = 1; r < rects.size(); r += 5)       // Remove one fifth of rects
+        index.remove(&rects[r]);
+
+    for (int q = 0; q < 50; q++) {
+        const QRectF query{position(generator), position(generator), 500., 300.};
+        std::vector<qan::SpatialIndex::Key> expected;
+        for (std::size_t r = 0; r < rects.size(); r++)
+            if (index.contains(&rects[r]) &&
+                rects[r].left() <= query.right() && rects[r].right() >= query.left() &&
+                rects[r].top() <= query.bottom() && rects[r].bottom() >= query.top())
+                expected.push_back(&rects[r]);
+        std::vector<qan::SpatialIndex::Key> keys;
+        index.itemsIn(query, keys);
+        EXPECT_EQ(sorted(expected), sorted(keys));
+    }
+}
+
+TEST(qan_spatial_index, rect_difference)
+{
+    // Rubber band selection query only the difference between previous and current selection rects
+    const auto area = [](const std::vector<QRectF>& rects) {
+        qreal a = 0.;
+        for (const auto& rect : rects)
+            a += rect.width() * rect.height();
+        return a;
+    };
+    const QRectF previous{0., 0., 100., 100.};
+    const QRectF grown{0., 0., 150., 120.};
+    std::vector<QRectF> rects;
+    qan::appendRectDifference(previous, grown, rects);      // Growing: nothing leave selection rect
+    EXPECT_TRUE(rects.empty());
+    qan::appendRectDifference(grown, previous, rects);      // ... right and bottom bands enter it
+    EXPECT_EQ(rects.size(), 2u);
+    EXPECT_DOUBLE_EQ(area(rects), 150. * 120. - 100. * 100.);
+    for (const auto& rect : rects)
+        EXPECT_TRUE(grown.contains(rect) && !previous.intersected(rect).isValid());
+
+    rects.clear();                                          // Shrinking: bands leave selection rect
+    qan::appendRectDifference(grown, previous, rects);
+    const auto leaving = rects.size();
+    qan::appendRectDifference(previous, grown, rects);
+    EXPECT_EQ(rects.size(), leaving);
+    EXPECT_DOUBLE_EQ(area(rects), 150. * 120. - 100. * 100.);
+
+    rects.clear();                                          // Disjoint rects
+    qan::appendRectDifference(previous, QRectF{200., 200., 10., 10.}, rects);
+    ASSERT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects.front(), previous);
+
+    rects.clear();                                          // Moved rect: both borders differences
+    const QRectF moved{50., 50., 100., 100.};
+    qan::appendRectDifference(previous, moved, rects);
+    qan::appendRectDifference(moved, previous, rects);
+    EXPECT_EQ(rects.size(), 4u);
+    EXPECT_DOUBLE_EQ(area(rects), 2. * (100. * 100. - 50. * 50.));
+}
+
+TEST(qan_spatial_index, DISABLED_benchmark)
+{
+    qan::SpatialIndex index;
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> position{0., 50000.};
+    std::vector<QRectF> rects;
+    for (int r = 0; r < 100000; r++)
+        rects.emplace_back(position(generator), position(generator), 60., 40.);
+    for (const auto& rect : rects)
+        index.setRect(&rect, rect);
+
+    std::size_t found = 0;
+    std::vector<qan::SpatialIndex::Key> keys;
+    qan::test::benchmark("10000 picks in 100000 rects", 10000, [&](int) {
+        keys.clear();
+        index.itemsAt(QPointF{position(generator), position(generator)}, keys);
+        found += keys.size();
+    });
+    EXPECT_GT(found, 0u);
+}
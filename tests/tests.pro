@@ -10,6 +10,12 @@ include (../src/quickqanava.pri)
 
 SOURCES	+=  ./tests.cpp             \
             ./topology_tests.cpp    \
+            ./algorithms_tests.cpp  \
+            ./intersection_tests.cpp \
+            ./arrow_tests.cpp       \
+            ./ortho_router_tests.cpp \
+            ./spatial_index_tests.cpp \
+            ./batch_tests.cpp       \
             #./observers_tests.cpp   \
             #./groups_tests.cpp
 
@@ -37,6 +37,12 @@
 #include <memory>
 #include <iostream>
 
+// Qt headers
+#include <QCoreApplication>
+#include <QQmlEngine>
+#include <QQmlComponent>
+#include <QQuickWindow>
+
 // GTpo headers
 #include <QuickQanava>
 
@@ -307,6 +313,176 @@ TEST(qan_Graph, edge_insert_parallel)
     }
 }
 
+TEST(qan_Graph, edge_index_parallel)
+{
+    // find_edge() / has_edge() / remove_edge(src, dst) must stay consistent with
+    // parallel edges and edge removal
+    qan::Graph g;
+    auto n1 = g.create_node();
+    g.insert_node(n1);
+    auto n2 = g.create_node();
+    g.insert_node(n2);
+    EXPECT_EQ(g.find_edge(n1, n2), nullptr);
+    auto e1 = g.insert_edge(n1, n2);
+    auto e2 = g.insert_edge(n1, n2);
+    EXPECT_EQ(g.find_edge(n1, n2), e1);     // First inserted edge is returned
+    EXPECT_EQ(g.find_edge(n2, n1), nullptr);
+    EXPECT_FALSE(g.has_edge(n2, n1));
+    g.remove_edge(e1);
+    EXPECT_EQ(g.find_edge(n1, n2), e2);
+    EXPECT_EQ(g.get_edge_count(n1, n2), 1);
+    EXPECT_TRUE(g.remove_edge(n1, n2));
+    EXPECT_FALSE(g.has_edge(n1, n2));
+    EXPECT_FALSE(g.remove_edge(n1, n2));
+
+    // Removing a node must clean the index
+    auto n3 = g.create_node();
+    g.insert_node(n3);
+    g.insert_edge(n1, n3);
+    g.insert_edge(n3, n2);
+    g.remove_node(n3);
+    EXPECT_FALSE(g.has_edge(n1, n3));
+    EXPECT_EQ(g.get_edge_count(), 0);
+
+    // Preconfigured edges are indexed only once inserted, edges with a nullptr destination are rejected
+    auto invalid = std::make_unique<qan::Edge>();
+    invalid->set_src(n1);
+    EXPECT_FALSE(g.insert_edge(invalid.get()));
+    EXPECT_EQ(g.find_edge(n1, nullptr), nullptr);
+    EXPECT_EQ(g.get_edge_count(), 0);
+    auto e3 = new qan::Edge{};
+    e3->set_src(n1);
+    e3->set_dst(n2);
+    EXPECT_TRUE(g.insert_edge(e3));
+    EXPECT_EQ(g.find_edge(n1, n2), e3);
+    EXPECT_EQ(g.get_edge_count(n1, n2), 1);
+}
+
+TEST(qan_Graph, remove_slot)
+{
+    // Removing nodes and edges move last container item to the removed
+    // item slot: graph containers must stay consistent
+    qan::Graph g;
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 5; n++) {
+        auto node = g.create_node();
+        g.insert_node(node);
+        nodes.push_back(node);
+    }
+    auto e1 = g.insert_edge(nodes[0], nodes[1]);
+    auto e2 = g.insert_edge(nodes[1], nodes[2]);
+    auto e3 = g.insert_edge(nodes[2], nodes[3]);
+    EXPECT_EQ(g.get_root_node_count(), 2);  // nodes[0] and nodes[4]
+
+    g.remove_edge(e1);                      // e3 is moved to e1 slot
+    EXPECT_FALSE(g.contains(e1));
+    EXPECT_EQ(g.get_edges().at(0), e3);
+    EXPECT_TRUE(g.remove_edge(e3));
+    EXPECT_EQ(g.get_edges().at(0), e2);
+    EXPECT_EQ(g.get_edge_count(), 1);
+
+    // nodes[0] out degree is 0 and it is still a root node, removing its out edge must
+    // not register it twice
+    EXPECT_EQ(g.get_root_node_count(), 4);  // nodes[0], nodes[1], nodes[3] and nodes[4]
+    EXPECT_TRUE(g.is_root_node(nodes[0]));
+    EXPECT_TRUE(g.is_root_node(nodes[1]));
+
+    g.remove_node(nodes[0]);                // nodes[4] is moved to nodes[0] slot
+    EXPECT_EQ(g.get_node_count(), 4);
+    EXPECT_EQ(g.get_nodes().at(0), nodes[4]);
+    EXPECT_EQ(g.get_root_node_count(), 3);
+    g.remove_node(nodes[4]);
+    EXPECT_EQ(g.get_node_count(), 3);
+    EXPECT_FALSE(g.contains(nodes[4]));
+    EXPECT_TRUE(g.contains(nodes[1]));
+    EXPECT_TRUE(g.is_root_node(nodes[1]));
+    EXPECT_FALSE(g.is_root_node(nodes[2]));
+    EXPECT_EQ(g.get_root_node_count(), 2);  // nodes[1] and nodes[3]
+}
+
+TEST(qan_Graph, insert_bulk)
+{
+    qan::Graph g;
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 4; n++)
+        nodes.push_back(g.create_node());
+    nodes.push_back(nullptr);           // nullptr and duplicated nodes are ignored
+    nodes.push_back(nodes[0]);
+    EXPECT_EQ(g.insert_nodes(nodes), 4);
+    EXPECT_EQ(g.get_node_count(), 4);
+    EXPECT_EQ(g.get_root_node_count(), 4);
+    EXPECT_EQ(g.insert_nodes(nodes), 0);    // Already inserted
+
+    const auto edges = g.insert_edges({{nodes[0], nodes[1]},
+                                       {nodes[0], nodes[2]},
+                                       {nodes[2], nodes[3]},
+                                       {nodes[2], nullptr}});
+    EXPECT_EQ(edges.size(), 3);
+    EXPECT_EQ(g.get_edge_count(), 3);
+    EXPECT_EQ(g.get_root_node_count(), 1);
+    EXPECT_TRUE(g.is_root_node(nodes[0]));
+    EXPECT_TRUE(g.has_edge(nodes[2], nodes[3]));
+    EXPECT_EQ(nodes[0]->get_out_degree(), 2);
+    EXPECT_EQ(nodes[3]->get_in_degree(), 1);
+
+    // Bulk inserted nodes and edges are removable like others
+    g.remove_node(nodes[2]);
+    EXPECT_EQ(g.get_edge_count(), 1);
+    EXPECT_EQ(g.get_root_node_count(), 2);
+
+    // qan::Graph::insertNodes() / insertEdges() with non visual nodes
+    qan::Graph g2;
+    std::vector<qan::Node*> nodes2{g2.create_node(), g2.create_node()};
+    EXPECT_EQ(g2.insertNodes(nodes2), 2);
+    EXPECT_EQ(g2.insertEdges({{nodes2[0], nodes2[1]}}).size(), 1);
+    EXPECT_TRUE(g2.hasEdge(nodes2[0], nodes2[1]));
+}
+
+namespace { // ::anonymous
+class InsertionHookGraph : public qan::Graph
+{
+public:
+    int nodeHookCount = 0;
+    int edgeHookCount = 0;
+protected:
+    virtual void    onNodeInserted(qan::Node& node) override { Q_UNUSED(node); ++nodeHookCount; }
+    virtual void    onEdgeInserted(qan::Edge& edge) override { Q_UNUSED(edge); ++edgeHookCount; }
+};
+} // ::anonymous
+
+TEST(qan_Graph, bulk_insert_notify)
+{
+    // insertNodes() / insertEdges() call insertion hooks for every primitive and emit a single QList signal
+    InsertionHookGraph g;
+    QList<qan::Node*> insertedNodes;
+    QList<qan::Edge*> insertedEdges;
+    int nodesSignalCount = 0;
+    int edgesSignalCount = 0;
+    QObject::connect(&g, &qan::Graph::nodesInserted, [&](QList<qan::Node*> nodes) {
+        ++nodesSignalCount;
+        insertedNodes = nodes;
+    });
+    QObject::connect(&g, &qan::Graph::edgesInserted, [&](QList<qan::Edge*> edges) {
+        ++edgesSignalCount;
+        insertedEdges = edges;
+    });
+    std::vector<qan::Node*> nodes{g.create_node(), g.create_node(), g.create_node()};
+    EXPECT_EQ(g.insertNodes(nodes), 3);
+    EXPECT_EQ(g.nodeHookCount, 3);
+    EXPECT_EQ(nodesSignalCount, 1);
+    EXPECT_EQ(insertedNodes.size(), 3);
+
+    const auto edges = g.insertEdges({{nodes[0], nodes[1]},
+                                      {nodes[1], nodes[2]},
+                                      {nodes[2], nullptr}});
+    EXPECT_EQ(edges.size(), 2);
+    EXPECT_EQ(g.edgeHookCount, 2);
+    EXPECT_EQ(edgesSignalCount, 1);
+    ASSERT_EQ(insertedEdges.size(), 2);
+    EXPECT_EQ(insertedEdges[0], edges[0]);
+    EXPECT_EQ(insertedEdges[1], edges[1]);
+}
+
 TEST(qan_Graph, edge_remove_contains)
 {
     // Graph must no longer contains() an edge that has been removed
@@ -591,3 +767,1062 @@ TEST(qan_Graph, isAncestor)
     EXPECT_TRUE(g.isAncestor(n1, n2));
     EXPECT_TRUE(g.isAncestor(n1, n3));
 }
+
+TEST(qan_Graph, snapshot)
+{
+    qan::Graph g;
+    //     +-----------+
+    //     v           |
+    // g = n3 -> n2 -> n1 -> n4    n5
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4, n5});
+    g.insert_edge(n2, n1);
+    g.insert_edge(n3, n2);
+    g.insert_edge(n1, n3);
+    g.insert_edge(n1, n4);
+
+    const auto snapshot = g.snapshot();
+    EXPECT_EQ(snapshot.get_node_count(), 5);
+    EXPECT_EQ(snapshot.get_edge_count(), 4);
+    const auto n1Id = snapshot.get_id(n1);
+    ASSERT_NE(n1Id, qan::Graph::Snapshot::invalid_id);
+    EXPECT_EQ(snapshot.get_node(n1Id), n1);
+    EXPECT_EQ(snapshot.get_out_degree(n1Id), 2);
+    EXPECT_EQ(snapshot.get_in_degree(n1Id), 1);
+    EXPECT_EQ(snapshot.get_node(snapshot.get_in_nodes(n1Id)[0]), n2);
+    EXPECT_EQ(snapshot.get_id(nullptr), qan::Graph::Snapshot::invalid_id);
+
+    // Snapshot algorithms must return the same results than pointer based algorithms
+    EXPECT_EQ(g.collectDfs(snapshot), g.collectDfs());
+    EXPECT_EQ(g.collectDfs(snapshot, *n1), g.collectDfs(*n1));
+    EXPECT_EQ(g.collectAncestors(snapshot, *n1), g.collectAncestors(*n1));
+    EXPECT_EQ(g.collectChilds(snapshot, *n2), g.collectChilds(*n2));
+    EXPECT_FALSE(g.isAncestor(snapshot, *n1, *n4));
+    EXPECT_TRUE(g.isAncestor(snapshot, *n4, *n1));
+    EXPECT_FALSE(g.isAncestor(snapshot, *n1, *n5));
+    EXPECT_FALSE(g.isAncestor(snapshot, *n1, *n1));
+    EXPECT_TRUE(g.isAncestor(snapshot, *n1, *n3));
+    EXPECT_EQ(g.collectInnerEdges(snapshot, {n1, n2, n3}).size(), 3);
+}
+
+TEST(qan_Graph, reachability_index)
+{
+    qan::Graph g;
+    g.setReachabilityIndexed(true);
+    ASSERT_TRUE(g.getReachabilityIndexed());
+    //     +-----------+
+    //     v           |
+    // g = n3 -> n2 -> n1 -> n4    n5
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4, n5});
+    g.insert_edge(n2, n1);
+    g.insert_edge(n3, n2);
+    auto e13 = g.insert_edge(n1, n3);   // Circuit from n1 to n3
+    g.insert_edge(n1, n4);
+
+    EXPECT_FALSE(g.isAncestor(n1, n4));
+    EXPECT_TRUE(g.isAncestor(n4, n1));
+    EXPECT_TRUE(g.isAncestor(n4, n3));
+    EXPECT_FALSE(g.isAncestor(n1, n5));
+    EXPECT_FALSE(g.isAncestor(n1, n1));
+    EXPECT_TRUE(g.isAncestor(n1, n2));
+    EXPECT_TRUE(g.isAncestor(n1, n3));
+    EXPECT_TRUE(g.isAncestor(n3, n1));  // Through circuit
+
+    // Index stay valid after edge removal and rebuild
+    g.remove_edge(e13);
+    EXPECT_FALSE(g.isAncestor(n3, n1));
+    g.setReachabilityIndexed(false);
+    g.setReachabilityIndexed(true);     // Force index rebuild
+    EXPECT_FALSE(g.isAncestor(n3, n1));
+    EXPECT_TRUE(g.isAncestor(n4, n3));
+    EXPECT_TRUE(g.is_reachable(n3, n4));
+    EXPECT_FALSE(g.is_reachable(n4, n3));
+
+    // Non indexed queries use graph traversal engine
+    g.setReachabilityIndexed(false);
+    EXPECT_TRUE(g.is_reachable(n3, n4));
+    EXPECT_FALSE(g.is_reachable(n4, n3));
+    EXPECT_TRUE(g.is_reachable(n1, n1));
+    EXPECT_FALSE(g.is_reachable(n1, n5));
+}
+
+TEST(qan_Graph, reachability_index_chain)
+{
+    // Building a long chain top-down exhaust edge insertion propagation budget, index is then rebuilt before next query
+    qan::Graph g;
+    g.setReachabilityIndexed(true);
+    const int chainLength = 10000;
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(chainLength);
+    for (int n = 0; n < chainLength; n++)
+        nodes.push_back(g.create_node());
+    g.insert_nodes(nodes);
+    for (int n = 1; n < chainLength; n++)   // Top-down: each edge insertion reach all previous nodes
+        g.insert_edge(nodes[n - 1], nodes[n]);
+    EXPECT_TRUE(g.is_reachable(nodes.front(), nodes.back()));
+    EXPECT_TRUE(g.is_reachable(nodes[chainLength / 2], nodes.back()));
+    EXPECT_FALSE(g.is_reachable(nodes.back(), nodes.front()));
+    EXPECT_FALSE(g.is_reachable(nodes[chainLength / 2], nodes.front()));
+
+    // Index is incrementally updated again once rebuilt
+    auto n = g.create_node();
+    g.insert_node(n);
+    g.insert_edge(nodes.back(), n);
+    EXPECT_TRUE(g.is_reachable(nodes.front(), n));
+    EXPECT_FALSE(g.is_reachable(n, nodes.front()));
+}
+
+TEST(qan_Graph, topological_order)
+{
+    qan::Graph g;
+    g.set_topologically_ordered(true);
+    ASSERT_TRUE(g.is_topologically_ordered());
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.insert_nodes({n1, n2, n3, n4});
+
+    // Insert edges in "reverse" order to force reordering: n4 -> n3 -> n2 -> n1
+    g.insert_edge(n3, n2);
+    g.insert_edge(n2, n1);
+    g.insert_edge(n4, n3);
+    EXPECT_TRUE(g.is_acyclic());
+    const auto expected = std::vector<qan::Node*>{n4, n3, n2, n1};
+    EXPECT_EQ(g.topological_nodes(), expected);
+
+    EXPECT_FALSE(g.would_create_cycle(n4, n1));
+    EXPECT_TRUE(g.would_create_cycle(n1, n4));
+    EXPECT_TRUE(g.would_create_cycle(n2, n2));
+
+    // Inserting a circuit invalidate order, removing it restore order
+    auto e = g.insert_edge(n1, n4);
+    EXPECT_FALSE(g.is_acyclic());
+    EXPECT_TRUE(g.topological_nodes().empty());
+    g.remove_edge(e);
+    EXPECT_TRUE(g.is_acyclic());
+    EXPECT_EQ(g.topological_nodes(), expected);
+
+    g.remove_node(n3);
+    const auto expectedRemoved = std::vector<qan::Node*>{n4, n2, n1};
+    EXPECT_EQ(g.topological_nodes(), expectedRemoved);
+}
+
+TEST(qan_Graph, acyclic_unordered)
+{
+    // Circuits are detected on demand when topological order is not maintained
+    qan::Graph g;
+    ASSERT_FALSE(g.is_topologically_ordered());
+    EXPECT_TRUE(g.is_acyclic());        // Empty graph
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.insert_nodes({n1, n2, n3});
+    g.insert_edge(n1, n2);
+    g.insert_edge(n2, n3);
+    g.insert_edge(n1, n3);
+    EXPECT_TRUE(g.is_acyclic());
+    EXPECT_TRUE(g.topological_nodes().empty());
+
+    auto e = g.insert_edge(n3, n1);
+    EXPECT_FALSE(g.is_acyclic());
+    g.remove_edge(e);
+    EXPECT_TRUE(g.is_acyclic());
+
+    g.insert_edge(n3, n3);              // Self loop is a circuit
+    EXPECT_FALSE(g.is_acyclic());
+}
+
+TEST(qan_Graph, traversal_deep_chain)
+{
+    // Traversal engine is iterative: long chains must not overflow the call stack
+    qan::Graph g;
+    const int chainLength = 20000;
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(chainLength);
+    for (int n = 0; n < chainLength; n++)
+        nodes.push_back(g.create_node());
+    g.insert_nodes(nodes);
+    std::vector<std::pair<qan::Node*, qan::Node*>> edges;
+    for (int n = 1; n < chainLength; n++)
+        edges.emplace_back(nodes[n - 1], nodes[n]);
+    g.insert_edges(edges);
+
+    const auto dfs = g.collectDfs();
+    ASSERT_EQ(dfs.size(), chainLength);
+    EXPECT_EQ(dfs.front(), nodes.front());
+    EXPECT_EQ(dfs.back(), nodes.back());
+    EXPECT_EQ(g.collectAncestors(*nodes.back()).size(), chainLength - 1);
+    EXPECT_EQ(g.collectChilds(*nodes.front()).size(), chainLength - 1);
+    EXPECT_TRUE(g.isAncestor(nodes.back(), nodes.front()));
+    EXPECT_FALSE(g.isAncestor(nodes.front(), nodes.back()));
+
+    // Marks are reset between traversals
+    EXPECT_EQ(g.collectDfs(*nodes.front()).size(), chainLength - 1);
+    EXPECT_EQ(g.collectDfs(*nodes.front()).size(), chainLength - 1);
+}
+
+namespace { // ::
+
+//! Create node and edge delegates items from inline QML components (tests can't rely on QuickQanava qrc module).
+struct DelegateComponents
+{
+    DelegateComponents()
+    {
+        static const bool registered = []() {
+            qmlRegisterType<qan::NodeItem>("QuickQanavaTests", 1, 0, "NodeItem");
+            qmlRegisterType<qan::EdgeItem>("QuickQanavaTests", 1, 0, "EdgeItem");
+            qmlRegisterType<qan::GroupItem>("QuickQanavaTests", 1, 0, "GroupItem");
+            qmlRegisterType<qan::PortItem>("QuickQanavaTests", 1, 0, "PortItem");
+            return true;
+        }();
+        Q_UNUSED(registered)
+        node = create("NodeItem { width: 100; height: 50 }");
+        edge = create("EdgeItem { }");
+    }
+    //! Graph items are created in engine root context.
+    void    attach(qan::Graph& graph) { QQmlEngine::setContextForObject(&graph, engine.rootContext()); }
+    std::unique_ptr<QQmlComponent>  create(const QByteArray& qml)
+    {
+        auto component = std::make_unique<QQmlComponent>(&engine);
+        component->setData("import QtQuick\nimport QuickQanavaTests 1.0\n" + qml, QUrl{});
+        return component;
+    }
+
+    QQmlEngine                      engine;
+    std::unique_ptr<QQmlComponent>  node;
+    std::unique_ptr<QQmlComponent>  edge;
+};
+
+} // ::
+
+TEST(qan_Graph, virtualized_non_visual)
+{
+    // Non visual nodes and edges are ignored by virtualization, nodes without item store their geometry
+    qan::Graph g;
+    g.setVirtualized(true);
+    auto n1 = g.insertNonVisualNode<qan::Node>();
+    auto n2 = g.insertNonVisualNode<qan::Node>();
+    g.insertNonVisualEdge<qan::Edge>(*n1, n2);
+    n1->setItemGeometry(QRectF{10., 20., 100., 50.});
+    EXPECT_EQ(n1->getItemGeometry(), QRectF(10., 20., 100., 50.));
+
+    g.setViewportRect(QRectF{0., 0., 800., 600.});
+    g.updateVirtualization();
+    EXPECT_EQ(n1->getItem(), nullptr);
+    g.setVirtualized(false);
+    EXPECT_EQ(n2->getItem(), nullptr);
+    EXPECT_EQ(g.get_edge_count(), 1);
+}
+
+TEST(qan_Graph, virtualized)
+{
+    // Items are created when their node enter view and destroyed once out of view, except for selected,
+    // grouped nodes and nodes with ports
+    DelegateComponents delegates;
+    ASSERT_TRUE(delegates.node->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    g.setPortDelegate(delegates.create("PortItem { width: 10; height: 10 }"));
+    const auto groupComponent = delegates.create("GroupItem { width: 400; height: 400; container: content; Item { id: content } }");
+    ASSERT_TRUE(groupComponent->isReady());
+    g.setVirtualized(true);
+    g.setVirtualizationMargin(0.);
+    g.setViewportRect(QRectF{0., 0., 400., 300.});
+
+    const auto insertNode = [&](QRectF geometry) {
+        auto node = g.insertNode(delegates.node.get(), qan::Node::style());
+        if (node != nullptr)
+            node->setItemGeometry(geometry);
+        return node;
+    };
+    auto n = insertNode(QRectF{10., 10., 100., 50.});
+    auto selected = insertNode(QRectF{150., 10., 100., 50.});
+    auto ported = insertNode(QRectF{10., 100., 100., 50.});
+    auto grouped = insertNode(QRectF{150., 100., 100., 50.});
+    auto distant = insertNode(QRectF{2000., 2000., 100., 50.});
+    for (const auto node : {n, selected, ported, grouped, distant}) {
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->getItem(), nullptr);
+    }
+
+    g.updateVirtualization();
+    for (const auto node : {n, selected, ported, grouped})
+        EXPECT_NE(node->getItem(), nullptr);
+    EXPECT_EQ(distant->getItem(), nullptr);
+    EXPECT_EQ(n->getItem()->position(), QPointF(10., 10.));
+
+    g.setNodeSelected(*selected, true);
+    EXPECT_NE(g.insertPort(ported, qan::NodeItem::Dock::Left), nullptr);
+    auto group = g.insertGroup(groupComponent.get());
+    ASSERT_NE(group, nullptr);
+    EXPECT_TRUE(g.groupNode(group, grouped));
+
+    const QPointer<qan::NodeItem> nodeItem = n->getItem();
+    const auto selectedItem = selected->getItem();
+    const auto portedItem = ported->getItem();
+    const auto groupedItem = grouped->getItem();
+    g.setViewportRect(QRectF{1900., 1900., 400., 300.});
+    g.updateVirtualization();
+    EXPECT_EQ(n->getItem(), nullptr);
+    EXPECT_EQ(n->getItemGeometry(), QRectF(10., 10., 100., 50.));
+    EXPECT_NE(distant->getItem(), nullptr);
+    EXPECT_EQ(selected->getItem(), selectedItem);
+    EXPECT_EQ(ported->getItem(), portedItem);
+    EXPECT_EQ(grouped->getItem(), groupedItem);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    EXPECT_TRUE(nodeItem.isNull());
+
+    g.setViewportRect(QRectF{0., 0., 400., 300.});
+    g.updateVirtualization();
+    ASSERT_NE(n->getItem(), nullptr);
+    EXPECT_EQ(n->getItem()->position(), QPointF(10., 10.));
+    EXPECT_EQ(distant->getItem(), nullptr);
+}
+
+TEST(qan_Graph, tree_layouts_virtualized)
+{
+    // Layouts position nodes without item (virtualized out of view) using their stored geometry
+    qan::Graph g;
+    g.setVirtualized(true);
+    auto root = g.insertNonVisualNode<qan::Node>();
+    auto a = g.insertNonVisualNode<qan::Node>();
+    auto b = g.insertNonVisualNode<qan::Node>();
+    g.insertNonVisualEdge<qan::Edge>(*root, a);
+    g.insertNonVisualEdge<qan::Edge>(*root, b);
+    for (const auto node : {root, a, b})
+        node->setItemGeometry(QRectF{0., 0., 100., 50.});
+    ASSERT_EQ(root->getItem(), nullptr);
+    ASSERT_EQ(a->getItem(), nullptr);
+
+    qan::OrgTreeLayout orgTreeLayout;
+    orgTreeLayout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Vertical);
+    orgTreeLayout.layout(*root, 25., 25.);
+    EXPECT_EQ(root->getItemGeometry(), QRectF(0., 0., 100., 50.));
+    EXPECT_EQ(a->getItemGeometry(), QRectF(125., 75., 100., 50.));
+    EXPECT_EQ(b->getItemGeometry(), QRectF(125., 150., 100., 50.));
+
+    qan::NaiveTreeLayout naiveTreeLayout;
+    naiveTreeLayout.layout(*root);
+    EXPECT_EQ(root->getItemGeometry().topLeft(), QPointF(0., 0.));
+    EXPECT_EQ(a->getItemGeometry().topLeft(), QPointF(0., 125.));
+    EXPECT_EQ(b->getItemGeometry().topLeft(), QPointF(125., 125.));
+
+    qan::RandomLayout randomLayout;
+    const QRectF layoutRect{0., 0., 1000., 1000.};
+    randomLayout.setLayoutRect(layoutRect);
+    randomLayout.layout(*root);
+    for (const auto node : {root, a, b}) {
+        EXPECT_TRUE(layoutRect.contains(node->getItemGeometry()));
+        EXPECT_EQ(node->getItemGeometry().size(), QSizeF(100., 50.));
+        EXPECT_EQ(node->getItem(), nullptr);
+    }
+}
+
+TEST(qan_Graph, reuse_items_non_visual)
+{
+    // Non visual nodes and edges have no delegate items, removing them must leave pools empty
+    qan::Graph g;
+    EXPECT_FALSE(g.getReuseItems());
+    g.setReuseItems(true);
+    g.setMaxPooledItems(-1);
+    EXPECT_EQ(g.getMaxPooledItems(), 0);
+    g.setMaxPooledItems(16);
+    auto n1 = g.insertNonVisualNode<qan::Node>();
+    auto n2 = g.insertNonVisualNode<qan::Node>();
+    auto e = g.insertNonVisualEdge<qan::Edge>(*n1, n2);
+    g.removeEdge(e);
+    g.removeNode(n1);
+    EXPECT_EQ(g.getPooledItemCount(), 0);
+    EXPECT_EQ(g.getNodeCount(), 1);
+    g.clearItemPools();
+    EXPECT_EQ(g.getPooledItemCount(), 0);
+}
+
+TEST(qan_Graph, reuse_items)
+{
+    // Removed node item is pooled, then reused for the next node created with the same delegate component
+    DelegateComponents delegates;
+    ASSERT_TRUE(delegates.node->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    g.setReuseItems(true);
+    g.setMaxPooledItems(16);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    const QPointer<qan::NodeItem> nodeItem = n1->getItem();
+    ASSERT_FALSE(nodeItem.isNull());
+    int pooled = 0;
+    int reused = 0;
+    QObject::connect(nodeItem.data(), &qan::NodeItem::pooled, [&pooled]() { ++pooled; });
+    QObject::connect(nodeItem.data(), &qan::NodeItem::reused, [&reused]() { ++reused; });
+
+    g.removeNode(n1);
+    EXPECT_EQ(g.getPooledItemCount(), 1);
+    EXPECT_EQ(pooled, 1);
+    EXPECT_EQ(reused, 0);
+    ASSERT_FALSE(nodeItem.isNull());
+    EXPECT_EQ(nodeItem->getNode(), nullptr);
+    EXPECT_FALSE(nodeItem->isVisible());
+
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n2, nullptr);
+    EXPECT_EQ(n2->getItem(), nodeItem.data());
+    EXPECT_EQ(nodeItem->getNode(), n2);
+    EXPECT_TRUE(nodeItem->isVisible());
+    EXPECT_EQ(reused, 1);
+    EXPECT_EQ(g.getPooledItemCount(), 0);
+}
+
+TEST(qan_Graph, reuse_items_delegate_state)
+{
+    // Properties set by delegate are restored when item is pooled, not reset to NodeItem defaults
+    DelegateComponents delegates;
+    const auto hookComponent = delegates.create("NodeItem { width: 14; height: 14; minimumSize: Qt.size(14, 14); "
+                                                "resizable: false; selectable: false }");
+    ASSERT_TRUE(hookComponent->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    g.setReuseItems(true);
+    auto n1 = g.insertNode(hookComponent.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    const QPointer<qan::NodeItem> nodeItem = n1->getItem();
+    ASSERT_FALSE(nodeItem.isNull());
+    EXPECT_EQ(nodeItem->getMinimumSize(), QSizeF(14., 14.));
+    nodeItem->setResizable(true);           // Modified after creation, restored when pooled
+    nodeItem->setMinimumSize(QSizeF{50., 50.});
+
+    g.removeNode(n1);
+    ASSERT_EQ(g.getPooledItemCount(), 1);
+    EXPECT_FALSE(nodeItem->getResizable());
+    EXPECT_FALSE(nodeItem->getSelectable());
+    EXPECT_TRUE(nodeItem->getDraggable());
+    EXPECT_EQ(nodeItem->getMinimumSize(), QSizeF(14., 14.));
+
+    auto n2 = g.insertNode(hookComponent.get(), qan::Node::style());
+    ASSERT_NE(n2, nullptr);
+    ASSERT_EQ(n2->getItem(), nodeItem.data());
+    g.removeNode(n2);                       // Second cycle restore the state saved on first creation
+    EXPECT_FALSE(nodeItem->getResizable());
+    EXPECT_FALSE(nodeItem->getSelectable());
+    EXPECT_EQ(nodeItem->getMinimumSize(), QSizeF(14., 14.));
+}
+
+TEST(qan_Graph, asynchronous_non_visual)
+{
+    // Non visual nodes and edges are never incubated, asynchronous graph topology is modified synchronously
+    qan::Graph g;
+    g.setAsynchronous(true);
+    g.setIncubationBudget(0);
+    EXPECT_EQ(g.getIncubationBudget(), 1);
+    auto n1 = g.insertNonVisualNode<qan::Node>();
+    auto n2 = g.insertNonVisualNode<qan::Node>();
+    g.insertNonVisualEdge<qan::Edge>(*n1, n2);
+    EXPECT_EQ(g.getNodeCount(), 2);
+    EXPECT_EQ(g.get_edge_count(), 1);
+    EXPECT_EQ(g.getPendingItemCount(), 0);
+    g.setAsynchronous(false);
+    EXPECT_EQ(g.getPendingItemCount(), 0);
+}
+
+TEST(qan_Graph, asynchronous)
+{
+    // Items are created when pending items are completed, edge item only once its source and destination items exist
+    DelegateComponents delegates;
+    ASSERT_TRUE(delegates.node->isReady());
+    ASSERT_TRUE(delegates.edge->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    g.setAsynchronous(true);
+    int incubated = 0;
+    int realizedNodes = 0;
+    int realizedEdges = 0;
+    bool edgeNodesRealized = false;
+    QObject::connect(&g, &qan::Graph::itemsIncubated, [&incubated]() { ++incubated; });
+    QObject::connect(&g, &qan::Graph::nodeItemRealized, [&realizedNodes](qan::Node*) { ++realizedNodes; });
+    QObject::connect(&g, &qan::Graph::edgeItemRealized, [&](qan::Edge* edge) {
+        ++realizedEdges;
+        edgeNodesRealized = edge != nullptr &&
+                            edge->get_src()->getItem() != nullptr &&
+                            edge->get_dst()->getItem() != nullptr;
+    });
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    auto e = g.insertEdge(n1, n2, delegates.edge.get());
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(g.getNodeCount(), 2);
+    EXPECT_EQ(g.get_edge_count(), 1);
+    EXPECT_EQ(n1->getItem(), nullptr);
+    EXPECT_EQ(n2->getItem(), nullptr);
+    EXPECT_EQ(e->getItem(), nullptr);
+    EXPECT_GT(g.getPendingItemCount(), 0);
+    EXPECT_EQ(incubated, 0);
+
+    g.completePendingItems();
+    EXPECT_NE(n1->getItem(), nullptr);
+    EXPECT_NE(n2->getItem(), nullptr);
+    EXPECT_NE(e->getItem(), nullptr);
+    EXPECT_EQ(realizedNodes, 2);
+    EXPECT_EQ(realizedEdges, 1);
+    EXPECT_TRUE(edgeNodesRealized);
+    EXPECT_EQ(g.getPendingItemCount(), 0);
+    EXPECT_EQ(incubated, 1);
+    g.completePendingItems();   // Nothing left to incubate
+    EXPECT_EQ(incubated, 1);
+}
+
+TEST(qan_Graph, level_of_detail)
+{
+    // Graph level of detail is applied to node items, nodes are batched only by a NodeBatchRenderer
+    using LevelOfDetail = qan::NodeItem::LevelOfDetail;
+    qan::Graph g;
+    EXPECT_EQ(g.getLevelOfDetail(), LevelOfDetail::Full);
+    g.insertNonVisualNode<qan::Node>();
+    g.setLevelOfDetail(LevelOfDetail::Flat);
+    EXPECT_EQ(g.getLevelOfDetail(), LevelOfDetail::Flat);
+
+    qan::NodeItem nodeItem;
+    EXPECT_EQ(nodeItem.getLevelOfDetail(), LevelOfDetail::Full);
+    nodeItem.setLevelOfDetail(LevelOfDetail::Simplified);
+    EXPECT_EQ(nodeItem.getLevelOfDetail(), LevelOfDetail::Simplified);
+    EXPECT_FALSE(nodeItem.getBatched());
+}
+
+TEST(qan_Graph, global_z)
+{
+    // Cached node item global z follow parent group z and parent changes
+    DelegateComponents delegates;
+    const auto groupComponent = delegates.create("GroupItem { width: 400; height: 400; container: content; Item { id: content } }");
+    ASSERT_TRUE(groupComponent->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    auto group = g.insertGroup(groupComponent.get());
+    auto node = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(group, nullptr);
+    ASSERT_NE(node, nullptr);
+    const auto groupItem = group->getGroupItem();
+    const auto nodeItem = node->getItem();
+    ASSERT_NE(groupItem, nullptr);
+    ASSERT_NE(nodeItem, nullptr);
+    EXPECT_TRUE(g.groupNode(group, node));
+    ASSERT_EQ(node->getGroup(), group);
+
+    groupItem->setZ(1.);
+    nodeItem->setZ(2.);
+    EXPECT_DOUBLE_EQ(nodeItem->getGlobalZ(), qan::getItemGlobalZ_rec(nodeItem));
+    const qreal globalZ = nodeItem->getGlobalZ();
+    groupItem->setZ(11.);       // Cached child global z is invalidated by its parent group z change
+    EXPECT_DOUBLE_EQ(nodeItem->getGlobalZ(), globalZ + 10.);
+    EXPECT_DOUBLE_EQ(nodeItem->getGlobalZ(), qan::getItemGlobalZ_rec(nodeItem));
+
+    EXPECT_TRUE(g.ungroupNode(node));   // Invalidated on parent change
+    EXPECT_DOUBLE_EQ(nodeItem->getGlobalZ(), qan::getItemGlobalZ_rec(nodeItem));
+    groupItem->setZ(20.);
+    EXPECT_DOUBLE_EQ(nodeItem->getGlobalZ(), qan::getItemGlobalZ_rec(nodeItem));
+}
+
+TEST(qan_Graph, set_items_selected)
+{
+    // Batch selection update selection containers with a single selectionChanged(), locked primitives are not selected
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto locked = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    ASSERT_NE(locked, nullptr);
+    auto e = g.insertEdge(n1, n2, delegates.edge.get());
+    ASSERT_NE(e, nullptr);
+    ASSERT_NE(e->getItem(), nullptr);
+    locked->setLocked(true);
+    int selectionChanged = 0;
+    QObject::connect(&g, &qan::Graph::selectionChanged, [&selectionChanged]() { ++selectionChanged; });
+
+    g.setItemsSelected({n1->getItem(), n2->getItem(), locked->getItem(), e->getItem()}, true);
+    EXPECT_EQ(selectionChanged, 1);
+    EXPECT_EQ(g.getSelectedNodes().size(), 2u);
+    EXPECT_TRUE(g.getSelectedNodes().contains(n1));
+    EXPECT_TRUE(g.getSelectedNodes().contains(n2));
+    EXPECT_FALSE(g.getSelectedNodes().contains(locked));
+    EXPECT_FALSE(locked->getItem()->getSelected());
+    EXPECT_EQ(g.getSelectedEdges().size(), 1u);
+    EXPECT_TRUE(n1->getItem()->getSelected());
+    EXPECT_TRUE(e->getItem()->getSelected());
+
+    g.setItemsSelected({n1->getItem()}, true);     // Already selected: no change
+    EXPECT_EQ(selectionChanged, 1);
+    g.addToSelection(*locked);                      // Same implementation for single primitives
+    EXPECT_EQ(g.getSelectedNodes().size(), 2u);
+    g.setNodeSelected(*n1, false);
+    EXPECT_EQ(selectionChanged, 2);
+    EXPECT_FALSE(g.getSelectedNodes().contains(n1));
+    EXPECT_FALSE(n1->getItem()->getSelected());
+
+    g.setItemsSelected({n2->getItem(), e->getItem()}, false);
+    EXPECT_EQ(selectionChanged, 3);
+    EXPECT_EQ(g.getSelectedNodes().size(), 0u);
+    EXPECT_EQ(g.getSelectedEdges().size(), 0u);
+    EXPECT_FALSE(g.hasSelection());
+}
+
+TEST(qan_Graph, remove_selected)
+{
+    // Removed nodes and edges are removed from selection, remaining selection is still indexed
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 4; n++) {
+        nodes.push_back(g.insertNode(delegates.node.get(), qan::Node::style()));
+        ASSERT_NE(nodes.back(), nullptr);
+    }
+    auto e = g.insertEdge(nodes[2], nodes[3], delegates.edge.get());
+    ASSERT_NE(e, nullptr);
+    g.setItemsSelected({nodes[0]->getItem(), nodes[1]->getItem(), nodes[2]->getItem(),
+                        nodes[3]->getItem(), e->getItem()}, true);
+    ASSERT_EQ(g.getSelectedNodes().size(), 4u);
+
+    g.removeEdge(e);
+    EXPECT_EQ(g.getSelectedEdges().size(), 0u);
+    g.removeNode(nodes[0]);     // Last selected node is moved to first removed node position
+    EXPECT_EQ(g.getSelectedNodes().size(), 3u);
+    EXPECT_FALSE(g.getSelectedNodes().contains(nodes[0]));
+    g.setNodeSelected(*nodes[3], false);
+    EXPECT_EQ(g.getSelectedNodes().size(), 2u);
+    EXPECT_FALSE(g.getSelectedNodes().contains(nodes[3]));
+    g.removeNode(nodes[1]);
+    ASSERT_EQ(g.getSelectedNodes().size(), 1u);
+    EXPECT_TRUE(g.getSelectedNodes().contains(nodes[2]));
+    g.clearSelection();
+    EXPECT_FALSE(g.hasSelection());
+}
+
+TEST(qan_Graph, item_at_stacking_order)
+{
+    // At equal global z, itemAt() return the item painted last
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    const auto n1Item = n1->getItem();
+    const auto n2Item = n2->getItem();
+    for (const auto item : {n1Item, n2Item}) {
+        item->setPosition(QPointF{0., 0.});
+        item->setSize(QSizeF{100., 50.});
+        item->setZ(0.);
+    }
+    EXPECT_TRUE(qan::isItemStackedAbove(n2Item, n1Item));   // n2 item is after n1 item in container childItems()
+    EXPECT_FALSE(qan::isItemStackedAbove(n1Item, n2Item));
+    for (int i = 0; i < 10; i++)
+        EXPECT_EQ(g.itemAt(QPointF{50., 25.}), n2Item);
+
+    n1Item->stackAfter(n2Item);
+    EXPECT_EQ(g.itemAt(QPointF{50., 25.}), n1Item);
+    n2Item->setZ(1.);
+    EXPECT_EQ(g.itemAt(QPointF{50., 25.}), n2Item);
+}
+
+TEST(qan_Graph, group_at_stacking_order)
+{
+    // At equal global z, groupAt() return the group painted last, nested groups are painted after their parent group
+    DelegateComponents delegates;
+    const auto groupComponent = delegates.create("GroupItem { width: 400; height: 400; container: content; Item { id: content } }");
+    ASSERT_TRUE(groupComponent->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    auto g1 = g.insertGroup(groupComponent.get());
+    auto g2 = g.insertGroup(groupComponent.get());
+    ASSERT_NE(g1, nullptr);
+    ASSERT_NE(g2, nullptr);
+    for (const auto group : {g1, g2}) {
+        group->getItem()->setPosition(QPointF{0., 0.});
+        group->getItem()->setZ(0.);
+    }
+    const QPointF p{10., 10.};
+    const QSizeF s{10., 10.};
+    for (int i = 0; i < 10; i++)
+        EXPECT_EQ(g.groupAt(p, s), g2);
+    g1->getItem()->stackAfter(g2->getItem());
+    EXPECT_EQ(g.groupAt(p, s), g1);
+    EXPECT_EQ(g.groupAt(p, s, g1->getItem()), g2);
+
+    // Nested groups
+    auto outer = g.insertGroup(groupComponent.get());
+    auto inner = g.insertGroup(groupComponent.get());
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+    outer->getItem()->setPosition(QPointF{1000., 1000.});
+    EXPECT_TRUE(g.groupNode(outer, inner));
+    inner->getItem()->setPosition(QPointF{50., 50.});
+    inner->getItem()->setSize(QSizeF{100., 100.});
+    for (const auto group : {outer, inner})
+        group->getItem()->setZ(0.);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(g.groupAt(QPointF{1060., 1060.}, s), inner);
+        EXPECT_EQ(g.groupAt(QPointF{1300., 1300.}, s), outer);
+    }
+}
+
+TEST(qan_Graph, group_at_index_update)
+{
+    // Groups index follow groups collapse, move and resize
+    DelegateComponents delegates;
+    const auto groupComponent = delegates.create("GroupItem { width: 400; height: 400; container: content; Item { id: content } }");
+    ASSERT_TRUE(groupComponent->isReady());
+    qan::Graph g;
+    delegates.attach(g);
+    auto group = g.insertGroup(groupComponent.get());
+    ASSERT_NE(group, nullptr);
+    const auto groupItem = group->getGroupItem();
+    ASSERT_NE(groupItem, nullptr);
+    groupItem->setPosition(QPointF{0., 0.});
+    const QSizeF s{10., 10.};
+    EXPECT_EQ(g.groupAt(QPointF{10., 10.}, s), group);
+
+    groupItem->setCollapsed(true);      // Collapsed groups are not drop targets
+    EXPECT_EQ(g.groupAt(QPointF{10., 10.}, s), nullptr);
+    groupItem->setCollapsed(false);
+    groupItem->setSize(QSizeF{400., 400.});
+    EXPECT_EQ(g.groupAt(QPointF{10., 10.}, s), group);
+
+    groupItem->setPosition(QPointF{1000., 0.});     // Moved
+    EXPECT_EQ(g.groupAt(QPointF{10., 10.}, s), nullptr);
+    EXPECT_EQ(g.groupAt(QPointF{1010., 10.}, s), group);
+
+    groupItem->setSize(QSizeF{100., 100.});         // Resized
+    EXPECT_EQ(g.groupAt(QPointF{1200., 200.}, s), nullptr);
+    EXPECT_EQ(g.groupAt(QPointF{1050., 50.}, s), group);
+    groupItem->setSize(QSizeF{600., 600.});
+    EXPECT_EQ(g.groupAt(QPointF{1500., 500.}, s), group);
+
+    g.removeGroup(group);
+    EXPECT_EQ(g.groupAt(QPointF{1050., 50.}, s), nullptr);
+}
+
+namespace { // ::
+class UpdateCountEdgeItem : public qan::EdgeItem
+{
+public:
+    using qan::EdgeItem::EdgeItem;
+    int     updateCount = 0;
+    virtual void    updateItem() noexcept override { ++updateCount; qan::EdgeItem::updateItem(); }
+    virtual bool    supportsConcurrentGeometry() const noexcept override { return false; }
+};
+} // ::
+
+TEST(qan_Graph, dirty_edges_update_item)
+{
+    // Scheduled updates are coalesced to one update per frame, updateItem() is called for edges not supporting concurrent geometry
+    DelegateComponents delegates;
+    QQuickWindow window;
+    qan::Graph g;
+    delegates.attach(g);
+    g.setParentItem(window.contentItem());
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    ASSERT_NE(n1->getItem(), nullptr);
+    ASSERT_NE(n2->getItem(), nullptr);
+    ASSERT_NE(g.window(), nullptr);
+
+    UpdateCountEdgeItem edgeItem{&g};
+    edgeItem.setGraph(&g);
+    edgeItem.setSourceItem(n1->getItem());
+    edgeItem.setDestinationItem(n2->getItem());
+    g.updateDirtyEdges();
+    edgeItem.updateCount = 0;
+
+    n1->getItem()->setX(10.);
+    n1->getItem()->setY(20.);
+    n2->getItem()->setX(300.);
+    n2->getItem()->setWidth(120.);
+    EXPECT_TRUE(edgeItem.isUpdateScheduled());
+    EXPECT_EQ(edgeItem.updateCount, 0);
+    g.updateDirtyEdges();                   // Polish
+    EXPECT_FALSE(edgeItem.isUpdateScheduled());
+    EXPECT_EQ(edgeItem.updateCount, 1);
+    g.updateDirtyEdges();                   // Nothing left to update
+    EXPECT_EQ(edgeItem.updateCount, 1);
+}
+
+TEST(qan_Graph, edge_geometry_changed)
+{
+    // A single edgeGeometryChanged() is emitted per modified geometry update, a no-op update emits nothing
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    n2->getItem()->setPosition(QPointF{300., 200.});
+    auto edge = g.insertEdge(n1, n2, delegates.edge.get());
+    ASSERT_NE(edge, nullptr);
+    const auto edgeItem = edge->getItem();
+    ASSERT_NE(edgeItem, nullptr);
+    edgeItem->updateItem();
+
+    int geometryChangedCount = 0;
+    QObject::connect(edgeItem, &qan::EdgeItem::edgeGeometryChanged, [&geometryChangedCount]() { ++geometryChangedCount; });
+    int lineChangedCount = 0;   // Deprecated per part signals are emitted only along with edgeGeometryChanged()
+    QObject::connect(edgeItem, &qan::EdgeItem::lineGeometryChanged, [&lineChangedCount]() { ++lineChangedCount; });
+    const auto geometry = edgeItem->getEdgeGeometry();
+    edgeItem->updateItem();                 // No-op update
+    EXPECT_EQ(geometryChangedCount, 0);
+    EXPECT_EQ(lineChangedCount, 0);
+    EXPECT_EQ(edgeItem->getEdgeGeometry(), geometry);
+
+    n2->getItem()->setY(250.);              // Edge is updated immediately, graph is not in a window
+    EXPECT_EQ(geometryChangedCount, 1);
+    EXPECT_EQ(lineChangedCount, 1);
+    EXPECT_NE(edgeItem->getEdgeGeometry(), geometry);
+}
+
+TEST(qan_EdgeBatchRenderer, slots)
+{
+    // Edges are allocated a vertices slot when inserted, released slots are compacted once more than half of buffer is unused
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    qan::EdgeBatchRenderer renderer{g.getContainerItem()};
+    renderer.setGraph(&g);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    n2->getItem()->setPosition(QPointF{300., 200.});
+
+    const int edgeCount = 1000;
+    std::vector<std::pair<qan::Node*, qan::Node*>> pairs(edgeCount, {n1, n2});
+    const auto edges = g.insertEdges(pairs, delegates.edge.get());
+    ASSERT_EQ(static_cast<int>(edges.size()), edgeCount);
+    EXPECT_EQ(renderer.getEdgeCount(), edgeCount);
+    for (const auto edge : edges)
+        EXPECT_TRUE(edge->getItem()->getBatched());
+    const int vertexCount = renderer.getVertexCount();
+    EXPECT_GT(vertexCount, 0);
+    EXPECT_EQ(vertexCount % 3, 0);      // Slots contain whole triangles
+
+    // Released slots are not compacted immediately
+    for (int e = 0; e < edgeCount - 100; e++)
+        g.removeEdge(edges[e]);
+    EXPECT_EQ(renderer.getEdgeCount(), 100);
+    EXPECT_EQ(renderer.getVertexCount(), vertexCount);
+
+    // Released slot ids are reused, new slot vertices are allocated at the end of buffer
+    auto edge = g.insertEdge(n1, n2, delegates.edge.get());
+    ASSERT_NE(edge, nullptr);
+    EXPECT_EQ(renderer.getEdgeCount(), 101);
+    EXPECT_GT(renderer.getVertexCount(), vertexCount);
+
+    // Updating edges compact the buffer
+    n2->getItem()->setPosition(QPointF{400., 300.});
+    EXPECT_LT(renderer.getVertexCount(), vertexCount / 2);
+    EXPECT_EQ(renderer.getEdgeCount(), 101);
+    EXPECT_EQ(renderer.getVertexCount() % 3, 0);
+
+    renderer.setGraph(nullptr);
+    EXPECT_EQ(renderer.getEdgeCount(), 0);
+    EXPECT_EQ(renderer.getVertexCount(), 0);
+    EXPECT_FALSE(edge->getItem()->getBatched());
+}
+
+TEST(qan_NodeBatchRenderer, level_of_detail)
+{
+    // Existing items are batched when switching to flat level of detail and restored when switching back
+    using LevelOfDetail = qan::NodeItem::LevelOfDetail;
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    qan::NodeBatchRenderer renderer{g.getContainerItem()};
+    renderer.setGraph(&g);
+    EXPECT_EQ(renderer.getNodeCount(), 0);
+    EXPECT_FALSE(n1->getItem()->getBatched());
+
+    g.setLevelOfDetail(LevelOfDetail::Flat);
+    EXPECT_EQ(renderer.getNodeCount(), 2);
+    EXPECT_TRUE(n1->getItem()->getBatched());
+    EXPECT_TRUE(n2->getItem()->getBatched());
+    auto n3 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n3, nullptr);
+    EXPECT_EQ(renderer.getNodeCount(), 3);
+    EXPECT_TRUE(n3->getItem()->getBatched());
+
+    // Explicit removeNodeItem() / addNodeItem()
+    renderer.removeNodeItem(n3->getItem());
+    EXPECT_EQ(renderer.getNodeCount(), 2);
+    EXPECT_FALSE(n3->getItem()->getBatched());
+    renderer.addNodeItem(n3->getItem());
+    renderer.addNodeItem(n3->getItem());    // Already batched
+    renderer.addNodeItem(nullptr);
+    EXPECT_EQ(renderer.getNodeCount(), 3);
+    EXPECT_TRUE(n3->getItem()->getBatched());
+
+    g.removeNode(n3);
+    EXPECT_EQ(renderer.getNodeCount(), 2);
+
+    g.setLevelOfDetail(LevelOfDetail::Full);
+    EXPECT_EQ(renderer.getNodeCount(), 0);
+    EXPECT_FALSE(n1->getItem()->getBatched());
+    EXPECT_FALSE(n2->getItem()->getBatched());
+
+    g.setLevelOfDetail(LevelOfDetail::Flat);
+    EXPECT_EQ(renderer.getNodeCount(), 2);
+    renderer.setGraph(nullptr);
+    EXPECT_EQ(renderer.getNodeCount(), 0);
+    EXPECT_FALSE(n1->getItem()->getBatched());
+}
+
+TEST(qan_NodeBatchRenderer, pooled)
+{
+    // Virtualized node items are batched once realized, and released from renderer when pooled
+    using LevelOfDetail = qan::NodeItem::LevelOfDetail;
+    DelegateComponents delegates;
+    qan::Graph g;
+    delegates.attach(g);
+    g.setReuseItems(true);
+    g.setVirtualized(true);
+    g.setVirtualizationMargin(0.);
+    g.setViewportRect(QRectF{0., 0., 400., 300.});
+    g.setLevelOfDetail(LevelOfDetail::Flat);
+    qan::NodeBatchRenderer renderer{g.getContainerItem()};
+    renderer.setGraph(&g);
+
+    auto n = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n, nullptr);
+    n->setItemGeometry(QRectF{10., 10., 100., 50.});
+    g.updateVirtualization();
+    ASSERT_NE(n->getItem(), nullptr);
+    const QPointer<qan::NodeItem> nodeItem = n->getItem();
+    EXPECT_EQ(renderer.getNodeCount(), 1);
+    EXPECT_TRUE(nodeItem->getBatched());
+
+    g.setViewportRect(QRectF{1900., 1900., 400., 300.});
+    g.updateVirtualization();
+    EXPECT_EQ(n->getItem(), nullptr);
+    EXPECT_EQ(g.getPooledItemCount(), 1);
+    EXPECT_EQ(renderer.getNodeCount(), 0);
+    ASSERT_FALSE(nodeItem.isNull());
+    EXPECT_FALSE(nodeItem->getBatched());
+
+    g.setViewportRect(QRectF{0., 0., 400., 300.});
+    g.updateVirtualization();
+    EXPECT_EQ(n->getItem(), nodeItem.data());   // Pooled item is reused and batched again
+    EXPECT_EQ(renderer.getNodeCount(), 1);
+    EXPECT_TRUE(nodeItem->getBatched());
+}
+
+TEST(qan_Graph, schedule_update_item)
+{
+    // Several scheduleUpdateItem() calls (direct or from endpoints geometry changes) produce one geometry update per polish
+    DelegateComponents delegates;
+    QQuickWindow window;
+    qan::Graph g;
+    delegates.attach(g);
+    g.setParentItem(window.contentItem());
+    auto n1 = g.insertNode(delegates.node.get(), qan::Node::style());
+    auto n2 = g.insertNode(delegates.node.get(), qan::Node::style());
+    ASSERT_NE(n1, nullptr);
+    ASSERT_NE(n2, nullptr);
+    n2->getItem()->setPosition(QPointF{300., 200.});
+    auto edge = g.insertEdge(n1, n2, delegates.edge.get());
+    ASSERT_NE(edge, nullptr);
+    const auto edgeItem = edge->getItem();
+    ASSERT_NE(edgeItem, nullptr);
+    g.updateDirtyEdges();
+
+    int geometryChangedCount = 0;
+    QObject::connect(edgeItem, &qan::EdgeItem::edgeGeometryChanged, [&geometryChangedCount]() { ++geometryChangedCount; });
+    for (int u = 0; u < 4; u++) {
+        n2->getItem()->setPosition(QPointF{300. + u * 50., 200. + u * 20.});
+        edgeItem->scheduleUpdateItem();
+    }
+    EXPECT_TRUE(edgeItem->isUpdateScheduled());
+    EXPECT_EQ(geometryChangedCount, 0);     // Nothing is generated before polish
+    g.updateDirtyEdges();                   // Polish
+    EXPECT_FALSE(edgeItem->isUpdateScheduled());
+    EXPECT_EQ(geometryChangedCount, 1);
+    const auto geometry = edgeItem->getEdgeGeometry();
+
+    // A direct updateItem() call consume a pending scheduled update
+    n2->getItem()->setPosition(QPointF{100., 400.});
+    edgeItem->updateItem();
+    EXPECT_FALSE(edgeItem->isUpdateScheduled());
+    EXPECT_EQ(geometryChangedCount, 2);
+    EXPECT_NE(edgeItem->getEdgeGeometry(), geometry);
+    g.updateDirtyEdges();
+    EXPECT_EQ(geometryChangedCount, 2);
+}
+
+TEST(qan_Graph, dirty_edges_concurrent)
+{
+    // Large dirty edges batches from QML delegates are generated concurrently, with the same geometry than serial updateItem()
+    DelegateComponents delegates;
+    QQuickWindow window;
+    qan::Graph g;
+    delegates.attach(g);
+    g.setParentItem(window.contentItem());
+    const int nodeCount = 32;
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < nodeCount; n++) {
+        auto node = g.insertNode(delegates.node.get(), qan::Node::style());
+        ASSERT_NE(node, nullptr);
+        node->getItem()->setPosition(QPointF{(n % 8) * 200., (n / 8) * 150.});
+        nodes.push_back(node);
+    }
+    std::vector<std::pair<qan::Node*, qan::Node*>> pairs;
+    for (int e = 0; e < 1024; e++)      // More than 2 * 256 edges: at least two geometry chunks
+        pairs.emplace_back(nodes[e % nodeCount], nodes[(e * 7 + 3) % nodeCount]);
+    const auto edges = g.insertEdges(pairs, delegates.edge.get());
+    ASSERT_EQ(edges.size(), pairs.size());
+    g.updateDirtyEdges();
+    for (const auto edge : edges) {
+        ASSERT_NE(edge->getItem(), nullptr);
+        EXPECT_TRUE(edge->getItem()->supportsConcurrentGeometry());
+    }
+
+    for (int n = 0; n < nodeCount; n++)
+        nodes[n]->getItem()->setPosition(QPointF{(n % 4) * 310. + 15., (n / 4) * 95. + 25.});
+    for (const auto edge : edges)
+        EXPECT_TRUE(edge->getItem()->isUpdateScheduled());
+    g.updateDirtyEdges();                   // Concurrent batch
+
+    int geometryChangedCount = 0;
+    std::vector<qan::EdgeGeometry> batchGeometries;
+    std::vector<QRectF> batchRects;
+    for (const auto edge : edges) {
+        const auto edgeItem = edge->getItem();
+        EXPECT_FALSE(edgeItem->isUpdateScheduled());
+        batchGeometries.push_back(edgeItem->getEdgeGeometry());
+        batchRects.push_back(QRectF{edgeItem->position(), edgeItem->size()});
+        QObject::connect(edgeItem, &qan::EdgeItem::edgeGeometryChanged, [&geometryChangedCount]() { ++geometryChangedCount; });
+    }
+    for (std::size_t e = 0; e < edges.size(); e++) {     // Serial
+        const auto edgeItem = edges[e]->getItem();
+        edgeItem->updateItem();
+        EXPECT_EQ(edgeItem->getEdgeGeometry(), batchGeometries[e]);
+        EXPECT_EQ(QRectF(edgeItem->position(), edgeItem->size()), batchRects[e]);
+    }
+    EXPECT_EQ(geometryChangedCount, 0);
+}